@@ -0,0 +1,6 @@
+#ifndef DOVECOT_VERSION_H
+#define DOVECOT_VERSION_H
+
+#define DOVECOT_VERSION_FULL VERSION
+
+#endif /* DOVECOT_VERSION_H */
@@ -28,7 +28,10 @@ struct mail_storage_settings {
 	const char *mail_attachment_hash;
 	uoff_t mail_attachment_min_size;
 	const char *mail_attribute_dict;
+	const char *mail_index_shm_dir;
 	unsigned int mail_prefetch_count;
+	unsigned int mail_rebuild_concurrency;
+	unsigned int mail_search_concurrency;
 	const char *mail_cache_fields;
 	const char *mail_always_cache_fields;
 	const char *mail_never_cache_fields;
@@ -39,10 +42,14 @@ struct mail_storage_settings {
 	unsigned int mail_temp_scan_interval;
 	bool mail_save_crlf;
 	const char *mail_fsync;
+	bool mail_fsync_group_commit;
 	bool mmap_disable;
 	bool dotlock_use_excl;
 	bool mail_nfs_storage;
 	bool mail_nfs_index;
+	bool mail_index_inplace_write;
+	bool mail_cache_compress_background;
+	bool mail_index_log_packed;
 	bool mailbox_list_index;
 	bool mail_debug;
 	bool mail_full_filesystem_access;
@@ -551,7 +558,10 @@ static const struct setting_define mail_storage_setting_defines[] = {
 	DEF(SET_STR, mail_attachment_hash),
 	DEF(SET_SIZE, mail_attachment_min_size),
 	DEF(SET_STR_VARS, mail_attribute_dict),
+	DEF(SET_STR_VARS, mail_index_shm_dir),
 	DEF(SET_UINT, mail_prefetch_count),
+	DEF(SET_UINT, mail_rebuild_concurrency),
+	DEF(SET_UINT, mail_search_concurrency),
 	DEF(SET_STR, mail_cache_fields),
 	DEF(SET_STR, mail_always_cache_fields),
 	DEF(SET_STR, mail_never_cache_fields),
@@ -562,10 +572,14 @@ static const struct setting_define mail_storage_setting_defines[] = {
 	DEF(SET_TIME, mail_temp_scan_interval),
 	DEF(SET_BOOL, mail_save_crlf),
 	DEF(SET_ENUM, mail_fsync),
+	DEF(SET_BOOL, mail_fsync_group_commit),
 	DEF(SET_BOOL, mmap_disable),
 	DEF(SET_BOOL, dotlock_use_excl),
 	DEF(SET_BOOL, mail_nfs_storage),
 	DEF(SET_BOOL, mail_nfs_index),
+	DEF(SET_BOOL, mail_index_inplace_write),
+	DEF(SET_BOOL, mail_cache_compress_background),
+	DEF(SET_BOOL, mail_index_log_packed),
 	DEF(SET_BOOL, mailbox_list_index),
 	DEF(SET_BOOL, mail_debug),
 	DEF(SET_BOOL, mail_full_filesystem_access),
@@ -587,7 +601,10 @@ const struct mail_storage_settings mail_storage_default_settings = {
 	.mail_attachment_hash = "%{sha1}",
 	.mail_attachment_min_size = 1024*128,
 	.mail_attribute_dict = "",
+	.mail_index_shm_dir = "",
 	.mail_prefetch_count = 0,
+	.mail_rebuild_concurrency = 1,
+	.mail_search_concurrency = 1,
 	.mail_cache_fields = "flags",
 	.mail_always_cache_fields = "",
 	.mail_never_cache_fields = "imap.envelope",
@@ -598,10 +615,14 @@ const struct mail_storage_settings mail_storage_default_settings = {
 	.mail_temp_scan_interval = 7*24*60*60,
 	.mail_save_crlf = FALSE,
 	.mail_fsync = "optimized:never:always",
+	.mail_fsync_group_commit = FALSE,
 	.mmap_disable = FALSE,
 	.dotlock_use_excl = TRUE,
 	.mail_nfs_storage = FALSE,
 	.mail_nfs_index = FALSE,
+	.mail_index_inplace_write = FALSE,
+	.mail_cache_compress_background = FALSE,
+	.mail_index_log_packed = FALSE,
 	.mailbox_list_index = FALSE,
 	.mail_debug = FALSE,
 	.mail_full_filesystem_access = FALSE,
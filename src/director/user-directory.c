@@ -20,6 +20,8 @@ struct user_directory_iter {
 };
 
 struct user_directory {
+	/* users are allocated from here */
+	pool_t user_pool;
 	/* unsigned int username_hash => user */
 	HASH_TABLE(void *, struct user *) hash;
 	/* sorted by time */
@@ -57,7 +59,7 @@ static void user_free(struct user_directory *dir, struct user *user)
 
 	hash_table_remove(dir->hash, POINTER_CAST(user->username_hash));
 	DLLIST2_REMOVE(&dir->head, &dir->tail, user);
-	i_free(user);
+	p_free(dir->user_pool, user);
 }
 
 static bool user_directory_user_has_connections(struct user_directory *dir,
@@ -150,7 +152,7 @@ user_directory_add(struct user_directory *dir, unsigned int username_hash,
 	if (timestamp > ioloop_time)
 		timestamp = ioloop_time;
 
-	user = i_new(struct user, 1);
+	user = p_new(dir->user_pool, struct user, 1);
 	user->username_hash = username_hash;
 	user->host = host;
 	user->host->user_count++;
@@ -240,7 +242,8 @@ user_directory_init(unsigned int timeout_secs, const char *username_hash_fmt)
 		I_MAX(dir->user_near_expiring_secs, 1);
 
 	dir->username_hash_fmt = i_strdup(username_hash_fmt);
-	hash_table_create_direct(&dir->hash, default_pool, 0);
+	dir->user_pool = pool_slab_create("director users");
+	hash_table_create_direct_open(&dir->hash, default_pool, 0);
 	i_array_init(&dir->iters, 8);
 	return dir;
 }
@@ -256,6 +259,7 @@ void user_directory_deinit(struct user_directory **_dir)
 	while (dir->head != NULL)
 		user_free(dir, dir->head);
 	hash_table_destroy(&dir->hash);
+	pool_unref(&dir->user_pool);
 	array_free(&dir->iters);
 	i_free(dir->username_hash_fmt);
 	i_free(dir);
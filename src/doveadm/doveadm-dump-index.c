@@ -370,6 +370,18 @@ static void dump_cache_hdr(struct mail_cache *cache)
 		       cache_decision2str(field->decision),
 		       unixdate2str(field->last_used));
 	}
+
+	if (cache->columns_count > 0) {
+		printf("-- Cache columns (%u messages) --\n",
+		       cache->columns_messages_count);
+		for (i = 0; i < cache->columns_count; i++) {
+			printf("%s: size=%u bitmap=%u data=%u\n",
+			       fields[cache->columns[i].field_idx].name,
+			       cache->columns[i].field_size,
+			       cache->columns[i].bitmap_offset,
+			       cache->columns[i].data_offset);
+		}
+	}
 }
 
 static void dump_message_part(string_t *str, const struct message_part *part)
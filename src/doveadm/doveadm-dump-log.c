@@ -1,6 +1,7 @@
 /* Copyright (c) 2007-2013 Dovecot authors, see the included COPYING file */
 
 #include "lib.h"
+#include "buffer.h"
 #include "hex-binary.h"
 #include "mail-index-private.h"
 #include "mail-transaction-log.h"
@@ -118,6 +119,9 @@ static const char *log_record_type(unsigned int type)
 	case MAIL_TRANSACTION_ATTRIBUTE_UPDATE:
 		name = "attribute-update";
 		break;
+	case MAIL_TRANSACTION_PACKED:
+		name = "packed";
+		break;
 	default:
 		name = t_strdup_printf("unknown: %x", type);
 		break;
@@ -459,12 +463,31 @@ static void log_record_print(const struct mail_transaction_header *hdr,
 	}
 }
 
+static int
+dump_record_unpack(struct mail_transaction_header *hdr, const void **data,
+		   const char **error_r)
+{
+	enum mail_transaction_type type;
+	buffer_t *buf;
+	size_t size = hdr->size - sizeof(*hdr);
+
+	buf = buffer_create_dynamic(pool_datastack_create(), size * 4);
+	if (mail_transaction_unpack(*data, size, &type, buf, error_r) < 0)
+		return -1;
+	hdr->type = type | (hdr->type & ~MAIL_TRANSACTION_TYPE_MASK);
+	hdr->size = sizeof(*hdr) + buf->used;
+	*data = buf->data;
+	return 0;
+}
+
 static int dump_record(int fd, uint64_t *modseq)
 {
 	off_t offset;
 	ssize_t ret;
 	struct mail_transaction_header hdr;
-	unsigned int orig_size;
+	unsigned int orig_size, packed_size = 0;
+	const void *data = NULL;
+	const char *error;
 
 	offset = lseek(fd, 0, SEEK_CUR);
 
@@ -486,14 +509,6 @@ static int dump_record(int fd, uint64_t *modseq)
 		return 0;
 	}
 
-	printf("record: offset=%"PRIuUOFF_T", type=%s, size=%u",
-	       offset, log_record_type(hdr.type), hdr.size);
-	if (*modseq > 0 && mail_transaction_header_has_modseq(&hdr)) {
-		*modseq += 1;
-		printf(", modseq=%llu", (unsigned long long)*modseq);
-	}
-	printf("\n");
-
 	if (hdr.size < 1024*1024) {
 		unsigned char *buf = t_malloc(hdr.size);
 
@@ -502,10 +517,34 @@ static int dump_record(int fd, uint64_t *modseq)
 			i_fatal("rec data read() %"PRIuSIZE_T" != %"PRIuSIZE_T,
 				ret, hdr.size - sizeof(hdr));
 		}
-		log_record_print(&hdr, buf, modseq);
+		data = buf;
 	} else {
 		lseek(fd, hdr.size - sizeof(hdr), SEEK_CUR);
 	}
+
+	if ((hdr.type & MAIL_TRANSACTION_TYPE_MASK) ==
+	    MAIL_TRANSACTION_PACKED && data != NULL) {
+		packed_size = hdr.size;
+		if (dump_record_unpack(&hdr, &data, &error) < 0) {
+			printf("record: offset=%"PRIuUOFF_T", type=%s, size=%u"
+			       " - broken: %s\n", offset,
+			       log_record_type(hdr.type), hdr.size, error);
+			return 1;
+		}
+	}
+
+	printf("record: offset=%"PRIuUOFF_T", type=%s, size=%u",
+	       offset, log_record_type(hdr.type), hdr.size);
+	if (packed_size != 0)
+		printf(", packed size=%u", packed_size);
+	if (*modseq > 0 && mail_transaction_header_has_modseq(&hdr)) {
+		*modseq += 1;
+		printf(", modseq=%llu", (unsigned long long)*modseq);
+	}
+	printf("\n");
+
+	if (data != NULL)
+		log_record_print(&hdr, data, modseq);
 	return 1;
 }
 
@@ -1,7 +1,12 @@
 /* Copyright (c) 2010-2013 Dovecot authors, see the included COPYING file */
 
 #include "lib.h"
+#include "strnum.h"
+#include "settings-parser.h"
 #include "mail-storage.h"
+#include "mail-storage-settings.h"
+#include "mail-storage-service.h"
+#include "mail-search-multi.h"
 #include "doveadm-print.h"
 #include "doveadm-mailbox-list-iter.h"
 #include "doveadm-mail-iter.h"
@@ -9,6 +14,11 @@
 
 #include <stdio.h>
 
+struct search_cmd_context {
+	struct doveadm_mail_cmd_context ctx;
+	unsigned int concurrency;
+};
+
 static int
 cmd_search_box(struct doveadm_mail_cmd_context *ctx,
 	       const struct mailbox_info *info)
@@ -42,6 +52,32 @@ cmd_search_box(struct doveadm_mail_cmd_context *ctx,
 	return ret;
 }
 
+static int
+cmd_search_run_multi(struct doveadm_mail_cmd_context *ctx,
+		     struct mail_user *user,
+		     struct doveadm_mailbox_list_iter *iter)
+{
+	struct mail_search_multi_context *search_ctx;
+	const struct mail_search_multi_match *match;
+	const struct mailbox_info *info;
+	enum mail_error error;
+	int ret = 0;
+
+	search_ctx = mail_search_multi_init(user, ctx->search_args,
+					    MAILBOX_FLAG_IGNORE_ACLS);
+	while ((info = doveadm_mailbox_list_iter_next(iter)) != NULL)
+		mail_search_multi_add(search_ctx, info->ns, info->vname);
+	while (mail_search_multi_next(search_ctx, &match)) T_BEGIN {
+		doveadm_print(guid_128_to_string(match->guid));
+		doveadm_print(dec2str(match->uid));
+	} T_END;
+	if (mail_search_multi_deinit(&search_ctx, &error) < 0) {
+		doveadm_mail_failed_error(ctx, error);
+		ret = -1;
+	}
+	return ret;
+}
+
 static int
 cmd_search_run(struct doveadm_mail_cmd_context *ctx, struct mail_user *user)
 {
@@ -54,15 +90,60 @@ cmd_search_run(struct doveadm_mail_cmd_context *ctx, struct mail_user *user)
 
 	iter = doveadm_mailbox_list_iter_init(ctx, user, ctx->search_args,
 					      iter_flags);
-	while ((info = doveadm_mailbox_list_iter_next(iter)) != NULL) T_BEGIN {
-		if (cmd_search_box(ctx, info) < 0)
-			ret = -1;
-	} T_END;
+	if (mail_user_set_get_storage_set(user)->mail_search_concurrency > 1) {
+		/* search the mailboxes in separate processes */
+		ret = cmd_search_run_multi(ctx, user, iter);
+	} else {
+		while ((info = doveadm_mailbox_list_iter_next(iter)) != NULL) {
+			T_BEGIN {
+				if (cmd_search_box(ctx, info) < 0)
+					ret = -1;
+			} T_END;
+		}
+	}
 	if (doveadm_mailbox_list_iter_deinit(&iter) < 0)
 		ret = -1;
 	return ret;
 }
 
+static int
+cmd_search_prerun(struct doveadm_mail_cmd_context *_ctx,
+		  struct mail_storage_service_user *service_user,
+		  const char **error_r ATTR_UNUSED)
+{
+	struct search_cmd_context *ctx = (struct search_cmd_context *)_ctx;
+	struct setting_parser_context *set_parser;
+	const char *set_line;
+
+	if (ctx->concurrency == 0)
+		return 0;
+
+	set_parser = mail_storage_service_user_get_settings_parser(service_user);
+	set_line = t_strdup_printf("mail_search_concurrency=%u",
+				   ctx->concurrency);
+	if (settings_parse_line(set_parser, set_line) < 0)
+		i_unreached();
+	return 0;
+}
+
+static bool cmd_search_parse_arg(struct doveadm_mail_cmd_context *_ctx, int c)
+{
+	struct search_cmd_context *ctx = (struct search_cmd_context *)_ctx;
+
+	switch (c) {
+	case 'j':
+		if (str_to_uint(optarg, &ctx->concurrency) < 0 ||
+		    ctx->concurrency == 0) {
+			i_fatal_status(EX_USAGE,
+				"Invalid -j parameter number: %s", optarg);
+		}
+		break;
+	default:
+		return FALSE;
+	}
+	return TRUE;
+}
+
 static void cmd_search_init(struct doveadm_mail_cmd_context *ctx,
 			    const char *const args[])
 {
@@ -79,15 +160,18 @@ static void cmd_search_init(struct doveadm_mail_cmd_context *ctx,
 
 static struct doveadm_mail_cmd_context *cmd_search_alloc(void)
 {
-	struct doveadm_mail_cmd_context *ctx;
+	struct search_cmd_context *ctx;
 
-	ctx = doveadm_mail_cmd_alloc(struct doveadm_mail_cmd_context);
-	ctx->v.init = cmd_search_init;
-	ctx->v.run = cmd_search_run;
+	ctx = doveadm_mail_cmd_alloc(struct search_cmd_context);
+	ctx->ctx.getopt_args = "j:";
+	ctx->ctx.v.parse_arg = cmd_search_parse_arg;
+	ctx->ctx.v.init = cmd_search_init;
+	ctx->ctx.v.prerun = cmd_search_prerun;
+	ctx->ctx.v.run = cmd_search_run;
 	doveadm_print_init(DOVEADM_PRINT_TYPE_FLOW);
-	return ctx;
+	return &ctx->ctx;
 }
 
 struct doveadm_mail_cmd cmd_search = {
-	cmd_search_alloc, "search", "<search query>"
+	cmd_search_alloc, "search", "[-j <concurrency>] <search query>"
 };
@@ -5,10 +5,12 @@
 #include "lib-signals.h"
 #include "ioloop.h"
 #include "str.h"
+#include "strnum.h"
 #include "unichar.h"
 #include "module-dir.h"
 #include "wildcard-match.h"
 #include "master-service.h"
+#include "settings-parser.h"
 #include "mail-user.h"
 #include "mail-namespace.h"
 #include "mail-storage.h"
@@ -196,6 +198,11 @@ doveadm_mail_build_search_args(const char *const args[])
 	return sargs;
 }
 
+struct force_resync_cmd_context {
+	struct doveadm_mail_cmd_context ctx;
+	unsigned int concurrency;
+};
+
 static int cmd_force_resync_box(struct doveadm_mail_cmd_context *ctx,
 				const struct mailbox_info *info)
 {
@@ -247,6 +254,47 @@ static int cmd_force_resync_run(struct doveadm_mail_cmd_context *ctx,
 	return ret;
 }
 
+static int
+cmd_force_resync_prerun(struct doveadm_mail_cmd_context *_ctx,
+			struct mail_storage_service_user *service_user,
+			const char **error_r ATTR_UNUSED)
+{
+	struct force_resync_cmd_context *ctx =
+		(struct force_resync_cmd_context *)_ctx;
+	struct setting_parser_context *set_parser;
+	const char *set_line;
+
+	if (ctx->concurrency == 0)
+		return 0;
+
+	set_parser = mail_storage_service_user_get_settings_parser(service_user);
+	set_line = t_strdup_printf("mail_rebuild_concurrency=%u",
+				   ctx->concurrency);
+	if (settings_parse_line(set_parser, set_line) < 0)
+		i_unreached();
+	return 0;
+}
+
+static bool
+cmd_force_resync_parse_arg(struct doveadm_mail_cmd_context *_ctx, int c)
+{
+	struct force_resync_cmd_context *ctx =
+		(struct force_resync_cmd_context *)_ctx;
+
+	switch (c) {
+	case 'j':
+		if (str_to_uint(optarg, &ctx->concurrency) < 0 ||
+		    ctx->concurrency == 0) {
+			i_fatal_status(EX_USAGE,
+				"Invalid -j parameter number: %s", optarg);
+		}
+		break;
+	default:
+		return FALSE;
+	}
+	return TRUE;
+}
+
 static void
 cmd_force_resync_init(struct doveadm_mail_cmd_context *_ctx ATTR_UNUSED,
 		      const char *const args[])
@@ -257,12 +305,15 @@ cmd_force_resync_init(struct doveadm_mail_cmd_context *_ctx ATTR_UNUSED,
 
 static struct doveadm_mail_cmd_context *cmd_force_resync_alloc(void)
 {
-	struct doveadm_mail_cmd_context *ctx;
+	struct force_resync_cmd_context *ctx;
 
-	ctx = doveadm_mail_cmd_alloc(struct doveadm_mail_cmd_context);
-	ctx->v.init = cmd_force_resync_init;
-	ctx->v.run = cmd_force_resync_run;
-	return ctx;
+	ctx = doveadm_mail_cmd_alloc(struct force_resync_cmd_context);
+	ctx->ctx.getopt_args = "j:";
+	ctx->ctx.v.parse_arg = cmd_force_resync_parse_arg;
+	ctx->ctx.v.init = cmd_force_resync_init;
+	ctx->ctx.v.prerun = cmd_force_resync_prerun;
+	ctx->ctx.v.run = cmd_force_resync_run;
+	return &ctx->ctx;
 }
 
 static int
@@ -680,7 +731,8 @@ void doveadm_mail_help_name(const char *cmd_name)
 }
 
 static struct doveadm_mail_cmd cmd_force_resync = {
-	cmd_force_resync_alloc, "force-resync", "<mailbox mask>"
+	cmd_force_resync_alloc, "force-resync",
+	"[-j <concurrency>] <mailbox mask>"
 };
 static struct doveadm_mail_cmd cmd_purge = {
 	cmd_purge_alloc, "purge", NULL
@@ -0,0 +1,115 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "istream.h"
+#include "mem-profile.h"
+#include "doveadm.h"
+#include "doveadm-print.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+
+/* how long to wait for the process to write its profile */
+#define MEMPROFILE_WAIT_MSECS 5000
+#define MEMPROFILE_POLL_MSECS 10
+
+static int memprofile_request(const char *path, pid_t pid)
+{
+	unsigned int msecs;
+	int fd;
+
+	if (unlink(path) < 0 && errno != ENOENT)
+		i_fatal("unlink(%s) failed: %m", path);
+#ifdef MEM_PROFILE_DUMP_SIGNAL
+	if (kill(pid, MEM_PROFILE_DUMP_SIGNAL) < 0) {
+		i_error("kill(%s, %d) failed: %m", dec2str(pid),
+			MEM_PROFILE_DUMP_SIGNAL);
+		return -1;
+	}
+#else
+	i_fatal("Memory profiling isn't supported on this system");
+#endif
+	for (msecs = 0; msecs < MEMPROFILE_WAIT_MSECS;
+	     msecs += MEMPROFILE_POLL_MSECS) {
+		fd = open(path, O_RDONLY);
+		if (fd != -1)
+			return fd;
+		if (errno != ENOENT)
+			i_fatal("open(%s) failed: %m", path);
+		usleep(MEMPROFILE_POLL_MSECS*1000);
+	}
+	i_error("pid %s didn't write %s - "
+		"was it started with %s environment?", dec2str(pid), path,
+		MEM_PROFILE_ENV);
+	return -1;
+}
+
+static void memprofile_print(const char *path, int fd, pid_t pid,
+			     bool print_header)
+{
+	struct istream *input;
+	const char *line, *const *args;
+
+	input = i_stream_create_fd(fd, (size_t)-1, TRUE);
+	/* header */
+	if ((line = i_stream_read_next_line(input)) != NULL && print_header) {
+		doveadm_print_header_simple("pid");
+		for (args = t_strsplit_tab(line); *args != NULL; args++)
+			doveadm_print_header_simple(*args);
+	}
+	while ((line = i_stream_read_next_line(input)) != NULL) T_BEGIN {
+		doveadm_print(dec2str(pid));
+		for (args = t_strsplit_tab(line); *args != NULL; args++)
+			doveadm_print(*args);
+	} T_END;
+	if (input->stream_errno != 0)
+		i_error("read(%s) failed: %m", path);
+	i_stream_destroy(&input);
+}
+
+static void cmd_memprofile(int argc, char *argv[])
+{
+	const char *dir, *path;
+	bool header_printed = FALSE;
+	pid_t pid;
+	int c, fd;
+
+	dir = getenv(MEM_PROFILE_ENV);
+	if (dir == NULL) {
+		dir = t_strconcat(doveadm_settings->base_dir,
+				  "/memprofile", NULL);
+	}
+	while ((c = getopt(argc, argv, "d:")) > 0) {
+		switch (c) {
+		case 'd':
+			dir = optarg;
+			break;
+		default:
+			help(&doveadm_cmd_memprofile);
+		}
+	}
+	argv += optind - 1;
+	if (argv[1] == NULL)
+		help(&doveadm_cmd_memprofile);
+
+	doveadm_print_init(DOVEADM_PRINT_TYPE_TAB);
+	for (argv++; *argv != NULL; argv++) {
+		if (str_to_pid(*argv, &pid) < 0)
+			i_fatal("Invalid pid: %s", *argv);
+		path = t_strdup_printf("%s/%s", dir, dec2str(pid));
+		fd = memprofile_request(path, pid);
+		if (fd == -1) {
+			doveadm_exit_code = EX_TEMPFAIL;
+			continue;
+		}
+		memprofile_print(path, fd, pid, !header_printed);
+		header_printed = TRUE;
+	}
+}
+
+struct doveadm_cmd doveadm_cmd_memprofile = {
+	cmd_memprofile, "memprofile",
+	"[-d <profile dir>] <pid> [<pid> ...]"
+};
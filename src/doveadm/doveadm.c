@@ -296,6 +296,7 @@ static struct doveadm_cmd *doveadm_commands[] = {
 	&doveadm_cmd_who,
 	&doveadm_cmd_penalty,
 	&doveadm_cmd_kick,
+	&doveadm_cmd_memprofile,
 	&doveadm_cmd_mailbox_mutf7,
 	&doveadm_cmd_sis_deduplicate,
 	&doveadm_cmd_sis_find,
@@ -23,6 +23,11 @@
 #define ENVELOPE_NIL_REPLY \
 	"(NIL NIL NIL NIL NIL NIL NIL NIL NIL NIL)"
 
+/* When all the handlers are buffered, finished FETCH replies are collected
+   into cur_str until there's this much of them and then sent to the client
+   with a single write. */
+#define IMAP_FETCH_BATCH_SIZE (64*1024)
+
 static ARRAY(struct imap_fetch_handler) fetch_handlers;
 
 static int imap_fetch_handler_cmp(const struct imap_fetch_handler *h1,
@@ -381,6 +386,8 @@ void imap_fetch_begin(struct imap_fetch_context *ctx, struct mailbox *box,
 	ctx->state.cur_str = str_new(default_pool, 8192);
 	ctx->state.fetching = TRUE;
 	ctx->state.line_finished = TRUE;
+	ctx->state.batching = ctx->buffered_handlers_count ==
+		array_count(&ctx->handlers);
 
 	if (wanted_headers != NULL)
 		mailbox_header_lookup_unref(&wanted_headers);
@@ -429,6 +436,17 @@ static int imap_fetch_send_nil_reply(struct imap_fetch_context *ctx)
 	return 0;
 }
 
+static void imap_fetch_finish_batched_line(struct imap_fetch_context *ctx)
+{
+	string_t *str = ctx->state.cur_str;
+	size_t len = str_len(str);
+
+	/* drop the extra space after the last fetch item */
+	if (len > 0 && str_data(str)[len-1] == ' ')
+		str_truncate(str, len-1);
+	str_append(str, ")\r\n");
+}
+
 static int imap_fetch_more_int(struct imap_fetch_context *ctx, bool cancel)
 {
 	struct imap_fetch_state *state = &ctx->state;
@@ -474,7 +492,7 @@ static int imap_fetch_more_int(struct imap_fetch_context *ctx, bool cancel)
 
 		if (state->cur_mail == NULL) {
 			if (cancel)
-				return 1;
+				break;
 
 			if (!mailbox_search_next(state->search_ctx,
 						 &state->cur_mail))
@@ -527,21 +545,34 @@ static int imap_fetch_more_int(struct imap_fetch_context *ctx, bool cancel)
 				i_stream_unref(&state->cur_input);
 		}
 
-		if (str_len(state->cur_str) > 0) {
-			/* no non-buffered handlers */
-			if (imap_fetch_flush_buffer(ctx) < 0)
-				return -1;
+		if (state->batching) {
+			/* keep the reply in cur_str until the whole batch
+			   can be sent */
+			imap_fetch_finish_batched_line(ctx);
+			if (str_len(state->cur_str) >= IMAP_FETCH_BATCH_SIZE) {
+				if (imap_fetch_flush_buffer(ctx) < 0)
+					return -1;
+			}
+		} else {
+			if (str_len(state->cur_str) > 0) {
+				/* no non-buffered handlers */
+				if (imap_fetch_flush_buffer(ctx) < 0)
+					return -1;
+			}
+			o_stream_nsend(client->output, ")\r\n", 3);
 		}
 
 		state->line_finished = TRUE;
 		state->line_partial = FALSE;
-		o_stream_nsend(client->output, ")\r\n", 3);
 		client->last_output = ioloop_time;
 
 		state->cur_mail = NULL;
 		state->cur_handler = 0;
 	}
 
+	/* send the rest of the batched replies */
+	if (imap_fetch_flush_buffer(ctx) < 0)
+		return -1;
 	return 1;
 }
 
@@ -591,9 +622,10 @@ int imap_fetch_end(struct imap_fetch_context *ctx)
 
 	if (ctx->state.fetching) {
 		ctx->state.fetching = FALSE;
+		/* this also sends any replies that are still batched */
+		if (imap_fetch_flush_buffer(ctx) < 0)
+			state->failed = TRUE;
 		if (!state->line_finished) {
-			if (imap_fetch_flush_buffer(ctx) < 0)
-				state->failed = TRUE;
 			if (o_stream_send(ctx->client->output, ")\r\n", 3) < 0)
 				state->failed = TRUE;
 		}
@@ -645,17 +677,9 @@ static int fetch_body(struct imap_fetch_context *ctx, struct mail *mail,
 	if (mail_get_special(mail, MAIL_FETCH_IMAP_BODY, &body) < 0)
 		return -1;
 
-	if (ctx->state.cur_first)
-		ctx->state.cur_first = FALSE;
-	else {
-		if (o_stream_send(ctx->client->output, " ", 1) < 0)
-			return -1;
-	}
-
-	if (o_stream_send(ctx->client->output, "BODY (", 6) < 0 ||
-	    o_stream_send_str(ctx->client->output, body) < 0 ||
-	    o_stream_send(ctx->client->output, ")", 1) < 0)
-		return -1;
+	str_append(ctx->state.cur_str, "BODY (");
+	str_append(ctx->state.cur_str, body);
+	str_append(ctx->state.cur_str, ") ");
 	return 1;
 }
 
@@ -663,8 +687,8 @@ static bool fetch_body_init(struct imap_fetch_init_context *ctx)
 {
 	if (ctx->name[4] == '\0') {
 		ctx->fetch_ctx->fetch_data |= MAIL_FETCH_IMAP_BODY;
-		imap_fetch_add_handler(ctx, 0, "("BODY_NIL_REPLY")",
-				       fetch_body, NULL);
+		imap_fetch_add_handler(ctx, IMAP_FETCH_HANDLER_FLAG_BUFFERED,
+				       "("BODY_NIL_REPLY")", fetch_body, NULL);
 		return TRUE;
 	}
 	return imap_fetch_body_section_init(ctx);
@@ -679,25 +703,17 @@ static int fetch_bodystructure(struct imap_fetch_context *ctx,
 			     &bodystructure) < 0)
 		return -1;
 
-	if (ctx->state.cur_first)
-		ctx->state.cur_first = FALSE;
-	else {
-		if (o_stream_send(ctx->client->output, " ", 1) < 0)
-			return -1;
-	}
-
-	if (o_stream_send(ctx->client->output, "BODYSTRUCTURE (", 15) < 0 ||
-	    o_stream_send_str(ctx->client->output, bodystructure) < 0 ||
-	    o_stream_send(ctx->client->output, ")", 1) < 0)
-		return -1;
-
+	str_append(ctx->state.cur_str, "BODYSTRUCTURE (");
+	str_append(ctx->state.cur_str, bodystructure);
+	str_append(ctx->state.cur_str, ") ");
 	return 1;
 }
 
 static bool fetch_bodystructure_init(struct imap_fetch_init_context *ctx)
 {
 	ctx->fetch_ctx->fetch_data |= MAIL_FETCH_IMAP_BODYSTRUCTURE;
-	imap_fetch_add_handler(ctx, 0, "("BODY_NIL_REPLY" NIL NIL NIL NIL)",
+	imap_fetch_add_handler(ctx, IMAP_FETCH_HANDLER_FLAG_BUFFERED,
+			       "("BODY_NIL_REPLY" NIL NIL NIL NIL)",
 			       fetch_bodystructure, NULL);
 	return TRUE;
 }
@@ -710,25 +726,17 @@ static int fetch_envelope(struct imap_fetch_context *ctx, struct mail *mail,
 	if (mail_get_special(mail, MAIL_FETCH_IMAP_ENVELOPE, &envelope) < 0)
 		return -1;
 
-	if (ctx->state.cur_first)
-		ctx->state.cur_first = FALSE;
-	else {
-		if (o_stream_send(ctx->client->output, " ", 1) < 0)
-			return -1;
-	}
-
-	if (o_stream_send(ctx->client->output, "ENVELOPE (", 10) < 0 ||
-	    o_stream_send_str(ctx->client->output, envelope) < 0 ||
-	    o_stream_send(ctx->client->output, ")", 1) < 0)
-		return -1;
+	str_append(ctx->state.cur_str, "ENVELOPE (");
+	str_append(ctx->state.cur_str, envelope);
+	str_append(ctx->state.cur_str, ") ");
 	return 1;
 }
 
 static bool fetch_envelope_init(struct imap_fetch_init_context *ctx)
 {
 	ctx->fetch_ctx->fetch_data |= MAIL_FETCH_IMAP_ENVELOPE;
-	imap_fetch_add_handler(ctx, 0, ENVELOPE_NIL_REPLY,
-			       fetch_envelope, NULL);
+	imap_fetch_add_handler(ctx, IMAP_FETCH_HANDLER_FLAG_BUFFERED,
+			       ENVELOPE_NIL_REPLY, fetch_envelope, NULL);
 	return TRUE;
 }
 
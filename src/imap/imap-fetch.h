@@ -67,6 +67,8 @@ struct imap_fetch_state {
 	unsigned int line_finished:1;
 	unsigned int skipped_expunged_msgs:1;
 	unsigned int failed:1;
+	/* all handlers are buffered, so the replies are sent in batches */
+	unsigned int batching:1;
 };
 
 struct imap_fetch_context {
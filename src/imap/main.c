@@ -335,6 +335,11 @@ int main(int argc, char *argv[])
 		return 1;
 	}
 
+	/* the ioloop is created before settings are read, so this can't be
+	   a setting. the timing wheel may call timeouts expiring within the
+	   same millisecond in a different order, so use it only if asked. */
+	if (getenv("IMAP_TIMING_WHEEL") != NULL)
+		service_flags |= MASTER_SERVICE_FLAG_TIMING_WHEEL;
 	if (IS_STANDALONE()) {
 		service_flags |= MASTER_SERVICE_FLAG_STANDALONE |
 			MASTER_SERVICE_FLAG_STD_CLIENT;
@@ -90,28 +90,33 @@ void imap_append_nstring(string_t *dest, const char *src)
 
 void imap_append_quoted(string_t *dest, const char *src)
 {
+	size_t i, start = 0;
+
 	str_append_c(dest, '"');
-	for (; *src != '\0'; src++) {
-		switch (*src) {
+	for (i = 0; src[i] != '\0'; i++) {
+		switch (src[i]) {
 		case 13:
 		case 10:
 			/* not allowed */
+			buffer_append(dest, src + start, i - start);
+			start = i + 1;
 			break;
 		case '"':
 		case '\\':
+			buffer_append(dest, src + start, i - start);
 			str_append_c(dest, '\\');
-			str_append_c(dest, *src);
+			start = i;
 			break;
 		default:
-			if ((unsigned char)*src >= 0x80) {
+			if ((unsigned char)src[i] >= 0x80) {
 				/* 8bit input not allowed in dquotes */
-				break;
+				buffer_append(dest, src + start, i - start);
+				start = i + 1;
 			}
-
-			str_append_c(dest, *src);
 			break;
 		}
 	}
+	buffer_append(dest, src + start, i - start);
 	str_append_c(dest, '"');
 }
 
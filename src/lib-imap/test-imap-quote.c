@@ -37,9 +37,38 @@ static void test_imap_append_string_for_humans(void)
 	test_end();
 }
 
+static void test_imap_append_quoted(void)
+{
+	static struct {
+		const char *input, *output;
+	} tests[] = {
+		{ "", "\"\"" },
+		{ "foo", "\"foo\"" },
+		{ "\"", "\"\\\"\"" },
+		{ "foo\\bar", "\"foo\\\\bar\"" },
+		{ "\"foo\"", "\"\\\"foo\\\"\"" },
+		{ "foo\r\nbar", "\"foobar\"" },
+		{ "\r\n", "\"\"" },
+		{ "f\xc3\xb6\xc3\xb6", "\"f\"" },
+		{ "\x80" "foo\x80", "\"foo\"" }
+	};
+	string_t *str = t_str_new(128);
+	unsigned int i;
+
+	test_begin("imap_append_quoted()");
+
+	for (i = 0; i < N_ELEMENTS(tests); i++) {
+		str_truncate(str, 0);
+		imap_append_quoted(str, tests[i].input);
+		test_assert(strcmp(tests[i].output, str_c(str)) == 0);
+	}
+	test_end();
+}
+
 int main(void)
 {
 	static void (*test_functions[])(void) = {
+		test_imap_append_quoted,
 		test_imap_append_string_for_humans,
 		NULL
 	};
@@ -0,0 +1,184 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "ioloop.h"
+#include "hostpid.h"
+#include "strnum.h"
+#include "time-util.h"
+#include "mail-index.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+/* Measure how long it takes to sync an expunge to a large index while other
+   views still reference the older maps, and how much memory those maps
+   use. Usage: bench-mail-index-sync [messages [iterations]] */
+
+#define DEFAULT_MESSAGES_COUNT 500000
+#define DEFAULT_ITERATIONS 100
+/* number of old views kept open, like other processes would */
+#define OPEN_VIEWS_COUNT 4
+
+enum bench_expunge_pos {
+	BENCH_EXPUNGE_LAST,
+	BENCH_EXPUNGE_RANDOM,
+	BENCH_EXPUNGE_FIRST
+};
+
+static const char *bench_expunge_pos_names[] = {
+	"expunge-last", "expunge-random", "expunge-first"
+};
+
+static unsigned long get_rss_kb(void)
+{
+	FILE *f;
+	unsigned long size, resident;
+
+	f = fopen("/proc/self/statm", "r");
+	if (f == NULL)
+		return 0;
+	if (fscanf(f, "%lu %lu", &size, &resident) != 2)
+		resident = 0;
+	fclose(f);
+	return resident * (getpagesize() / 1024);
+}
+
+static void bench_sync(struct mail_index *index, uint32_t expunge_seq)
+{
+	struct mail_index_sync_ctx *ctx;
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	struct mail_index_sync_rec sync_rec;
+
+	if (mail_index_sync_begin(index, &ctx, &view, &trans, 0) < 0)
+		i_fatal("mail_index_sync_begin() failed: %s",
+			mail_index_get_error_message(index));
+	if (expunge_seq != 0)
+		mail_index_expunge(trans, expunge_seq);
+	while (mail_index_sync_next(ctx, &sync_rec)) ;
+	if (mail_index_sync_commit(&ctx) < 0)
+		i_fatal("mail_index_sync_commit() failed: %s",
+			mail_index_get_error_message(index));
+}
+
+static void bench_append(struct mail_index *index, unsigned int count)
+{
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	uint32_t i, seq, next_uid, uid_validity = ioloop_time;
+
+	view = mail_index_view_open(index);
+	next_uid = mail_index_get_header(view)->next_uid;
+	trans = mail_index_transaction_begin(view, 0);
+	mail_index_update_header(trans,
+		offsetof(struct mail_index_header, uid_validity),
+		&uid_validity, sizeof(uid_validity), TRUE);
+	for (i = 0; i < count; i++)
+		mail_index_append(trans, next_uid + i, &seq);
+	if (mail_index_transaction_commit(&trans) < 0)
+		i_fatal("mail_index_transaction_commit() failed: %s",
+			mail_index_get_error_message(index));
+	mail_index_view_close(&view);
+	bench_sync(index, 0);
+}
+
+static void
+bench_expunges(struct mail_index *index, enum bench_expunge_pos pos,
+	       unsigned int iterations)
+{
+	struct mail_index_view *views[OPEN_VIEWS_COUNT], **view;
+	struct timeval tv_start, tv_end;
+	unsigned long long usecs, total_usecs = 0, max_usecs = 0;
+	unsigned long rss, max_rss = 0;
+	uint32_t seq, count;
+	unsigned int i;
+
+	memset(views, 0, sizeof(views));
+	for (i = 0; i < iterations; i++) {
+		view = &views[i % OPEN_VIEWS_COUNT];
+		if (*view != NULL)
+			mail_index_view_close(view);
+		*view = mail_index_view_open(index);
+
+		count = mail_index_view_get_messages_count(*view);
+		switch (pos) {
+		case BENCH_EXPUNGE_LAST:
+			seq = count;
+			break;
+		case BENCH_EXPUNGE_RANDOM:
+			seq = rand() % count + 1;
+			break;
+		case BENCH_EXPUNGE_FIRST:
+		default:
+			seq = 1;
+			break;
+		}
+
+		if (gettimeofday(&tv_start, NULL) < 0)
+			i_fatal("gettimeofday() failed: %m");
+		bench_sync(index, seq);
+		if (gettimeofday(&tv_end, NULL) < 0)
+			i_fatal("gettimeofday() failed: %m");
+
+		usecs = timeval_diff_usecs(&tv_end, &tv_start);
+		total_usecs += usecs;
+		if (max_usecs < usecs)
+			max_usecs = usecs;
+		rss = get_rss_kb();
+		if (max_rss < rss)
+			max_rss = rss;
+	}
+	for (i = 0; i < OPEN_VIEWS_COUNT; i++) {
+		if (views[i] != NULL)
+			mail_index_view_close(&views[i]);
+	}
+	printf("%s\t%u\t%llu\t%llu\t%lu\n", bench_expunge_pos_names[pos],
+	       iterations, total_usecs / iterations, max_usecs, max_rss);
+}
+
+int main(int argc, char *argv[])
+{
+	struct ioloop *ioloop;
+	struct mail_index *index;
+	char *dir;
+	unsigned int messages_count = DEFAULT_MESSAGES_COUNT;
+	unsigned int iterations = DEFAULT_ITERATIONS;
+
+	lib_init();
+	if (argc > 1 && str_to_uint(argv[1], &messages_count) < 0)
+		i_fatal("Invalid messages count: %s", argv[1]);
+	if (argc > 2 && str_to_uint(argv[2], &iterations) < 0)
+		i_fatal("Invalid iterations: %s", argv[2]);
+	if (iterations == 0 || messages_count <= iterations * 3)
+		i_fatal("Need more messages than 3*iterations");
+
+	/* index ID is taken from ioloop_time */
+	ioloop = io_loop_create();
+	dir = t_strdup_noconst(t_strdup_printf(
+		"/tmp/bench-mail-index-sync.%s.XXXXXX", my_pid));
+	if (mkdtemp(dir) == NULL)
+		i_fatal("mkdtemp(%s) failed: %m", dir);
+
+	index = mail_index_alloc(dir, "dovecot.index");
+	if (mail_index_open_or_create(index, MAIL_INDEX_OPEN_FLAG_CREATE) < 0)
+		i_fatal("mail_index_open_or_create() failed: %s",
+			mail_index_get_error_message(index));
+	bench_append(index, messages_count);
+
+	printf("test\titerations\tavg_usecs\tmax_usecs\tmax_rss_kb\n");
+	printf("initial\t0\t0\t0\t%lu\n", get_rss_kb());
+	bench_expunges(index, BENCH_EXPUNGE_LAST, iterations);
+	bench_expunges(index, BENCH_EXPUNGE_RANDOM, iterations);
+	bench_expunges(index, BENCH_EXPUNGE_FIRST, iterations);
+
+	(void)mail_index_unlink(index);
+	mail_index_close(index);
+	mail_index_free(&index);
+	if (rmdir(dir) < 0)
+		i_error("rmdir(%s) failed: %m", dir);
+	io_loop_destroy(&ioloop);
+	lib_deinit();
+	return 0;
+}
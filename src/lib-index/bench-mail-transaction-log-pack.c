@@ -0,0 +1,231 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "ioloop.h"
+#include "hostpid.h"
+#include "strnum.h"
+#include "time-util.h"
+#include "mail-index-private.h"
+#include "mail-transaction-log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+/* Compare the transaction log size and the time it takes to read it with
+   and without MAIL_INDEX_OPEN_FLAG_LOG_PACKED. The same flag, keyword,
+   extension record and expunge changes are written in both cases.
+   Usage: bench-mail-transaction-log-pack [messages [transactions]] */
+
+#define DEFAULT_MESSAGES_COUNT 100000
+#define DEFAULT_TRANSACTIONS_COUNT 10000
+/* how many messages each transaction changes at most */
+#define MAX_CHANGED_MESSAGES 20
+#define BENCH_SEED 1
+
+static void bench_index_fail(struct mail_index *index, const char *func)
+{
+	i_fatal("%s() failed: %s", func, mail_index_get_error_message(index));
+}
+
+static void bench_sync(struct mail_index *index)
+{
+	struct mail_index_sync_ctx *ctx;
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	struct mail_index_sync_rec sync_rec;
+
+	if (mail_index_sync_begin(index, &ctx, &view, &trans, 0) < 0)
+		bench_index_fail(index, "mail_index_sync_begin");
+	while (mail_index_sync_next(ctx, &sync_rec)) ;
+	if (mail_index_sync_commit(&ctx) < 0)
+		bench_index_fail(index, "mail_index_sync_commit");
+}
+
+static void bench_append(struct mail_index *index, unsigned int count)
+{
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	uint32_t i, seq, uid_validity = ioloop_time;
+
+	view = mail_index_view_open(index);
+	trans = mail_index_transaction_begin(view, 0);
+	mail_index_update_header(trans,
+		offsetof(struct mail_index_header, uid_validity),
+		&uid_validity, sizeof(uid_validity), TRUE);
+	for (i = 0; i < count; i++)
+		mail_index_append(trans, i + 1, &seq);
+	if (mail_index_transaction_commit(&trans) < 0)
+		bench_index_fail(index, "mail_index_transaction_commit");
+	mail_index_view_close(&view);
+	bench_sync(index);
+}
+
+static void bench_changes(struct mail_index *index, unsigned int count)
+{
+	static const char *keyword_names[] = { "$Forwarded", NULL };
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	struct mail_keywords *keywords;
+	uint32_t ext_id, seq, seq1, seq2, messages_count, value;
+	unsigned int i, j;
+
+	ext_id = mail_index_ext_register(index, "bench", 0,
+					 sizeof(uint32_t), sizeof(uint32_t));
+	keywords = mail_index_keywords_create(index, keyword_names);
+	for (i = 0; i < count; i++) {
+		view = mail_index_view_open(index);
+		messages_count = mail_index_view_get_messages_count(view);
+		trans = mail_index_transaction_begin(view, 0);
+
+		/* STORE to a range of messages */
+		seq1 = rand() % messages_count + 1;
+		seq2 = seq1 + rand() % MAX_CHANGED_MESSAGES;
+		if (seq2 > messages_count)
+			seq2 = messages_count;
+		mail_index_update_flags_range(trans, seq1, seq2,
+			(i % 2) == 0 ? MODIFY_ADD : MODIFY_REMOVE, MAIL_SEEN);
+		/* STORE to separate messages */
+		for (j = rand() % MAX_CHANGED_MESSAGES; j > 0; j--) {
+			seq = rand() % messages_count + 1;
+			mail_index_update_flags(trans, seq, MODIFY_ADD,
+						MAIL_FLAGGED);
+			mail_index_update_keywords(trans, seq, MODIFY_ADD,
+						   keywords);
+		}
+		/* cache offset -like extension record updates */
+		for (j = rand() % MAX_CHANGED_MESSAGES; j > 0; j--) {
+			seq = rand() % messages_count + 1;
+			value = rand();
+			mail_index_update_ext(trans, seq, ext_id, &value, NULL);
+		}
+		if (i % 10 == 0)
+			mail_index_expunge(trans, rand() % messages_count + 1);
+
+		if (mail_index_transaction_commit(&trans) < 0)
+			bench_index_fail(index, "mail_index_transaction_commit");
+		mail_index_view_close(&view);
+	}
+	mail_index_keywords_unref(&keywords);
+}
+
+static uoff_t bench_get_log_size(const char *dir)
+{
+	const char *suffixes[] = { ".log", ".log.2" };
+	struct stat st;
+	uoff_t size = 0;
+	unsigned int i;
+
+	for (i = 0; i < N_ELEMENTS(suffixes); i++) {
+		const char *path = t_strconcat(dir, "/dovecot.index",
+					       suffixes[i], NULL);
+		if (stat(path, &st) == 0)
+			size += st.st_size;
+		else if (errno != ENOENT)
+			i_fatal("stat(%s) failed: %m", path);
+	}
+	return size;
+}
+
+static unsigned long long
+bench_scan_log(struct mail_index *index, unsigned int *records_r)
+{
+	struct mail_transaction_log_view *log_view;
+	const struct mail_transaction_header *hdr;
+	const void *data;
+	struct timeval tv_start, tv_end;
+	int ret;
+
+	if (gettimeofday(&tv_start, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	log_view = mail_transaction_log_view_open(index->log);
+	if (mail_transaction_log_view_set_all(log_view) < 0)
+		bench_index_fail(index, "mail_transaction_log_view_set_all");
+	*records_r = 0;
+	while ((ret = mail_transaction_log_view_next(log_view, &hdr,
+						     &data)) > 0)
+		(*records_r)++;
+	if (ret < 0)
+		bench_index_fail(index, "mail_transaction_log_view_next");
+	mail_transaction_log_view_close(&log_view);
+	if (gettimeofday(&tv_end, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	return timeval_diff_usecs(&tv_end, &tv_start);
+}
+
+static void
+bench_log(const char *name, enum mail_index_open_flags flags,
+	  unsigned int messages_count, unsigned int transactions_count)
+{
+	struct mail_index *index;
+	struct timeval tv_start, tv_end;
+	unsigned long long open_usecs, scan_usecs;
+	uoff_t initial_size, changes_size;
+	unsigned int records;
+	char *dir;
+
+	dir = t_strdup_noconst(t_strdup_printf(
+		"/tmp/bench-mail-transaction-log-pack.%s.XXXXXX", my_pid));
+	if (mkdtemp(dir) == NULL)
+		i_fatal("mkdtemp(%s) failed: %m", dir);
+
+	index = mail_index_alloc(dir, "dovecot.index");
+	if (mail_index_open_or_create(index, flags |
+				      MAIL_INDEX_OPEN_FLAG_CREATE) < 0)
+		bench_index_fail(index, "mail_index_open_or_create");
+	bench_append(index, messages_count);
+	initial_size = bench_get_log_size(dir);
+
+	srand(BENCH_SEED);
+	bench_changes(index, transactions_count);
+	changes_size = bench_get_log_size(dir) - initial_size;
+	mail_index_close(index);
+	mail_index_free(&index);
+
+	/* opening the index replays the changes from the log */
+	if (gettimeofday(&tv_start, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	index = mail_index_alloc(dir, "dovecot.index");
+	if (mail_index_open(index, flags) <= 0)
+		bench_index_fail(index, "mail_index_open");
+	if (gettimeofday(&tv_end, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	open_usecs = timeval_diff_usecs(&tv_end, &tv_start);
+
+	scan_usecs = bench_scan_log(index, &records);
+	printf("%s\t%u\t%llu\t%llu\t%llu\n", name, records,
+	       (unsigned long long)changes_size, open_usecs, scan_usecs);
+
+	(void)mail_index_unlink(index);
+	mail_index_close(index);
+	mail_index_free(&index);
+	if (rmdir(dir) < 0)
+		i_error("rmdir(%s) failed: %m", dir);
+}
+
+int main(int argc, char *argv[])
+{
+	struct ioloop *ioloop;
+	unsigned int messages_count = DEFAULT_MESSAGES_COUNT;
+	unsigned int transactions_count = DEFAULT_TRANSACTIONS_COUNT;
+
+	lib_init();
+	if (argc > 1 && str_to_uint(argv[1], &messages_count) < 0)
+		i_fatal("Invalid messages count: %s", argv[1]);
+	if (argc > 2 && str_to_uint(argv[2], &transactions_count) < 0)
+		i_fatal("Invalid transactions count: %s", argv[2]);
+	if (messages_count == 0)
+		i_fatal("Need at least one message");
+
+	/* index ID is taken from ioloop_time */
+	ioloop = io_loop_create();
+	printf("format\trecords\tchanges_bytes\topen_usecs\tscan_usecs\n");
+	bench_log("plain", 0, messages_count, transactions_count);
+	bench_log("packed", MAIL_INDEX_OPEN_FLAG_LOG_PACKED,
+		  messages_count, transactions_count);
+	io_loop_destroy(&ioloop);
+	lib_deinit();
+	return 0;
+}
@@ -0,0 +1,227 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "buffer.h"
+#include "mail-cache-private.h"
+
+void mail_cache_columns_free(struct mail_cache *cache)
+{
+	i_free_and_null(cache->columns);
+	cache->columns_count = 0;
+	cache->columns_messages_count = 0;
+	cache->columns_uids_offset = 0;
+	cache->columns_file_seq = 0;
+}
+
+static bool
+mail_cache_column_area_is_valid(uoff_t offset, uoff_t size,
+				uoff_t start, uoff_t end)
+{
+	return offset >= start && offset <= end && size <= end - offset &&
+		offset % sizeof(uint32_t) == 0;
+}
+
+static int
+mail_cache_columns_parse(struct mail_cache *cache,
+			 const struct mail_cache_column_header *col_hdr,
+			 uoff_t start, uoff_t end)
+{
+	const struct mail_cache_column_field *fields;
+	struct mail_cache_column *col;
+	struct mail_cache_field *field;
+	unsigned int i, count = col_hdr->messages_count;
+	uoff_t bitmap_size;
+
+	fields = CONST_PTR_OFFSET(col_hdr, sizeof(*col_hdr));
+	if (!mail_cache_column_area_is_valid(col_hdr->uids_offset,
+					     (uoff_t)count * sizeof(uint32_t),
+					     start, end)) {
+		mail_cache_set_corrupted(cache, "columns: invalid uids offset");
+		return -1;
+	}
+
+	bitmap_size = (count + 7) / 8;
+	cache->columns = col_hdr->columns_count == 0 ? NULL :
+		i_new(struct mail_cache_column, col_hdr->columns_count);
+	for (i = 0; i < col_hdr->columns_count; i++) {
+		if (fields[i].file_field_idx >= cache->file_fields_count) {
+			mail_cache_set_corrupted(cache,
+				"columns: field index too large (%u >= %u)",
+				fields[i].file_field_idx,
+				cache->file_fields_count);
+			return -1;
+		}
+		col = &cache->columns[i];
+		col->field_idx = cache->file_field_map[fields[i].file_field_idx];
+		field = &cache->fields[col->field_idx].field;
+		if (field->field_size != fields[i].field_size ||
+		    field->field_size == 0 || field->field_size == UINT_MAX ||
+		    field->type == MAIL_CACHE_FIELD_BITMASK) {
+			mail_cache_set_corrupted(cache,
+				"columns: invalid field %s", field->name);
+			return -1;
+		}
+		if (!mail_cache_column_area_is_valid(fields[i].bitmap_offset,
+						     bitmap_size, start, end) ||
+		    !mail_cache_column_area_is_valid(fields[i].data_offset,
+				(uoff_t)count * fields[i].field_size,
+				start, end)) {
+			mail_cache_set_corrupted(cache,
+				"columns: field %s points outside section",
+				field->name);
+			return -1;
+		}
+		col->field_size = fields[i].field_size;
+		col->bitmap_offset = fields[i].bitmap_offset;
+		col->data_offset = fields[i].data_offset;
+	}
+	cache->columns_count = col_hdr->columns_count;
+	cache->columns_messages_count = count;
+	cache->columns_uids_offset = col_hdr->uids_offset;
+	return 0;
+}
+
+int mail_cache_columns_read(struct mail_cache *cache)
+{
+	const struct mail_cache_column_header *col_hdr;
+	const void *data;
+	uoff_t start, end, fixed_size;
+	uint32_t file_seq;
+	int ret;
+
+	if (MAIL_CACHE_IS_UNUSABLE(cache) ||
+	    cache->hdr->file_seq == cache->columns_file_seq)
+		return 0;
+
+	file_seq = cache->hdr->file_seq;
+	mail_cache_columns_free(cache);
+	if (cache->hdr->minor_version < 2 || cache->map_with_read) {
+		/* no columns / we can't keep the section in memory */
+		cache->columns_file_seq = file_seq;
+		return 0;
+	}
+
+	start = sizeof(struct mail_cache_header);
+	end = mail_index_offset_to_uint32(cache->hdr->field_header_offset);
+	if (end < start + sizeof(*col_hdr)) {
+		mail_cache_set_corrupted(cache, "columns: section missing");
+		return -1;
+	}
+	if (mail_cache_map(cache, start, sizeof(*col_hdr), &data) <= 0)
+		return -1;
+	col_hdr = data;
+
+	fixed_size = sizeof(*col_hdr) + (uoff_t)col_hdr->columns_count *
+		sizeof(struct mail_cache_column_field);
+	if (col_hdr->size < fixed_size || col_hdr->size > end - start) {
+		mail_cache_set_corrupted(cache, "columns: invalid size");
+		return -1;
+	}
+	end = start + col_hdr->size;
+	if (mail_cache_map(cache, start, fixed_size, &data) <= 0)
+		return -1;
+
+	ret = mail_cache_columns_parse(cache, data, start, end);
+	if (ret < 0) {
+		mail_cache_columns_free(cache);
+		return -1;
+	}
+	cache->columns_file_seq = file_seq;
+	return 0;
+}
+
+static const struct mail_cache_column *
+mail_cache_column_find(struct mail_cache *cache, unsigned int field_idx)
+{
+	unsigned int i;
+
+	for (i = 0; i < cache->columns_count; i++) {
+		if (cache->columns[i].field_idx == field_idx)
+			return &cache->columns[i];
+	}
+	return NULL;
+}
+
+static int
+mail_cache_columns_find_uid(struct mail_cache_view *view, uint32_t uid,
+			    uint32_t *pos_r)
+{
+	struct mail_cache *cache = view->cache;
+	const uint32_t *uids;
+	const void *data;
+	unsigned int idx, left_idx, right_idx, count;
+
+	count = cache->columns_messages_count;
+	if (mail_cache_map(cache, cache->columns_uids_offset,
+			   count * sizeof(uint32_t), &data) <= 0)
+		return -1;
+	uids = data;
+
+	/* the messages are usually accessed in sequence order */
+	idx = view->column_pos_hint;
+	if (idx < count && uids[idx] == uid) {
+		*pos_r = idx;
+		return 1;
+	}
+	if (++idx < count && uids[idx] == uid) {
+		*pos_r = view->column_pos_hint = idx;
+		return 1;
+	}
+
+	left_idx = 0; right_idx = count;
+	while (left_idx < right_idx) {
+		idx = (left_idx + right_idx) / 2;
+		if (uids[idx] < uid)
+			left_idx = idx + 1;
+		else if (uids[idx] > uid)
+			right_idx = idx;
+		else {
+			*pos_r = view->column_pos_hint = idx;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int mail_cache_columns_lookup(struct mail_cache_view *view, uint32_t seq,
+			      unsigned int field_idx, buffer_t *dest_buf)
+{
+	struct mail_cache *cache = view->cache;
+	const struct mail_cache_column *col;
+	const unsigned char *bitmap;
+	const void *data;
+	uint32_t uid, pos, reset_id;
+	int ret;
+
+	if (cache->columns_count == 0 || cache->columns_messages_count == 0 ||
+	    MAIL_CACHE_IS_UNUSABLE(cache) || cache->map_with_read ||
+	    cache->columns_file_seq != cache->hdr->file_seq)
+		return 0;
+	if ((col = mail_cache_column_find(cache, field_idx)) == NULL)
+		return 0;
+
+	/* the message's cache offset must point to the same file, otherwise
+	   the message was added after compression or the file has changed */
+	if (mail_cache_lookup_cur_offset(view->view, seq, &reset_id) == 0 ||
+	    reset_id != cache->columns_file_seq)
+		return 0;
+
+	mail_index_lookup_uid(view->view, seq, &uid);
+	if ((ret = mail_cache_columns_find_uid(view, uid, &pos)) <= 0)
+		return ret;
+
+	if (mail_cache_map(cache, col->bitmap_offset + pos/8, 1, &data) <= 0)
+		return -1;
+	bitmap = data;
+	if ((*bitmap & (1 << (pos%8))) == 0)
+		return 0;
+
+	if (dest_buf != NULL) {
+		if (mail_cache_map(cache, col->data_offset +
+				   pos * col->field_size,
+				   col->field_size, &data) <= 0)
+			return -1;
+		buffer_append(dest_buf, data, col->field_size);
+	}
+	return 1;
+}
@@ -8,9 +8,11 @@
 #include "file-dotlock.h"
 #include "file-cache.h"
 #include "file-set-size.h"
+#include "time-util.h"
 #include "mail-cache-private.h"
 
 #include <sys/stat.h>
+#include <sys/time.h>
 
 struct mail_cache_copy_context {
 	struct mail_cache *cache;
@@ -19,10 +21,165 @@ struct mail_cache_copy_context {
 	ARRAY(unsigned int) bitmask_pos;
 	uint32_t *field_file_map;
 
+	/* columns section, written after the header */
+	buffer_t *columns_buf;
+	/* field_idx -> column index + 1, or 0 if field isn't a column */
+	unsigned int *field_column_map;
+	unsigned int columns_count;
+	uint32_t columns_uids_offset, column_pos;
+
 	uint8_t field_seen_value;
 	bool new_msg;
 };
 
+static struct mail_cache_column_field *
+mail_cache_copy_column(struct mail_cache_copy_context *ctx, unsigned int idx)
+{
+	return buffer_get_space_unsafe(ctx->columns_buf,
+		sizeof(struct mail_cache_column_header) +
+		idx * sizeof(struct mail_cache_column_field),
+		sizeof(struct mail_cache_column_field));
+}
+
+static bool
+mail_cache_compress_want_column(struct mail_cache_copy_context *ctx,
+				unsigned int field_idx)
+{
+	const struct mail_cache_field *field =
+		&ctx->cache->fields[field_idx].field;
+
+	return ctx->field_file_map[field_idx] != (uint32_t)-1 &&
+		field->type != MAIL_CACHE_FIELD_BITMASK &&
+		field->field_size != 0 && field->field_size != UINT_MAX &&
+		(field->decision & ~MAIL_CACHE_DECISION_FORCED) ==
+		MAIL_CACHE_DECISION_YES;
+}
+
+static void
+mail_cache_compress_init_columns(struct mail_cache_copy_context *ctx,
+				 unsigned int messages_count)
+{
+	struct mail_cache *cache = ctx->cache;
+	struct mail_cache_column_header col_hdr;
+	struct mail_cache_column_field *col;
+	unsigned int i, count = 0;
+	uoff_t offset;
+
+	ctx->field_column_map = t_new(unsigned int, cache->fields_count + 1);
+	for (i = 0; i < cache->fields_count; i++) {
+		if (mail_cache_compress_want_column(ctx, i))
+			ctx->field_column_map[i] = ++count;
+	}
+
+	memset(&col_hdr, 0, sizeof(col_hdr));
+	col_hdr.messages_count = messages_count;
+	offset = sizeof(struct mail_cache_header) + sizeof(col_hdr) +
+		count * sizeof(struct mail_cache_column_field);
+	col_hdr.uids_offset = offset;
+	offset += messages_count * sizeof(uint32_t);
+	for (i = 0; i < cache->fields_count; i++) {
+		unsigned int size = cache->fields[i].field.field_size;
+
+		if (ctx->field_column_map[i] == 0)
+			continue;
+		offset += MAIL_CACHE_COLUMN_ALIGN((messages_count + 7) / 8);
+		offset += MAIL_CACHE_COLUMN_ALIGN((uoff_t)messages_count * size);
+	}
+	if (count == 0 || offset > MAIL_CACHE_COLUMNS_MAX_SIZE) {
+		/* write only the header if there are no columns. don't
+		   bother with huge sections either. */
+		memset(ctx->field_column_map, 0,
+		       sizeof(unsigned int) * (cache->fields_count + 1));
+		count = messages_count = 0;
+		offset = col_hdr.uids_offset = sizeof(struct mail_cache_header) +
+			sizeof(col_hdr);
+		col_hdr.messages_count = 0;
+	}
+	col_hdr.columns_count = count;
+	col_hdr.size = offset - sizeof(struct mail_cache_header);
+
+	ctx->columns_count = count;
+	ctx->columns_uids_offset = col_hdr.uids_offset;
+	ctx->columns_buf = buffer_create_dynamic(default_pool, col_hdr.size);
+	buffer_append(ctx->columns_buf, &col_hdr, sizeof(col_hdr));
+	buffer_write_zero(ctx->columns_buf, sizeof(col_hdr),
+			  col_hdr.size - sizeof(col_hdr));
+
+	offset = col_hdr.uids_offset + messages_count * sizeof(uint32_t);
+	for (i = 0; i < cache->fields_count; i++) {
+		unsigned int size = cache->fields[i].field.field_size;
+
+		if (ctx->field_column_map[i] == 0)
+			continue;
+		col = mail_cache_copy_column(ctx, ctx->field_column_map[i] - 1);
+		col->file_field_idx = ctx->field_file_map[i];
+		col->field_size = size;
+		col->bitmap_offset = offset;
+		offset += MAIL_CACHE_COLUMN_ALIGN((messages_count + 7) / 8);
+		col->data_offset = offset;
+		offset += MAIL_CACHE_COLUMN_ALIGN(messages_count * size);
+	}
+}
+
+static void *
+mail_cache_copy_column_get_space(struct mail_cache_copy_context *ctx,
+				 uint32_t offset, size_t size)
+{
+	return buffer_get_space_unsafe(ctx->columns_buf,
+		offset - sizeof(struct mail_cache_header), size);
+}
+
+static void
+mail_cache_compress_column_uid(struct mail_cache_copy_context *ctx,
+			       uint32_t uid)
+{
+	void *data;
+
+	data = mail_cache_copy_column_get_space(ctx, ctx->columns_uids_offset +
+				ctx->column_pos * sizeof(uint32_t),
+				sizeof(uint32_t));
+	memcpy(data, &uid, sizeof(uid));
+}
+
+static void
+mail_cache_compress_column(struct mail_cache_copy_context *ctx,
+			   const struct mail_cache_iterate_field *field)
+{
+	const struct mail_cache_column_field *col;
+	uint32_t pos = ctx->column_pos;
+	unsigned char *bitmap;
+	void *data;
+
+	col = mail_cache_copy_column(ctx,
+		ctx->field_column_map[field->field_idx] - 1);
+	if (field->size != col->field_size)
+		return;
+
+	bitmap = mail_cache_copy_column_get_space(ctx,
+				col->bitmap_offset + pos/8, 1);
+	*bitmap |= 1 << (pos%8);
+	data = mail_cache_copy_column_get_space(ctx,
+				col->data_offset + pos * col->field_size,
+				col->field_size);
+	memcpy(data, field->data, field->size);
+}
+
+static void
+mail_cache_compress_column_drop(struct mail_cache_copy_context *ctx)
+{
+	const struct mail_cache_column_field *col;
+	uint32_t pos = ctx->column_pos;
+	unsigned char *bitmap;
+	unsigned int i;
+
+	for (i = 0; i < ctx->columns_count; i++) {
+		col = mail_cache_copy_column(ctx, i);
+		bitmap = mail_cache_copy_column_get_space(ctx,
+					col->bitmap_offset + pos/8, 1);
+		*bitmap &= ~(1 << (pos%8));
+	}
+}
+
 static void
 mail_cache_merge_bitmask(struct mail_cache_copy_context *ctx,
 			 const struct mail_cache_iterate_field *field)
@@ -91,6 +248,9 @@ mail_cache_compress_field(struct mail_cache_copy_context *ctx,
 	buffer_append(ctx->buffer, field->data, field->size);
 	if ((field->size & 3) != 0)
 		buffer_append_zero(ctx->buffer, 4 - (field->size & 3));
+
+	if (ctx->field_column_map[field->field_idx] != 0)
+		mail_cache_compress_column(ctx, field);
 }
 
 static uint32_t
@@ -162,8 +322,9 @@ mail_cache_copy(struct mail_cache *cache, struct mail_index_transaction *trans,
 	struct mail_cache_header hdr;
 	struct mail_cache_record cache_rec;
 	struct ostream *output;
-	uint32_t message_count, seq, first_new_seq, ext_offset;
+	uint32_t message_count, seq, first_new_seq, ext_offset, uid;
 	unsigned int i, used_fields_count, orig_fields_count, record_count;
+	unsigned int expunged_count;
 	time_t max_drop_time;
 
 	view = mail_index_transaction_get_view(trans);
@@ -231,12 +392,25 @@ mail_cache_copy(struct mail_cache *cache, struct mail_index_transaction *trans,
 	first_new_seq = mail_cache_get_first_new_seq(view);
 	message_count = mail_index_view_get_messages_count(view);
 
+	/* the columns section is written right after the header. it's filled
+	   while copying the records and written again at the end. */
+	for (seq = 1, expunged_count = 0; seq <= message_count; seq++) {
+		if (mail_index_transaction_is_expunged(trans, seq))
+			expunged_count++;
+	}
+	mail_cache_compress_init_columns(&ctx, message_count - expunged_count);
+	o_stream_nsend(output, ctx.columns_buf->data, ctx.columns_buf->used);
+
 	i_array_init(ext_offsets, message_count); record_count = 0;
 	for (seq = 1; seq <= message_count; seq++) {
 		if (mail_index_transaction_is_expunged(trans, seq)) {
 			array_append_zero(ext_offsets);
 			continue;
 		}
+		if (ctx.columns_count > 0) {
+			mail_index_lookup_uid(view, seq, &uid);
+			mail_cache_compress_column_uid(&ctx, uid);
+		}
 
 		ctx.new_msg = seq >= first_new_seq;
 		buffer_set_used_size(ctx.buffer, 0);
@@ -258,6 +432,7 @@ mail_cache_copy(struct mail_cache *cache, struct mail_index_transaction *trans,
 		    ctx.buffer->used > MAIL_CACHE_RECORD_MAX_SIZE) {
 			/* nothing cached */
 			ext_offset = 0;
+			mail_cache_compress_column_drop(&ctx);
 		} else {
 			cache_rec.size = ctx.buffer->used;
 			ext_offset = output->offset;
@@ -268,6 +443,7 @@ mail_cache_copy(struct mail_cache *cache, struct mail_index_transaction *trans,
 		}
 
 		array_append(ext_offsets, &ext_offset, 1);
+		ctx.column_pos++;
 	}
 	i_assert(orig_fields_count == cache->fields_count);
 
@@ -282,6 +458,8 @@ mail_cache_copy(struct mail_cache *cache, struct mail_index_transaction *trans,
 
 	(void)o_stream_seek(output, 0);
 	o_stream_nsend(output, &hdr, sizeof(hdr));
+	o_stream_nsend(output, ctx.columns_buf->data, ctx.columns_buf->used);
+	buffer_free(&ctx.columns_buf);
 
 	mail_cache_view_close(&cache_view);
 
@@ -345,6 +523,7 @@ static int mail_cache_compress_locked(struct mail_cache *cache,
 {
 	struct dotlock *dotlock;
 	struct stat st;
+	uoff_t old_size = 0;
 	mode_t old_mask;
 	uint32_t file_seq, old_offset;
 	ARRAY_TYPE(uint32_t) ext_offsets;
@@ -387,6 +566,13 @@ static int mail_cache_compress_locked(struct mail_cache *cache,
 	mail_index_fchown(cache->index, fd,
 			  file_dotlock_get_lock_path(dotlock));
 
+	if (cache->fd != -1) {
+		if (fstat(cache->fd, &st) == 0)
+			old_size = st.st_size;
+		else if (!ESTALE_FSTAT(errno))
+			mail_cache_set_syscall_error(cache, "fstat()");
+	}
+
 	if (mail_cache_copy(cache, trans, fd, &file_seq, &ext_offsets) < 0) {
 		/* the fields may have been updated in memory already.
 		   reverse those changes by re-reading them from file. */
@@ -433,6 +619,8 @@ static int mail_cache_compress_locked(struct mail_cache *cache,
 	cache->st_ino = st.st_ino;
 	cache->st_dev = st.st_dev;
 	cache->field_header_write_pending = FALSE;
+	if (old_size > (uoff_t)st.st_size)
+		cache->compress_stats.reclaimed_bytes += old_size - st.st_size;
 
 	if (cache->file_cache != NULL)
 		file_cache_set_fd(cache->file_cache, cache->fd);
@@ -449,6 +637,7 @@ static int mail_cache_compress_locked(struct mail_cache *cache,
 int mail_cache_compress(struct mail_cache *cache,
 			struct mail_index_transaction *trans)
 {
+	struct timeval tv_start, tv_end;
 	bool unlock = FALSE;
 	int ret;
 
@@ -487,6 +676,8 @@ int mail_cache_compress(struct mail_cache *cache,
 			unlock = TRUE;
 		}
 	}
+	if (gettimeofday(&tv_start, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
 	cache->compressing = TRUE;
 	ret = mail_cache_compress_locked(cache, trans, &unlock);
 	cache->compressing = FALSE;
@@ -494,12 +685,57 @@ int mail_cache_compress(struct mail_cache *cache,
 		if (mail_cache_unlock(cache) < 0)
 			ret = -1;
 	}
+	if (gettimeofday(&tv_end, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	cache->compress_stats.compress_count++;
+	cache->compress_stats.compress_usecs +=
+		timeval_diff_usecs(&tv_end, &tv_start);
+	return ret;
+}
+
+int mail_cache_compress_external(struct mail_cache *cache)
+{
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	int ret;
+
+	view = mail_index_view_open(cache->index);
+	trans = mail_index_transaction_begin(view,
+					MAIL_INDEX_TRANSACTION_FLAG_EXTERNAL);
+	if (mail_cache_compress(cache, trans) < 0) {
+		mail_index_transaction_rollback(&trans);
+		ret = -1;
+	} else {
+		ret = mail_index_transaction_commit(&trans);
+	}
+	mail_index_view_close(&view);
 	return ret;
 }
 
+int mail_cache_compress_if_needed(struct mail_cache *cache)
+{
+	if (!cache->opened)
+		(void)mail_cache_open_and_verify(cache);
+	if (!mail_cache_need_compress(cache))
+		return 0;
+	return mail_cache_compress_external(cache) < 0 ? -1 : 1;
+}
+
+void mail_cache_pop_compress_stats(struct mail_cache *cache,
+				   struct mail_cache_compress_stats *stats_r)
+{
+	*stats_r = cache->compress_stats;
+	memset(&cache->compress_stats, 0, sizeof(cache->compress_stats));
+}
+
 bool mail_cache_need_compress(struct mail_cache *cache)
 {
 	return cache->need_compress_file_seq != 0 &&
 		(cache->index->flags & MAIL_INDEX_OPEN_FLAG_SAVEONLY) == 0 &&
 		!cache->index->readonly;
 }
+
+uint32_t mail_cache_get_need_compress_file_seq(struct mail_cache *cache)
+{
+	return cache->need_compress_file_seq;
+}
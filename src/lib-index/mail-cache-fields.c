@@ -428,7 +428,7 @@ int mail_cache_header_fields_read(struct mail_cache *cache)
 
                 names = p + 1;
 	}
-	return 0;
+	return mail_cache_columns_read(cache);
 }
 
 static void copy_to_buf(struct mail_cache *cache, buffer_t *dest, bool add_new,
@@ -344,6 +344,8 @@ int mail_cache_field_exists(struct mail_cache_view *view, uint32_t seq,
 
 	if (!mail_cache_file_has_field(view->cache, field))
 		return 0;
+	if (mail_cache_columns_lookup(view, seq, field, NULL) > 0)
+		return 1;
 
 	/* FIXME: we should discard the cache if view has been synced */
 	if (view->cached_exists_seq != seq) {
@@ -408,6 +410,17 @@ int mail_cache_lookup_field(struct mail_cache_view *view, buffer_t *dest_buf,
 	struct mail_cache_iterate_field field;
 	int ret;
 
+	if (!view->cache->opened)
+		(void)mail_cache_open_and_verify(view->cache);
+
+	/* fixed size fields may be found from the columns without going
+	   through the message's records */
+	ret = mail_cache_columns_lookup(view, seq, field_idx, dest_buf);
+	if (ret != 0) {
+		mail_cache_decision_state_update(view, seq, field_idx);
+		return ret;
+	}
+
 	ret = mail_cache_field_exists(view, seq, field_idx);
 	mail_cache_decision_state_update(view, seq, field_idx);
 	if (ret <= 0)
@@ -6,7 +6,7 @@
 #include "mail-cache.h"
 
 #define MAIL_CACHE_MAJOR_VERSION 1
-#define MAIL_CACHE_MINOR_VERSION 1
+#define MAIL_CACHE_MINOR_VERSION 2
 
 /* Drop fields that haven't been accessed for n seconds */
 #define MAIL_CACHE_FIELD_DROP_SECS (3600*24*30)
@@ -28,6 +28,11 @@
 /* If cache record becomes larger than this, don't add it. */
 #define MAIL_CACHE_RECORD_MAX_SIZE (64*1024)
 
+/* Don't write the columns section if it becomes larger than this. */
+#define MAIL_CACHE_COLUMNS_MAX_SIZE (128*1024*1024)
+#define MAIL_CACHE_COLUMN_ALIGN(size) \
+	(((size) + sizeof(uint32_t)-1) & ~(sizeof(uint32_t)-1))
+
 #define MAIL_CACHE_LOCK_TIMEOUT 10
 #define MAIL_CACHE_LOCK_CHANGE_TIMEOUT 300
 
@@ -56,6 +61,36 @@ struct mail_cache_header {
 	uint32_t field_header_offset;
 };
 
+/* Since minor_version=2 the cache header is followed by a section written
+   by compression. It contains copies of the fixed size fields with YES
+   decision as per-field arrays, so sorting and searching doesn't need to
+   walk through each message's record list. */
+struct mail_cache_column_header {
+	/* size of the whole section, including this header */
+	uint32_t size;
+	uint32_t messages_count;
+	uint32_t columns_count;
+	uint32_t uids_offset;
+
+#if 0
+	struct mail_cache_column_field fields[columns_count];
+	/* UIDs of the messages that existed during compression. The position
+	   of the UID in this array is the message's index in all columns. */
+	uint32_t uids[messages_count];
+	/* for each column, 32bit aligned: */
+	uint8_t present_bitmap[(messages_count+7)/8];
+	uint8_t data[messages_count][field_size];
+#endif
+};
+
+struct mail_cache_column_field {
+	uint32_t file_field_idx;
+	uint32_t field_size;
+	/* offsets are relative to the beginning of the file */
+	uint32_t bitmap_offset;
+	uint32_t data_offset;
+};
+
 struct mail_cache_header_fields {
 	uint32_t next_offset;
 	uint32_t size;
@@ -104,6 +139,12 @@ struct mail_cache_field_private {
 	unsigned int decision_dirty:1;
 };
 
+struct mail_cache_column {
+	unsigned int field_idx;
+	unsigned int field_size;
+	uint32_t bitmap_offset, data_offset;
+};
+
 struct mail_cache {
 	struct mail_index *index;
 	uint32_t ext_id;
@@ -148,10 +189,17 @@ struct mail_cache {
 	/* 0 is no need for compression, otherwise the file sequence number
 	   which we want compressed. */
 	uint32_t need_compress_file_seq;
+	struct mail_cache_compress_stats compress_stats;
 
 	unsigned int *file_field_map;
 	unsigned int file_fields_count;
 
+	/* columns read from the cache file with columns_file_seq */
+	struct mail_cache_column *columns;
+	unsigned int columns_count;
+	uint32_t columns_file_seq;
+	uint32_t columns_uids_offset, columns_messages_count;
+
 	unsigned int opened:1;
 	unsigned int locked:1;
 	unsigned int last_lock_failed:1;
@@ -182,6 +230,8 @@ struct mail_cache_view {
 	buffer_t *cached_exists_buf;
 	uint8_t cached_exists_value;
 	uint32_t cached_exists_seq;
+	/* position of the last UID found from the columns */
+	uint32_t column_pos_hint;
 
 	unsigned int no_decision_updates:1;
 };
@@ -228,6 +278,15 @@ void mail_cache_header_fields_get(struct mail_cache *cache, buffer_t *dest);
 int mail_cache_header_fields_get_next_offset(struct mail_cache *cache,
 					     uint32_t *offset_r);
 
+/* Read the columns section if it hasn't been read yet for the current
+   file. Returns 0 if ok, -1 if error/corrupted. */
+int mail_cache_columns_read(struct mail_cache *cache);
+void mail_cache_columns_free(struct mail_cache *cache);
+/* Look up the field from the columns. If dest_buf is NULL, only check
+   whether it exists. Returns 1 if found, 0 if not, -1 if error. */
+int mail_cache_columns_lookup(struct mail_cache_view *view, uint32_t seq,
+			      unsigned int field_idx, buffer_t *dest_buf);
+
 uint32_t mail_cache_lookup_cur_offset(struct mail_index_view *view,
 				      uint32_t seq, uint32_t *reset_id_r);
 int mail_cache_get_record(struct mail_cache *cache, uint32_t offset,
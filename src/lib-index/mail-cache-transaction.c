@@ -165,8 +165,6 @@ static int
 mail_cache_transaction_compress(struct mail_cache_transaction_ctx *ctx)
 {
 	struct mail_cache *cache = ctx->cache;
-	struct mail_index_view *view;
-	struct mail_index_transaction *trans;
 	int ret;
 
 	ctx->tried_compression = TRUE;
@@ -174,16 +172,7 @@ mail_cache_transaction_compress(struct mail_cache_transaction_ctx *ctx)
 	cache->need_compress_file_seq =
 		MAIL_CACHE_IS_UNUSABLE(cache) ? 0 : cache->hdr->file_seq;
 
-	view = mail_index_view_open(cache->index);
-	trans = mail_index_transaction_begin(view,
-					MAIL_INDEX_TRANSACTION_FLAG_EXTERNAL);
-	if (mail_cache_compress(cache, trans) < 0) {
-		mail_index_transaction_rollback(&trans);
-		ret = -1;
-	} else {
-		ret = mail_index_transaction_commit(&trans);
-	}
-	mail_index_view_close(&view);
+	ret = mail_cache_compress_external(cache);
 	mail_cache_transaction_reset(ctx);
 	return ret;
 }
@@ -65,6 +65,7 @@ void mail_cache_file_close(struct mail_cache *cache)
 	cache->hdr = NULL;
 	cache->mmap_length = 0;
 	cache->last_field_header_offset = 0;
+	mail_cache_columns_free(cache);
 
 	if (cache->file_lock != NULL)
 		file_lock_free(&cache->file_lock);
@@ -42,6 +42,13 @@ struct mail_cache_field {
 	time_t last_used;
 };
 
+struct mail_cache_compress_stats {
+	unsigned int compress_count;
+	unsigned long long compress_usecs;
+	/* how much smaller the compressed cache files became */
+	unsigned long long reclaimed_bytes;
+};
+
 struct mail_cache *mail_cache_open_or_create(struct mail_index *index);
 struct mail_cache *mail_cache_create(struct mail_index *index);
 void mail_cache_free(struct mail_cache **cache);
@@ -65,9 +72,23 @@ mail_cache_register_get_list(struct mail_cache *cache, pool_t pool,
 
 /* Returns TRUE if cache should be compressed. */
 bool mail_cache_need_compress(struct mail_cache *cache);
+/* Returns the file_seq of the cache file that needs to be compressed,
+   or 0 if none. */
+uint32_t mail_cache_get_need_compress_file_seq(struct mail_cache *cache);
 /* Compress cache file. Offsets are updated to given transaction. */
 int mail_cache_compress(struct mail_cache *cache,
 			struct mail_index_transaction *trans);
+/* Compress cache file using a new view of the index. The offsets are updated
+   with an external transaction, so the index doesn't need to be locked for
+   syncing. */
+int mail_cache_compress_external(struct mail_cache *cache);
+/* Call mail_cache_compress_external() if mail_cache_need_compress() says so.
+   The cache file is opened first if needed. Returns 1 if compressed,
+   0 if not needed, -1 if error. */
+int mail_cache_compress_if_needed(struct mail_cache *cache);
+/* Get compression statistics gathered since the previous call. */
+void mail_cache_pop_compress_stats(struct mail_cache *cache,
+				   struct mail_cache_compress_stats *stats_r);
 /* Returns TRUE if there is at least something in the cache. */
 bool mail_cache_exists(struct mail_cache *cache);
 /* Open and read cache header. Returns 0 if ok, -1 if error/corrupted. */
@@ -88,8 +88,8 @@ mail_index_fsck_find_keyword_count(struct mail_index_map *map,
 	kw_pos = ext_hdr->record_offset;
 	kw_size = ext_hdr->record_size;
 
-	rec = map->rec_map->records;
 	for (r = 0; r < map->rec_map->records_count; r++) {
+		rec = MAIL_INDEX_MAP_IDX(map, r);
 		kw = CONST_PTR_OFFSET(rec, kw_pos);
 		for (i = cur = 0; i < kw_size; i++) {
 			if (kw[i] != 0) {
@@ -104,7 +104,6 @@ mail_index_fsck_find_keyword_count(struct mail_index_map *map,
 			if (max == kw_size*8)
 				return max;
 		}
-		rec = CONST_PTR_OFFSET(rec, map->hdr.record_size);
 	}
 	return max;
 }
@@ -313,7 +312,7 @@ static void
 mail_index_fsck_records(struct mail_index *index, struct mail_index_map *map,
 			struct mail_index_header *hdr)
 {
-	struct mail_index_record *rec, *next_rec;
+	const struct mail_index_record *rec;
 	uint32_t i, last_uid;
 	bool logged_unordered_uids = FALSE, logged_zero_uids = FALSE;
 	bool records_dropped = FALSE;
@@ -325,9 +324,9 @@ mail_index_fsck_records(struct mail_index *index, struct mail_index_map *map,
 	hdr->first_unseen_uid_lowwater = 0;
 	hdr->first_deleted_uid_lowwater = 0;
 
-	rec = map->rec_map->records; last_uid = 0;
+	last_uid = 0;
 	for (i = 0; i < map->rec_map->records_count; ) {
-		next_rec = PTR_OFFSET(rec, hdr->record_size);
+		rec = MAIL_INDEX_MAP_IDX(map, i);
 		if (rec->uid <= last_uid) {
 			/* log an error once, and skip this record */
 			if (rec->uid == 0) {
@@ -346,9 +345,7 @@ mail_index_fsck_records(struct mail_index *index, struct mail_index_map *map,
 			/* not the fastest way when we're skipping lots of
 			   records, but this should happen rarely so don't
 			   bother optimizing. */
-			memmove(rec, next_rec, hdr->record_size *
-				(map->rec_map->records_count - i - 1));
-			map->rec_map->records_count--;
+			mail_index_record_map_delete(map, i, 1);
 			records_dropped = TRUE;
 			continue;
 		}
@@ -367,7 +364,6 @@ mail_index_fsck_records(struct mail_index *index, struct mail_index_map *map,
 			hdr->first_deleted_uid_lowwater = rec->uid;
 
 		last_uid = rec->uid;
-		rec = next_rec;
 		i++;
 	}
 
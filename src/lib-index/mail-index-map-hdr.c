@@ -228,7 +228,9 @@ static void mail_index_map_clear_recent_flags(struct mail_index_map *map)
 	unsigned int i;
 
 	for (i = 0; i < map->hdr.messages_count; i++) {
-		rec = MAIL_INDEX_MAP_IDX(map, i);
+		if ((MAIL_INDEX_MAP_IDX(map, i)->flags & MAIL_RECENT) == 0)
+			continue;
+		rec = mail_index_map_idx_modifiable(map, i);
 		rec->flags &= ~MAIL_RECENT;
 	}
 }
@@ -277,7 +279,7 @@ int mail_index_map_check_header(struct mail_index_map *map)
 		/* pre-v2.2 (although should have been done in v2.1 already):
 		   make sure the old unused fields are cleared */
 		map->hdr.unused_old_sync_size = 0;
-		map->hdr.unused_old_sync_stamp = 0;
+		map->hdr.write_seq = 0;
 	}
 	if (hdr->first_recent_uid == 0 ||
 	    hdr->first_recent_uid > hdr->next_uid ||
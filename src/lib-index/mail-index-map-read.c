@@ -9,6 +9,8 @@
 #include "mail-index-sync-private.h"
 #include "mail-transaction-log-private.h"
 
+#include <fcntl.h>
+
 static void mail_index_map_copy_hdr(struct mail_index_map *map,
 				    const struct mail_index_header *hdr)
 {
@@ -26,7 +28,8 @@ static void mail_index_map_copy_hdr(struct mail_index_map *map,
 	map->hdr.unused_old_recent_messages_count = 0;
 }
 
-static int mail_index_mmap(struct mail_index_map *map, uoff_t file_size)
+static int mail_index_mmap(struct mail_index_map *map, int fd,
+			   const char *path, uoff_t file_size)
 {
 	struct mail_index *index = map->index;
 	struct mail_index_record_map *rec_map = map->rec_map;
@@ -34,19 +37,18 @@ static int mail_index_mmap(struct mail_index_map *map, uoff_t file_size)
 
 	i_assert(rec_map->mmap_base == NULL);
 
-	buffer_free(&rec_map->buffer);
+	mail_index_record_map_free_chunks(rec_map);
 	if (file_size > SSIZE_T_MAX) {
 		/* too large file to map into memory */
-		mail_index_set_error(index, "Index file too large: %s",
-				     index->filepath);
+		mail_index_set_error(index, "Index file too large: %s", path);
 		return -1;
 	}
 
 	rec_map->mmap_base = mmap(NULL, file_size, PROT_READ | PROT_WRITE,
-				  MAP_PRIVATE, index->fd, 0);
+				  MAP_PRIVATE, fd, 0);
 	if (rec_map->mmap_base == MAP_FAILED) {
 		rec_map->mmap_base = NULL;
-		mail_index_set_syscall_error(index, "mmap()");
+		mail_index_file_set_syscall_error(index, path, "mmap()");
 		return -1;
 	}
 	rec_map->mmap_size = file_size;
@@ -62,7 +64,7 @@ static int mail_index_mmap(struct mail_index_map *map, uoff_t file_size)
 	if (rec_map->mmap_size < MAIL_INDEX_HEADER_MIN_SIZE) {
 		mail_index_set_error(index, "Corrupted index file %s: "
 				     "File too small (%"PRIuSIZE_T")",
-				     index->filepath, rec_map->mmap_size);
+				     path, rec_map->mmap_size);
 		return 0;
 	}
 
@@ -84,14 +86,14 @@ static int mail_index_mmap(struct mail_index_map *map, uoff_t file_size)
 			rec_map->records_count * hdr->record_size;
 		mail_index_set_error(index, "Corrupted index file %s: "
 				     "messages_count too large (%u > %u)",
-				     index->filepath, hdr->messages_count,
+				     path, hdr->messages_count,
 				     rec_map->records_count);
 	}
 
 	mail_index_map_copy_hdr(map, hdr);
 
 	map->hdr_base = rec_map->mmap_base;
-	rec_map->records = PTR_OFFSET(rec_map->mmap_base, map->hdr.header_size);
+	mail_index_record_map_init_records(map, rec_map->records_count);
 	return 1;
 }
 
@@ -119,9 +121,34 @@ static int mail_index_read_header(struct mail_index *index,
 	return ret;
 }
 
+static bool
+mail_index_is_written_inplace(struct mail_index *index,
+			      const struct mail_index_header *hdr)
+{
+	uint32_t write_seq;
+
+	/* only in-place writers use write_seq. in older files the field
+	   may still contain the old sync_stamp, which isn't cleared until
+	   mail_index_map_check_header(). */
+	if ((index->flags & MAIL_INDEX_OPEN_FLAG_INPLACE_WRITE) == 0 ||
+	    hdr->minor_version < MAIL_INDEX_MINOR_VERSION)
+		return FALSE;
+
+	/* an odd write_seq means that the file is being overwritten. if it
+	   changed while we were reading, we may have gotten a mix of old and
+	   new records. */
+	if ((hdr->write_seq & 1) != 0)
+		return TRUE;
+	if (pread_full(index->fd, &write_seq, sizeof(write_seq),
+		       offsetof(struct mail_index_header, write_seq)) <= 0)
+		return FALSE;
+	return write_seq != hdr->write_seq;
+}
+
 static int
 mail_index_try_read_map(struct mail_index_map *map,
-			uoff_t file_size, bool *retry_r, bool try_retry)
+			uoff_t file_size, bool *retry_r, bool try_retry,
+			bool *inplace_retry_r)
 {
 	struct mail_index *index = map->index;
 	const struct mail_index_header *hdr;
@@ -130,11 +157,14 @@ mail_index_try_read_map(struct mail_index_map *map,
 	void *data = NULL;
 	ssize_t ret;
 	size_t pos, records_size, initial_buf_pos = 0;
-	unsigned int records_count = 0, extra;
+	size_t offset, chunk_size, size;
+	unsigned int i, records_count = 0, extra;
+	bool records_truncated = FALSE;
 
 	i_assert(map->rec_map->mmap_base == NULL);
 
 	*retry_r = FALSE;
+	*inplace_retry_r = FALSE;
 	ret = mail_index_read_header(index, read_buf, sizeof(read_buf), &pos);
 	buf = read_buf; hdr = buf;
 
@@ -180,33 +210,36 @@ mail_index_try_read_map(struct mail_index_map *map,
 			records_count = (file_size - hdr->header_size) /
 				hdr->record_size;
 			records_size = (size_t)records_count * hdr->record_size;
-			mail_index_set_error(index, "Corrupted index file %s: "
-				"messages_count too large (%u > %u)",
-				index->filepath, hdr->messages_count,
-				records_count);
+			records_truncated = TRUE;
 		}
 
-		if (map->rec_map->buffer == NULL) {
-			map->rec_map->buffer =
-				buffer_create_dynamic(default_pool,
-						      records_size);
-		}
-
-		/* @UNSAFE */
-		buffer_set_used_size(map->rec_map->buffer, 0);
-		if (initial_buf_pos <= hdr->header_size)
-			extra = 0;
-		else {
-			extra = initial_buf_pos - hdr->header_size;
-			buffer_append(map->rec_map->buffer,
-				      CONST_PTR_OFFSET(buf, hdr->header_size),
-				      extra);
-		}
-		if (records_size > extra) {
-			data = buffer_append_space_unsafe(map->rec_map->buffer,
-							  records_size - extra);
-			ret = pread_full(index->fd, data, records_size - extra,
-					 hdr->header_size + extra);
+		/* @UNSAFE: read the records directly into the chunks.
+		   the rest of map->hdr is updated later. */
+		map->hdr.record_size = hdr->record_size;
+		mail_index_record_map_init_records(map, records_count);
+		extra = initial_buf_pos <= hdr->header_size ? 0 :
+			initial_buf_pos - hdr->header_size;
+		offset = 0;
+		for (i = 0; i < map->rec_map->chunks_count && ret > 0; i++) {
+			data = map->rec_map->chunks[i];
+			chunk_size = (size_t)I_MIN(records_count -
+				(i << MAIL_INDEX_RECORD_CHUNK_SHIFT),
+				MAIL_INDEX_RECORD_CHUNK_COUNT) *
+				hdr->record_size;
+			size = 0;
+			if (offset < extra) {
+				size = I_MIN(extra - offset, chunk_size);
+				memcpy(data, CONST_PTR_OFFSET(buf,
+					hdr->header_size + offset), size);
+			}
+			if (size < chunk_size) {
+				ret = pread_full(index->fd,
+						 PTR_OFFSET(data, size),
+						 chunk_size - size,
+						 hdr->header_size + offset +
+						 size);
+			}
+			offset += chunk_size;
 		}
 	}
 
@@ -219,6 +252,18 @@ mail_index_try_read_map(struct mail_index_map *map,
 		mail_index_set_syscall_error(index, "pread_full()");
 		return -1;
 	}
+	if (pos >= sizeof(*hdr) && hdr->base_header_size >= sizeof(*hdr) &&
+	    mail_index_is_written_inplace(index, hdr)) {
+		*inplace_retry_r = TRUE;
+		return 0;
+	}
+	if (records_truncated) {
+		/* not logged before the in-place write check, since an
+		   in-place writer may have been growing the file */
+		mail_index_set_error(index, "Corrupted index file %s: "
+			"messages_count too large (%u > %u)",
+			index->filepath, hdr->messages_count, records_count);
+	}
 	if (ret == 0) {
 		mail_index_set_error(index,
 			"Corrupted index file %s: File too small",
@@ -226,23 +271,38 @@ mail_index_try_read_map(struct mail_index_map *map,
 		return 0;
 	}
 
-	map->rec_map->records =
-		buffer_get_modifiable_data(map->rec_map->buffer, NULL);
-	map->rec_map->records_count = records_count;
-
 	mail_index_map_copy_hdr(map, hdr);
 	map->hdr_base = map->hdr_copy_buf->data;
 	return 1;
 }
 
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+static void mail_index_read_prefetch(struct mail_index *index,
+				     uoff_t file_size)
+{
+	int ret;
+
+	/* the header and the record chunks are read with separate pread()s.
+	   with NFS each of them would otherwise be a separate round-trip. */
+	if (file_size < MAIL_INDEX_READ_PREFETCH_MIN_SIZE)
+		return;
+
+	ret = posix_fadvise(index->fd, 0, file_size, POSIX_FADV_WILLNEED);
+	if (ret != 0) {
+		errno = ret;
+		mail_index_set_syscall_error(index, "posix_fadvise()");
+	}
+}
+#endif
+
 static int mail_index_read_map(struct mail_index_map *map, uoff_t file_size)
 {
 	struct mail_index *index = map->index;
 	mail_index_sync_lost_handler_t *const *handlerp;
 	struct stat st;
-	unsigned int i;
+	unsigned int i, inplace_retries = 0;
 	int ret;
-	bool try_retry, retry;
+	bool try_retry, retry, inplace_retry;
 
 	/* notify all "sync lost" handlers */
 	array_foreach(&index->sync_lost_handlers, handlerp)
@@ -255,8 +315,27 @@ static int mail_index_read_map(struct mail_index_map *map, uoff_t file_size)
 			ret = 0;
 			retry = try_retry;
 		} else {
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+			mail_index_read_prefetch(index, file_size);
+#endif
 			ret = mail_index_try_read_map(map, file_size,
-						      &retry, try_retry);
+				&retry, try_retry, &inplace_retry);
+			if (inplace_retry) {
+				if (++inplace_retries >=
+				    MAIL_INDEX_INPLACE_READ_RETRY_COUNT) {
+					mail_index_set_error(index,
+						"Corrupted index file %s: "
+						"In-place write didn't finish",
+						index->filepath);
+					break;
+				}
+				/* someone's overwriting the file. it'll
+				   finish soon, no need to reopen it. */
+				usleep(MAIL_INDEX_INPLACE_READ_RETRY_MSECS*1000);
+				if (fstat(index->fd, &st) == 0)
+					file_size = st.st_size;
+				continue;
+			}
 		}
 		if (ret != 0 || !retry)
 			break;
@@ -287,11 +366,103 @@ static int mail_index_read_map(struct mail_index_map *map, uoff_t file_size)
 	return ret;
 }
 
+static void
+mail_index_map_replace(struct mail_index *index, struct mail_index_map *map,
+		       const struct mail_index_header *file_hdr,
+		       const struct stat *st)
+{
+	/* last_read_* describe what the index file contains, even if the map
+	   came from the shared memory snapshot */
+	index->last_read_log_file_seq = file_hdr->log_file_seq;
+	index->last_read_log_file_head_offset = file_hdr->log_file_head_offset;
+	index->last_read_log_file_tail_offset = file_hdr->log_file_tail_offset;
+	index->last_read_stat = *st;
+
+	mail_index_unmap(&index->map);
+	index->map = map;
+}
+
+static bool
+mail_index_shm_is_newer(const struct mail_index_header *shm_hdr,
+			const struct mail_index_header *file_hdr)
+{
+	if (shm_hdr->indexid != file_hdr->indexid)
+		return FALSE;
+	if (shm_hdr->log_file_seq != file_hdr->log_file_seq)
+		return shm_hdr->log_file_seq > file_hdr->log_file_seq;
+	return shm_hdr->log_file_head_offset > file_hdr->log_file_head_offset;
+}
+
+/* Map the shared memory snapshot of the index file if it's newer than the
+   file itself. Returns 1 if mapped, 0 if there was no usable snapshot. */
+static int
+mail_index_map_read_shm(struct mail_index_map *map, const struct stat *st,
+			struct mail_index_header *file_hdr_r)
+{
+	struct mail_index *index = map->index;
+	struct stat shm_st;
+	const char *path;
+	int fd, ret;
+
+	if (pread_full(index->fd, file_hdr_r, sizeof(*file_hdr_r), 0) <= 0 ||
+	    file_hdr_r->major_version != MAIL_INDEX_MAJOR_VERSION ||
+	    ((index->flags & MAIL_INDEX_OPEN_FLAG_INPLACE_WRITE) != 0 &&
+	     file_hdr_r->minor_version >= MAIL_INDEX_MINOR_VERSION &&
+	     (file_hdr_r->write_seq & 1) != 0)) {
+		/* let the normal file reading handle these */
+		return 0;
+	}
+
+	if (mail_index_shm_dir_check(index) <= 0)
+		return 0;
+	path = mail_index_get_shm_path(index, st);
+	fd = open(path, O_RDONLY | O_NOFOLLOW);
+	if (fd == -1) {
+		if (errno != ENOENT)
+			mail_index_file_set_syscall_error(index, path, "open()");
+		return 0;
+	}
+	if (fstat(fd, &shm_st) < 0) {
+		mail_index_file_set_syscall_error(index, path, "fstat()");
+		i_close_fd(&fd);
+		return 0;
+	}
+	if (shm_st.st_uid != st->st_uid && shm_st.st_uid != geteuid()) {
+		/* not written by us or the index file's owner */
+		i_close_fd(&fd);
+		return 0;
+	}
+
+	/* the snapshot is never modified, only replaced, so it's safe to
+	   keep it mmaped */
+	ret = mail_index_mmap(map, fd, path, shm_st.st_size);
+	i_close_fd(&fd);
+	if (ret <= 0 || !mail_index_shm_is_newer(&map->hdr, file_hdr_r))
+		return 0;
+
+	if (mail_index_map_check_header(map) <= 0)
+		return 0;
+	T_BEGIN {
+		if (mail_index_map_parse_extensions(map) < 0 ||
+		    mail_index_map_parse_keywords(map) < 0)
+			ret = 0;
+	} T_END;
+	if (ret == 0)
+		return 0;
+
+	i_free(index->shm_path);
+	index->shm_path = i_strdup(path);
+	index->shm_log_file_seq = map->hdr.log_file_seq;
+	index->shm_log_file_head_offset = map->hdr.log_file_head_offset;
+	return 1;
+}
+
 /* returns -1 = error, 0 = index files are unusable,
    1 = index files are usable or at least repairable */
 static int mail_index_map_latest_file(struct mail_index *index)
 {
 	struct mail_index_map *old_map, *new_map;
+	struct mail_index_header file_hdr;
 	struct stat st;
 	uoff_t file_size;
 	bool use_mmap, unusable = FALSE;
@@ -324,12 +495,38 @@ static int mail_index_map_latest_file(struct mail_index *index)
 	   mmap isn't disabled don't use it unless the file is large enough */
 	use_mmap = (index->flags & MAIL_INDEX_OPEN_FLAG_MMAP_DISABLE) == 0 &&
 		file_size != (uoff_t)-1 && file_size > MAIL_INDEX_MMAP_MIN_SIZE;
+	/* mmaped records would change under us with in-place writes */
+	if ((index->flags & MAIL_INDEX_OPEN_FLAG_INPLACE_WRITE) != 0)
+		use_mmap = FALSE;
 
 	new_map = mail_index_map_alloc(index);
+	if (index->shm_dir != NULL && file_size != (uoff_t)-1) {
+		if (mail_index_map_read_shm(new_map, &st, &file_hdr) > 0) {
+			/* dovecot.index contents don't match the map */
+			mail_index_written_records_free(index);
+			mail_index_map_replace(index, new_map, &file_hdr, &st);
+			return 1;
+		}
+		if (new_map->rec_map->mmap_base != NULL) {
+			/* unusable snapshot */
+			mail_index_unmap(&new_map);
+			new_map = mail_index_map_alloc(index);
+		}
+	}
+
 	if (use_mmap) {
-		ret = mail_index_mmap(new_map, file_size);
+		ret = mail_index_mmap(new_map, index->fd, index->filepath,
+				      file_size);
 	} else {
 		ret = mail_index_read_map(new_map, file_size);
+		if (ret > 0 &&
+		    (index->flags & MAIL_INDEX_OPEN_FLAG_INPLACE_WRITE) != 0) {
+			/* remember what the file contains, so the next write
+			   can overwrite only the changed records */
+			if (fstat(index->fd, &st) == 0)
+				mail_index_written_records_set(index, new_map,
+							       &st);
+		}
 	}
 	if (ret == 0) {
 		/* the index files are unusable */
@@ -369,17 +566,10 @@ static int mail_index_map_latest_file(struct mail_index *index)
 		mail_index_unmap(&new_map);
 		return ret < 0 ? -1 : (unusable ? 0 : 1);
 	}
-	i_assert(new_map->rec_map->records != NULL);
-
-	index->last_read_log_file_seq = new_map->hdr.log_file_seq;
-	index->last_read_log_file_head_offset =
-		new_map->hdr.log_file_head_offset;
-	index->last_read_log_file_tail_offset =
-		new_map->hdr.log_file_tail_offset;
-	index->last_read_stat = st;
+	i_assert(new_map->rec_map->chunks != NULL ||
+		 new_map->rec_map->records_count == 0);
 
-	mail_index_unmap(&index->map);
-	index->map = new_map;
+	mail_index_map_replace(index, new_map, &new_map->hdr, &st);
 	return 1;
 }
 
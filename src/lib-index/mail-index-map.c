@@ -7,6 +7,22 @@
 #include "mail-index-private.h"
 #include "mail-index-modseq.h"
 
+/* Header of an in-memory record chunk. The records follow it. */
+struct mail_index_record_chunk {
+	/* number of record maps using the chunk */
+	unsigned int refcount;
+	/* number of records that fit into the chunk */
+	unsigned int alloc_count;
+};
+#define RECORD_CHUNK_HDR_SIZE MEM_ALIGN(sizeof(struct mail_index_record_chunk))
+#define RECORD_CHUNK_DATA(chunk) \
+	PTR_OFFSET(chunk, RECORD_CHUNK_HDR_SIZE)
+#define RECORD_CHUNK_FROM_DATA(data) \
+	((struct mail_index_record_chunk *) \
+	 ((char *)(data) - RECORD_CHUNK_HDR_SIZE))
+/* Initial size of a chunk that is grown by appends */
+#define RECORD_CHUNK_MIN_ALLOC_COUNT 16
+
 void mail_index_map_init_extbufs(struct mail_index_map *map,
 				 unsigned int initial_count)
 {
@@ -263,14 +279,267 @@ struct mail_index_map *mail_index_map_alloc(struct mail_index *index)
 	return mail_index_map_clone(&tmp_map);
 }
 
+static void *record_chunk_alloc(unsigned int record_size,
+				unsigned int alloc_count)
+{
+	struct mail_index_record_chunk *chunk;
+
+	i_assert(alloc_count <= MAIL_INDEX_RECORD_CHUNK_COUNT);
+
+	chunk = i_malloc(RECORD_CHUNK_HDR_SIZE +
+			 (size_t)alloc_count * record_size);
+	chunk->refcount = 1;
+	chunk->alloc_count = alloc_count;
+	return RECORD_CHUNK_DATA(chunk);
+}
+
+static void record_chunk_unref(void *data)
+{
+	struct mail_index_record_chunk *chunk = RECORD_CHUNK_FROM_DATA(data);
+
+	i_assert(chunk->refcount > 0);
+	if (--chunk->refcount == 0)
+		i_free(chunk);
+}
+
+static unsigned int
+record_map_chunk_records(const struct mail_index_record_map *rec_map,
+			 unsigned int chunk_idx)
+{
+	unsigned int first_idx = chunk_idx << MAIL_INDEX_RECORD_CHUNK_SHIFT;
+
+	if (first_idx >= rec_map->records_count)
+		return 0;
+	return I_MIN(rec_map->records_count - first_idx,
+		     MAIL_INDEX_RECORD_CHUNK_COUNT);
+}
+
+static void
+record_map_add_chunk(struct mail_index_record_map *rec_map, void *data)
+{
+	unsigned int new_count;
+
+	if (rec_map->chunks_count == rec_map->chunks_alloc_count) {
+		new_count = I_MAX(rec_map->chunks_alloc_count * 2, 8);
+		rec_map->chunks = i_realloc(rec_map->chunks,
+			sizeof(void *) * rec_map->chunks_alloc_count,
+			sizeof(void *) * new_count);
+		rec_map->chunks_alloc_count = new_count;
+	}
+	rec_map->chunks[rec_map->chunks_count++] = data;
+}
+
+static void
+record_map_truncate_chunks(struct mail_index_record_map *rec_map)
+{
+	unsigned int count;
+
+	if (rec_map->mmap_base != NULL)
+		return;
+
+	count = (rec_map->records_count + MAIL_INDEX_RECORD_CHUNK_MASK) >>
+		MAIL_INDEX_RECORD_CHUNK_SHIFT;
+	while (rec_map->chunks_count > count)
+		record_chunk_unref(rec_map->chunks[--rec_map->chunks_count]);
+}
+
+void mail_index_record_map_free_chunks(struct mail_index_record_map *rec_map)
+{
+	unsigned int i;
+
+	if (rec_map->mmap_base == NULL) {
+		for (i = 0; i < rec_map->chunks_count; i++)
+			record_chunk_unref(rec_map->chunks[i]);
+	}
+	i_free_and_null(rec_map->chunks);
+	rec_map->chunks_count = rec_map->chunks_alloc_count = 0;
+}
+
+void mail_index_record_map_init_records(struct mail_index_map *map,
+					unsigned int records_count)
+{
+	struct mail_index_record_map *rec_map = map->rec_map;
+	unsigned int i, count, record_size = map->hdr.record_size;
+	void *data;
+
+	mail_index_record_map_free_chunks(rec_map);
+	rec_map->records_count = records_count;
+	for (i = 0; i < records_count; i += count) {
+		count = I_MIN(records_count - i, MAIL_INDEX_RECORD_CHUNK_COUNT);
+		if (rec_map->mmap_base != NULL) {
+			data = PTR_OFFSET(rec_map->mmap_base,
+					  map->hdr.header_size +
+					  (size_t)i * record_size);
+		} else {
+			data = record_chunk_alloc(record_size, count);
+		}
+		record_map_add_chunk(rec_map, data);
+	}
+}
+
+static void *
+record_map_chunk_modifiable(struct mail_index_map *map,
+			    unsigned int chunk_idx, unsigned int min_count)
+{
+	struct mail_index_record_map *rec_map = map->rec_map;
+	struct mail_index_record_chunk *chunk;
+	unsigned int new_alloc_count, copy_count;
+	unsigned int record_size = map->hdr.record_size;
+	void *data;
+
+	i_assert(chunk_idx < rec_map->chunks_count);
+
+	data = rec_map->chunks[chunk_idx];
+	if (rec_map->mmap_base != NULL) {
+		/* MAP_PRIVATE mmap can be modified directly */
+		return data;
+	}
+	chunk = RECORD_CHUNK_FROM_DATA(data);
+	if (chunk->refcount == 1 && chunk->alloc_count >= min_count)
+		return data;
+
+	new_alloc_count = chunk->alloc_count;
+	if (new_alloc_count < min_count) {
+		new_alloc_count = I_MAX(nearest_power(min_count),
+					RECORD_CHUNK_MIN_ALLOC_COUNT);
+		new_alloc_count = I_MIN(new_alloc_count,
+					MAIL_INDEX_RECORD_CHUNK_COUNT);
+	}
+
+	if (chunk->refcount == 1) {
+		chunk = i_realloc(chunk, RECORD_CHUNK_HDR_SIZE +
+				  (size_t)chunk->alloc_count * record_size,
+				  RECORD_CHUNK_HDR_SIZE +
+				  (size_t)new_alloc_count * record_size);
+		chunk->alloc_count = new_alloc_count;
+		data = RECORD_CHUNK_DATA(chunk);
+	} else {
+		/* shared with another record map, copy it */
+		copy_count = I_MIN(record_map_chunk_records(rec_map, chunk_idx),
+				   chunk->alloc_count);
+		data = record_chunk_alloc(record_size, new_alloc_count);
+		memcpy(data, rec_map->chunks[chunk_idx],
+		       (size_t)copy_count * record_size);
+		record_chunk_unref(rec_map->chunks[chunk_idx]);
+	}
+	rec_map->chunks[chunk_idx] = data;
+	return data;
+}
+
+struct mail_index_record *
+mail_index_map_idx_modifiable(struct mail_index_map *map, uint32_t idx)
+{
+	void *data;
+
+	i_assert(idx < map->rec_map->records_count);
+
+	data = record_map_chunk_modifiable(map,
+			idx >> MAIL_INDEX_RECORD_CHUNK_SHIFT,
+			(idx & MAIL_INDEX_RECORD_CHUNK_MASK) + 1);
+	return PTR_OFFSET(data, (idx & MAIL_INDEX_RECORD_CHUNK_MASK) *
+			  map->hdr.record_size);
+}
+
+void *mail_index_record_map_append_space(struct mail_index_map *map)
+{
+	struct mail_index_record_map *rec_map = map->rec_map;
+	unsigned int idx = rec_map->records_count;
+	unsigned int chunk_idx = idx >> MAIL_INDEX_RECORD_CHUNK_SHIFT;
+	void *data;
+
+	i_assert(rec_map->mmap_base == NULL);
+	i_assert(chunk_idx <= rec_map->chunks_count);
+
+	if (chunk_idx == rec_map->chunks_count) {
+		data = record_chunk_alloc(map->hdr.record_size,
+					  RECORD_CHUNK_MIN_ALLOC_COUNT);
+		record_map_add_chunk(rec_map, data);
+	}
+	data = record_map_chunk_modifiable(map, chunk_idx,
+			(idx & MAIL_INDEX_RECORD_CHUNK_MASK) + 1);
+	return PTR_OFFSET(data, (idx & MAIL_INDEX_RECORD_CHUNK_MASK) *
+			  map->hdr.record_size);
+}
+
+void mail_index_record_map_delete(struct mail_index_map *map,
+				  uint32_t idx, uint32_t count)
+{
+	struct mail_index_record_map *rec_map = map->rec_map;
+	uint32_t dest_idx, src_idx, n;
+	void *dest;
+
+	i_assert(idx + count <= rec_map->records_count);
+
+	/* move the following records backwards one chunk at a time, so
+	   only the chunks that actually change get copied */
+	dest_idx = idx; src_idx = idx + count;
+	while (src_idx < rec_map->records_count) {
+		n = I_MIN(MAIL_INDEX_RECORD_CHUNK_COUNT -
+			  (dest_idx & MAIL_INDEX_RECORD_CHUNK_MASK),
+			  MAIL_INDEX_RECORD_CHUNK_COUNT -
+			  (src_idx & MAIL_INDEX_RECORD_CHUNK_MASK));
+		n = I_MIN(n, rec_map->records_count - src_idx);
+
+		dest = mail_index_map_idx_modifiable(map, dest_idx);
+		/* @UNSAFE */
+		memmove(dest, MAIL_INDEX_MAP_IDX(map, src_idx),
+			(size_t)n * map->hdr.record_size);
+		dest_idx += n; src_idx += n;
+	}
+	rec_map->records_count -= count;
+	record_map_truncate_chunks(rec_map);
+}
+
+void mail_index_written_records_free(struct mail_index *index)
+{
+	struct mail_index_written_records *written = index->written;
+	unsigned int i;
+
+	if (written == NULL)
+		return;
+	index->written = NULL;
+
+	for (i = 0; i < written->chunks_count; i++)
+		record_chunk_unref(written->chunks[i]);
+	i_free(written->chunks);
+	i_free(written);
+}
+
+void mail_index_written_records_set(struct mail_index *index,
+				    struct mail_index_map *map,
+				    const struct stat *st)
+{
+	struct mail_index_record_map *rec_map = map->rec_map;
+	struct mail_index_written_records *written;
+	unsigned int i;
+
+	mail_index_written_records_free(index);
+	if ((index->flags & MAIL_INDEX_OPEN_FLAG_INPLACE_WRITE) == 0 ||
+	    rec_map->mmap_base != NULL)
+		return;
+
+	written = i_new(struct mail_index_written_records, 1);
+	written->chunks_count = rec_map->chunks_count;
+	if (written->chunks_count > 0)
+		written->chunks = i_new(void *, written->chunks_count);
+	for (i = 0; i < written->chunks_count; i++) {
+		RECORD_CHUNK_FROM_DATA(rec_map->chunks[i])->refcount++;
+		written->chunks[i] = rec_map->chunks[i];
+	}
+	written->records_count = rec_map->records_count;
+	written->header_size = map->hdr.header_size;
+	written->record_size = map->hdr.record_size;
+	written->write_seq = map->hdr.write_seq;
+	written->dev = st->st_dev;
+	written->ino = st->st_ino;
+	index->written = written;
+}
+
 static void mail_index_record_map_free(struct mail_index_map *map,
 				       struct mail_index_record_map *rec_map)
 {
-	if (rec_map->buffer != NULL) {
-		i_assert(rec_map->mmap_base == NULL);
-		buffer_free(&rec_map->buffer);
-	} else if (rec_map->mmap_base != NULL) {
-		i_assert(rec_map->buffer == NULL);
+	mail_index_record_map_free_chunks(rec_map);
+	if (rec_map->mmap_base != NULL) {
 		if (munmap(rec_map->mmap_base, rec_map->mmap_size) < 0)
 			mail_index_set_syscall_error(map->index, "munmap()");
 		rec_map->mmap_base = NULL;
@@ -324,13 +593,30 @@ static void mail_index_map_copy_records(struct mail_index_record_map *dest,
 					const struct mail_index_record_map *src,
 					unsigned int record_size)
 {
-	size_t size;
-
-	size = src->records_count * record_size;
-	dest->buffer = buffer_create_dynamic(default_pool, I_MIN(size, 1024));
-	buffer_append(dest->buffer, src->records, size);
-
-	dest->records = buffer_get_modifiable_data(dest->buffer, NULL);
+	unsigned int i, count, chunks_count = src->chunks_count;
+	void **chunks = NULL;
+
+	/* dest is either a new record map or src being moved to memory */
+	i_assert(dest->chunks == NULL || dest == src);
+
+	/* in-memory chunks are shared until they're modified. mmaped
+	   records are copied. */
+	if (chunks_count > 0)
+		chunks = i_new(void *, chunks_count);
+	for (i = 0; i < chunks_count; i++) {
+		if (src->mmap_base == NULL) {
+			RECORD_CHUNK_FROM_DATA(src->chunks[i])->refcount++;
+			chunks[i] = src->chunks[i];
+		} else {
+			count = record_map_chunk_records(src, i);
+			chunks[i] = record_chunk_alloc(record_size, count);
+			memcpy(chunks[i], src->chunks[i],
+			       (size_t)count * record_size);
+		}
+	}
+	i_free(dest->chunks);
+	dest->chunks = chunks;
+	dest->chunks_count = dest->chunks_alloc_count = chunks_count;
 	dest->records_count = src->records_count;
 
 	dest->records_changed = src->records_changed;
@@ -387,8 +673,6 @@ struct mail_index_map *mail_index_map_clone(const struct mail_index_map *map)
 	mem_map->refcount = 1;
 	if (map->rec_map == NULL) {
 		mem_map->rec_map = mail_index_record_map_alloc(mem_map);
-		mem_map->rec_map->buffer =
-			buffer_create_dynamic(default_pool, 1024);
 	} else {
 		mem_map->rec_map = map->rec_map;
 		array_append(&mem_map->rec_map->maps, &mem_map, 1);
@@ -451,8 +735,7 @@ void mail_index_record_map_move_to_private(struct mail_index_map *map)
 			rec = MAIL_INDEX_MAP_IDX(map, new_map->records_count-1);
 			new_map->last_appended_uid = rec->uid;
 		}
-		buffer_set_used_size(new_map->buffer, new_map->records_count *
-				     map->hdr.record_size);
+		record_map_truncate_chunks(new_map);
 	}
 }
 
@@ -503,14 +786,11 @@ static uint32_t mail_index_bsearch_uid(struct mail_index_map *map,
 				       uint32_t uid, uint32_t left_idx,
 				       int nearest_side)
 {
-	const struct mail_index_record *rec_base, *rec;
-	uint32_t idx, right_idx, record_size;
+	const struct mail_index_record *rec;
+	uint32_t idx, right_idx;
 
 	i_assert(map->hdr.messages_count <= map->rec_map->records_count);
 
-	rec_base = map->rec_map->records;
-	record_size = map->hdr.record_size;
-
 	idx = left_idx;
 	right_idx = I_MIN(map->hdr.messages_count, uid);
 
@@ -518,7 +798,7 @@ static uint32_t mail_index_bsearch_uid(struct mail_index_map *map,
 	while (left_idx < right_idx) {
 		idx = (left_idx + right_idx) / 2;
 
-                rec = CONST_PTR_OFFSET(rec_base, idx * record_size);
+		rec = MAIL_INDEX_MAP_IDX(map, idx);
 		if (rec->uid < uid)
 			left_idx = idx+1;
 		else if (rec->uid > uid)
@@ -528,7 +808,7 @@ static uint32_t mail_index_bsearch_uid(struct mail_index_map *map,
 	}
 	i_assert(idx < map->hdr.messages_count);
 
-	rec = CONST_PTR_OFFSET(rec_base, idx * record_size);
+	rec = MAIL_INDEX_MAP_IDX(map, idx);
 	if (rec->uid != uid) {
 		if (nearest_side > 0) {
 			/* we want uid or larger */
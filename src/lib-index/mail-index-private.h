@@ -15,6 +15,9 @@ struct mail_index_sync_map_ctx;
 
 /* How large index files to mmap() instead of reading to memory. */
 #define MAIL_INDEX_MMAP_MIN_SIZE (1024*64)
+/* When reading index files at least this large to memory, ask the kernel to
+   start reading the whole file at once instead of waiting for each pread() */
+#define MAIL_INDEX_READ_PREFETCH_MIN_SIZE (1024*64)
 /* How many times to retry opening index files if read/fstat returns ESTALE.
    This happens with NFS when the file has been deleted (ie. index file was
    rewritten by another computer than us). */
@@ -27,6 +30,21 @@ struct mail_index_sync_map_ctx;
    values. */
 #define MAIL_INDEX_MIN_WRITE_BYTES (1024*8)
 #define MAIL_INDEX_MAX_WRITE_BYTES (1024*128)
+/* Write a new shared memory snapshot of the index after this many bytes have
+   been added to the transaction log since the last snapshot or index write,
+   but at least 1/MAIL_INDEX_SHM_WRITE_INDEX_SIZE_DIVISOR of the index size */
+#define MAIL_INDEX_SHM_MIN_WRITE_BYTES 1024
+#define MAIL_INDEX_SHM_WRITE_INDEX_SIZE_DIVISOR 32
+/* Snapshots whose index file no longer exists are deleted at most this
+   often, and only if they haven't been written for this long */
+#define MAIL_INDEX_SHM_EXPIRE_INTERVAL_SECS (60*60)
+#define MAIL_INDEX_SHM_EXPIRE_STAMP_FNAME ".expire.stamp"
+#define MAIL_INDEX_SHM_TMP_INFIX ".tmp."
+
+/* How many times to retry reading the index file when it's being
+   overwritten in place, and how long to wait between the tries. */
+#define MAIL_INDEX_INPLACE_READ_RETRY_COUNT 50
+#define MAIL_INDEX_INPLACE_READ_RETRY_MSECS 20
 
 #define MAIL_INDEX_IS_IN_MEMORY(index) \
 	((index)->dir == NULL)
@@ -34,9 +52,21 @@ struct mail_index_sync_map_ctx;
 #define MAIL_INDEX_MAP_IS_IN_MEMORY(map) \
 	((map)->rec_map->mmap_base == NULL)
 
+/* Records are stored in chunks of MAIL_INDEX_RECORD_CHUNK_COUNT records.
+   In-memory chunks are shared between record maps, so making a map private
+   copies only the chunks that are modified afterwards. */
+#define MAIL_INDEX_RECORD_CHUNK_SHIFT 10
+#define MAIL_INDEX_RECORD_CHUNK_COUNT (1U << MAIL_INDEX_RECORD_CHUNK_SHIFT)
+#define MAIL_INDEX_RECORD_CHUNK_MASK (MAIL_INDEX_RECORD_CHUNK_COUNT-1)
+
+/* Returns the record for reading. Use mail_index_map_idx_modifiable() for
+   modifying it. */
+#define MAIL_INDEX_RECORD_MAP_IDX(rec_map, record_size, idx) \
+	((const struct mail_index_record *) \
+	 PTR_OFFSET((rec_map)->chunks[(idx) >> MAIL_INDEX_RECORD_CHUNK_SHIFT], \
+		    ((idx) & MAIL_INDEX_RECORD_CHUNK_MASK) * (record_size)))
 #define MAIL_INDEX_MAP_IDX(map, idx) \
-	((struct mail_index_record *) \
-	 PTR_OFFSET((map)->rec_map->records, (idx) * (map)->hdr.record_size))
+	MAIL_INDEX_RECORD_MAP_IDX((map)->rec_map, (map)->hdr.record_size, idx)
 
 #define MAIL_TRANSACTION_FLAG_UPDATE_IS_INTERNAL(u) \
 	((((u)->add_flags | (u)->remove_flags) & MAIL_INDEX_FLAGS_MASK) == 0 && \
@@ -120,9 +150,11 @@ struct mail_index_record_map {
 	void *mmap_base;
 	size_t mmap_size, mmap_used_size;
 
-	buffer_t *buffer;
-
-	void *records; /* struct mail_index_record[] */
+	/* struct mail_index_record[] split into chunks. With mmap they point
+	   to mmap_base, otherwise they're reference counted memory chunks
+	   that may be shared with other record maps. */
+	void **chunks;
+	unsigned int chunks_count, chunks_alloc_count;
 	unsigned int records_count;
 
 	struct mail_index_map_modseq *modseq;
@@ -159,6 +191,21 @@ union mail_index_module_context {
 	struct mail_index_module_register *reg;
 };
 
+/* Record chunks as they were last written to (or read from) dovecot.index.
+   The chunks are shared copy-on-write with the record maps, so a map chunk
+   pointer different from the written one means that its records have
+   changed since. */
+struct mail_index_written_records {
+	void **chunks;
+	unsigned int chunks_count;
+	unsigned int records_count;
+	uint32_t header_size, record_size;
+	uint32_t write_seq;
+
+	dev_t dev;
+	ino_t ino;
+};
+
 struct mail_index {
 	char *dir, *prefix;
 
@@ -196,6 +243,16 @@ struct mail_index {
 	uint32_t last_read_log_file_head_offset;
 	uint32_t last_read_log_file_tail_offset;
 	struct stat last_read_stat;
+	/* with MAIL_INDEX_OPEN_FLAG_INPLACE_WRITE, the records in the main
+	   index file or NULL if unknown */
+	struct mail_index_written_records *written;
+
+	/* directory for shared memory snapshots of the index, or NULL */
+	char *shm_dir;
+	/* the snapshot we last read or wrote and its log position */
+	char *shm_path;
+	uint32_t shm_log_file_seq;
+	uint32_t shm_log_file_head_offset;
 
 	/* transaction log head seq/offset when we last fscked */
 	uint32_t fsck_log_head_file_seq;
@@ -240,6 +297,7 @@ struct mail_index {
 	unsigned int initial_create:1;
 	unsigned int initial_mapped:1;
 	unsigned int fscked:1;
+	unsigned int shm_dir_checked:1;
 };
 
 extern struct mail_index_module_register mail_index_module_register;
@@ -295,8 +353,47 @@ struct mail_index_map *mail_index_map_clone(const struct mail_index_map *map);
 void mail_index_record_map_move_to_private(struct mail_index_map *map);
 /* Move a mmaped map to memory. */
 void mail_index_map_move_to_memory(struct mail_index_map *map);
+
+/* Replace map's records with records_count records. If the map is mmaped,
+   they point to the records after the header. Otherwise they're zero-filled
+   memory private to the map. */
+void mail_index_record_map_init_records(struct mail_index_map *map,
+					unsigned int records_count);
+/* Free the record chunks of the record map. */
+void mail_index_record_map_free_chunks(struct mail_index_record_map *rec_map);
+/* Returns the record for modification. If its chunk is shared with another
+   record map, the chunk is copied first. */
+struct mail_index_record *
+mail_index_map_idx_modifiable(struct mail_index_map *map, uint32_t idx);
+/* Returns space for a new record after the last record. records_count
+   isn't updated. */
+void *mail_index_record_map_append_space(struct mail_index_map *map);
+/* Delete count records starting from idx. */
+void mail_index_record_map_delete(struct mail_index_map *map,
+				  uint32_t idx, uint32_t count);
+/* Remember map's records as the ones currently in the index file with
+   the given stat. Does nothing unless in-place writes are enabled. */
+void mail_index_written_records_set(struct mail_index *index,
+				    struct mail_index_map *map,
+				    const struct stat *st);
+void mail_index_written_records_free(struct mail_index *index);
 void mail_index_fchown(struct mail_index *index, int fd, const char *path);
 
+/* Returns the shared memory snapshot path for the index file with the
+   given stat. The path is based on the index path and the inode. */
+const char *mail_index_get_shm_path(struct mail_index *index,
+				    const struct stat *st);
+/* Make sure that shm_dir is a directory private to us, so that other users
+   can't replace or read the snapshots. If it isn't, an error is logged and
+   the snapshots are disabled for the index. Returns 1 if the directory is
+   usable, 0 if it doesn't exist and -1 if snapshots were disabled. */
+int mail_index_shm_dir_check(struct mail_index *index);
+/* Write the current mapping to the shared memory snapshot, unless it hasn't
+   changed enough since the last snapshot or index write. */
+void mail_index_write_shm(struct mail_index *index);
+/* Delete the snapshot of the current index file. */
+void mail_index_unlink_shm(struct mail_index *index);
+
 bool mail_index_map_lookup_ext(struct mail_index_map *map, const char *name,
 			       uint32_t *idx_r);
 uint32_t
@@ -144,11 +144,11 @@ static void sync_ext_reorder(struct mail_index_map *map, uint32_t ext_map_idx,
 	struct mail_index_ext *ext, **sorted;
 	struct mail_index_ext_header *ext_hdr;
 	uint16_t *old_offsets, *copy_sizes, min_align, max_align;
-	uint32_t offset, new_record_size, rec_idx;
+	struct mail_index_record_map old_rec_map;
+	uint32_t offset, old_record_size, new_record_size, rec_idx;
 	unsigned int i, count;
 	const void *src;
-	buffer_t *new_buffer;
-	size_t new_buffer_size;
+	void *dest;
 
 	i_assert(MAIL_INDEX_MAP_IS_IN_MEMORY(map) && map->refcount == 1);
 
@@ -215,38 +215,30 @@ static void sync_ext_reorder(struct mail_index_map *map, uint32_t ext_map_idx,
 	}
 	new_record_size = offset;
 
-	/* copy the records to new buffer */
-	new_buffer_size = map->rec_map->records_count * new_record_size;
-	new_buffer = buffer_create_dynamic(default_pool, new_buffer_size);
-	src = map->rec_map->records;
-	offset = 0;
-	for (rec_idx = 0; rec_idx < map->rec_map->records_count; rec_idx++) {
+	/* copy the records to new chunks */
+	old_rec_map = *map->rec_map;
+	map->rec_map->chunks = NULL;
+	map->rec_map->chunks_count = map->rec_map->chunks_alloc_count = 0;
+	old_record_size = map->hdr.record_size;
+	map->hdr.record_size = new_record_size;
+	mail_index_record_map_init_records(map, old_rec_map.records_count);
+
+	for (rec_idx = 0; rec_idx < old_rec_map.records_count; rec_idx++) {
+		src = MAIL_INDEX_RECORD_MAP_IDX(&old_rec_map, old_record_size,
+						rec_idx);
+		dest = mail_index_map_idx_modifiable(map, rec_idx);
+
 		/* write the base record */
-		buffer_write(new_buffer, offset, src,
-			     sizeof(struct mail_index_record));
+		memcpy(dest, src, sizeof(struct mail_index_record));
 
 		/* write extensions */
 		for (i = 0; i < count; i++) {
-			buffer_write(new_buffer, offset + ext[i].record_offset,
-				     CONST_PTR_OFFSET(src, old_offsets[i]),
-				     copy_sizes[i]);
+			memcpy(PTR_OFFSET(dest, ext[i].record_offset),
+			       CONST_PTR_OFFSET(src, old_offsets[i]),
+			       copy_sizes[i]);
 		}
-		src = CONST_PTR_OFFSET(src, map->hdr.record_size);
-		offset += new_record_size;
 	}
-
-	if (new_buffer->used != new_buffer_size) {
-		/* we didn't fully write the last record */
-		size_t space = new_buffer_size - new_buffer->used;
-		i_assert(space < new_record_size);
-		buffer_append_zero(new_buffer, space);
-	}
-
-	buffer_free(&map->rec_map->buffer);
-	map->rec_map->buffer = new_buffer;
-	map->rec_map->records =
-		buffer_get_modifiable_data(map->rec_map->buffer, NULL);
-	map->hdr.record_size = new_record_size;
+	mail_index_record_map_free_chunks(&old_rec_map);
 
 	/* update record offsets in headers */
 	for (i = 0; i < count; i++) {
@@ -573,7 +565,7 @@ static void mail_index_sync_ext_clear(struct mail_index_view *view,
 	map->hdr_base = map->hdr_copy_buf->data;
 
 	for (i = 0; i < view->map->rec_map->records_count; i++) {
-		rec = MAIL_INDEX_MAP_IDX(view->map, i);
+		rec = mail_index_map_idx_modifiable(view->map, i);
 		memset(PTR_OFFSET(rec, ext->record_offset), 0,
 		       ext->record_size);
 	}
@@ -673,7 +665,7 @@ mail_index_sync_ext_rec_update(struct mail_index_sync_map_ctx *ctx,
 	i_assert(ext->record_offset + ext->record_size <=
 		 view->map->hdr.record_size);
 
-	rec = MAIL_INDEX_MAP_IDX(view->map, seq-1);
+	rec = mail_index_map_idx_modifiable(view->map, seq-1);
 	old_data = PTR_OFFSET(rec, ext->record_offset);
 
 	rext = array_idx(&view->index->extensions, ext->index_idx);
@@ -724,7 +716,7 @@ mail_index_sync_ext_atomic_inc(struct mail_index_sync_map_ctx *ctx,
 	i_assert(ext->record_offset + ext->record_size <=
 		 view->map->hdr.record_size);
 
-	rec = MAIL_INDEX_MAP_IDX(view->map, seq-1);
+	rec = mail_index_map_idx_modifiable(view->map, seq-1);
 	data = PTR_OFFSET(rec, ext->record_offset);
 
 	min_value = u->diff >= 0 ? 0 : (uint64_t)(-(int64_t)u->diff);
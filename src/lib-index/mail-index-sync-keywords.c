@@ -230,7 +230,7 @@ keywords_update_records(struct mail_index_sync_map_ctx *ctx,
 	switch (type) {
 	case MODIFY_ADD:
 		for (seq1--; seq1 < seq2; seq1++) {
-			rec = MAIL_INDEX_MAP_IDX(view->map, seq1);
+			rec = mail_index_map_idx_modifiable(view->map, seq1);
 			data = PTR_OFFSET(rec, data_offset);
 			*data |= data_mask;
 		}
@@ -238,7 +238,7 @@ keywords_update_records(struct mail_index_sync_map_ctx *ctx,
 	case MODIFY_REMOVE:
 		data_mask = ~data_mask;
 		for (seq1--; seq1 < seq2; seq1++) {
-			rec = MAIL_INDEX_MAP_IDX(view->map, seq1);
+			rec = mail_index_map_idx_modifiable(view->map, seq1);
 			data = PTR_OFFSET(rec, data_offset);
 			*data &= data_mask;
 		}
@@ -340,7 +340,7 @@ mail_index_sync_keywords_reset(struct mail_index_sync_map_ctx *ctx,
 		map->rec_map->records_changed = TRUE;
 		mail_index_modseq_reset_keywords(ctx->modseq_ctx, seq1, seq2);
 		for (seq1--; seq1 < seq2; seq1++) {
-			rec = MAIL_INDEX_MAP_IDX(map, seq1);
+			rec = mail_index_map_idx_modifiable(map, seq1);
 			memset(PTR_OFFSET(rec, ext->record_offset),
 			       0, ext->record_size);
 		}
@@ -204,7 +204,7 @@ sync_expunge_call_handlers(struct mail_index_sync_map_ctx *ctx,
 			   uint32_t seq1, uint32_t seq2)
 {
 	const struct mail_index_expunge_handler *eh;
-	struct mail_index_record *rec;
+	const struct mail_index_record *rec;
 	uint32_t seq;
 
 	/* call expunge handlers only when syncing index file */
@@ -225,7 +225,7 @@ sync_expunge_call_handlers(struct mail_index_sync_map_ctx *ctx,
 			   handler returns failure.. should it be just changed
 			   to return void? */
 			(void)eh->handler(ctx, seq,
-					  PTR_OFFSET(rec, eh->record_offset),
+					  CONST_PTR_OFFSET(rec, eh->record_offset),
 					  eh->sync_context, eh->context);
 		}
 	}
@@ -235,7 +235,7 @@ static void
 sync_expunge(struct mail_index_sync_map_ctx *ctx, uint32_t uid1, uint32_t uid2)
 {
 	struct mail_index_map *map;
-	struct mail_index_record *rec;
+	const struct mail_index_record *rec;
 	uint32_t seq_count, seq, seq1, seq2;
 
 	if (!mail_index_lookup_seq_range(ctx->view, uid1, uid2, &seq1, &seq2)) {
@@ -252,30 +252,12 @@ sync_expunge(struct mail_index_sync_map_ctx *ctx, uint32_t uid1, uint32_t uid2)
 						     0, FALSE);
 	}
 
-	/* @UNSAFE */
-	memmove(MAIL_INDEX_MAP_IDX(map, seq1-1),
-		MAIL_INDEX_MAP_IDX(map, seq2),
-		(map->rec_map->records_count - seq2) * map->hdr.record_size);
-
 	seq_count = seq2 - seq1 + 1;
-	map->rec_map->records_count -= seq_count;
+	mail_index_record_map_delete(map, seq1-1, seq_count);
 	map->hdr.messages_count -= seq_count;
 	mail_index_modseq_expunge(ctx->modseq_ctx, seq1, seq2);
 }
 
-static void *sync_append_record(struct mail_index_map *map)
-{
-	size_t append_pos;
-	void *ret;
-
-	append_pos = map->rec_map->records_count * map->hdr.record_size;
-	ret = buffer_get_space_unsafe(map->rec_map->buffer, append_pos,
-				      map->hdr.record_size);
-	map->rec_map->records =
-		buffer_get_modifiable_data(map->rec_map->buffer, NULL);
-	return ret;
-}
-
 static bool sync_update_ignored_change(struct mail_index_sync_map_ctx *ctx)
 {
 	struct mail_index_transaction_commit_result *result =
@@ -370,9 +352,7 @@ static int sync_append(const struct mail_index_record *rec,
 		i_assert(old_rec->uid == rec->uid);
 		new_flags = old_rec->flags;
 	} else {
-		/* don't rely on buffer->used being at the correct position.
-		   at least expunges can move it */
-		dest = sync_append_record(map);
+		dest = mail_index_record_map_append_space(map);
 		memcpy(dest, rec, sizeof(*rec));
 		memset(PTR_OFFSET(dest, sizeof(*rec)), 0,
 		       map->hdr.record_size - sizeof(*rec));
@@ -424,12 +404,12 @@ static int sync_flag_update(const struct mail_transaction_flag_update *u,
 	     (MAIL_SEEN | MAIL_DELETED)) == 0) {
 		/* we're not modifying any counted/lowwatered flags */
 		for (idx = seq1-1; idx < seq2; idx++) {
-			rec = MAIL_INDEX_MAP_IDX(view->map, idx);
+			rec = mail_index_map_idx_modifiable(view->map, idx);
 			rec->flags = (rec->flags & flag_mask) | u->add_flags;
 		}
 	} else {
 		for (idx = seq1-1; idx < seq2; idx++) {
-			rec = MAIL_INDEX_MAP_IDX(view->map, idx);
+			rec = mail_index_map_idx_modifiable(view->map, idx);
 
 			old_flags = rec->flags;
 			rec->flags = (rec->flags & flag_mask) | u->add_flags;
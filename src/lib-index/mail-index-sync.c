@@ -242,6 +242,16 @@ mail_index_sync_read_and_sort(struct mail_index_sync_ctx *ctx)
 	return ret;
 }
 
+static bool mail_index_sync_want_cache_compress(struct mail_index *index)
+{
+	if ((index->flags &
+	     MAIL_INDEX_OPEN_FLAG_CACHE_COMPRESS_BACKGROUND) != 0) {
+		/* someone else does it for us */
+		return FALSE;
+	}
+	return mail_cache_need_compress(index->cache);
+}
+
 static bool
 mail_index_need_sync(struct mail_index *index, enum mail_index_sync_flags flags,
 		     uint32_t log_file_seq, uoff_t log_file_offset)
@@ -273,7 +283,7 @@ mail_index_need_sync(struct mail_index *index, enum mail_index_sync_flags flags,
 		return TRUE;
 
 	/* already synced */
-	return mail_cache_need_compress(index->cache);
+	return mail_index_sync_want_cache_compress(index);
 }
 
 static int
@@ -793,7 +803,7 @@ int mail_index_sync_commit(struct mail_index_sync_ctx **_ctx)
 	}
 
 	mail_index_sync_update_mailbox_offset(ctx);
-	if (mail_cache_need_compress(index->cache)) {
+	if (mail_index_sync_want_cache_compress(index)) {
 		/* if cache compression fails, we don't really care.
 		   the cache offsets are updated only if the compression was
 		   successful. */
@@ -836,6 +846,9 @@ int mail_index_sync_commit(struct mail_index_sync_ctx **_ctx)
 		index->need_recreate = FALSE;
 		index->index_min_write = FALSE;
 		mail_index_write(index, want_rotate);
+	} else if (ret == 0) {
+		/* let the next process skip replaying the log */
+		mail_index_write_shm(index);
 	}
 	mail_index_sync_end(_ctx);
 	return ret;
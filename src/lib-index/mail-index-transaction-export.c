@@ -314,7 +314,10 @@ static void log_append_ext_recs(struct mail_index_export_context *ctx,
 		reset_id = ext_id < reset_id_count ? reset_ids[ext_id] : 0;
 		log_append_ext_intro(ctx, ext_id, reset_id);
 
-		log_append_buffer(ctx, updates[ext_id].arr.buffer, type);
+		mail_transaction_log_append_add_records(ctx->append_ctx, type,
+			updates[ext_id].arr.buffer->data,
+			updates[ext_id].arr.buffer->used,
+			updates[ext_id].arr.element_size);
 	}
 }
 
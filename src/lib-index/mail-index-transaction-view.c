@@ -321,6 +321,145 @@ static void tview_lookup_keywords(struct mail_index_view *view, uint32_t seq,
 	}
 }
 
+static void
+tview_changed_seqs_add(ARRAY_TYPE(seq_range) *changed,
+		       uint32_t seq1, uint32_t seq2,
+		       uint32_t change_seq1, uint32_t change_seq2)
+{
+	if (change_seq1 <= seq2 && change_seq2 >= seq1) {
+		seq_range_array_add_range(changed, I_MAX(change_seq1, seq1),
+					  I_MIN(change_seq2, seq2));
+	}
+}
+
+static void
+tview_lookup_seqs_split(struct mail_index_view *view,
+			uint32_t seq1, uint32_t seq2,
+			const ARRAY_TYPE(seq_range) *changed,
+			ARRAY_TYPE(seq_range) *unchanged_r,
+			uint32_t *new_seq1_r)
+{
+	struct mail_index_view_transaction *tview =
+		(struct mail_index_view_transaction *)view;
+
+	/* existing messages without any changes in this transaction can be
+	   looked up in bulk from the parent view. the changed and the
+	   appended messages are looked up one by one. */
+	t_array_init(unchanged_r, 8);
+	if (seq1 < tview->t->first_new_seq) {
+		seq_range_array_add_range(unchanged_r, seq1,
+			I_MIN(seq2, tview->t->first_new_seq - 1));
+		seq_range_array_remove_seq_range(unchanged_r, changed);
+	}
+	*new_seq1_r = I_MAX(seq1, tview->t->first_new_seq);
+}
+
+static void
+tview_lookup_flags_seqs(struct mail_index_view *view,
+			uint32_t seq1, uint32_t seq2,
+			enum mail_flags flags, uint8_t flags_mask,
+			ARRAY_TYPE(seq_range) *seqs)
+{
+	struct mail_index_view_transaction *tview =
+		(struct mail_index_view_transaction *)view;
+	struct mail_index_transaction *t = tview->t;
+	const struct mail_index_flag_update *updates;
+	ARRAY_TYPE(seq_range) changed, unchanged;
+	const struct seq_range *range;
+	const struct mail_index_record *rec;
+	unsigned int i, count;
+	uint32_t seq, new_seq1;
+
+	t_array_init(&changed, 8);
+	if (array_is_created(&t->updates)) {
+		updates = array_get(&t->updates, &count);
+		for (i = 0; i < count; i++) {
+			tview_changed_seqs_add(&changed, seq1, seq2,
+					       updates[i].uid1,
+					       updates[i].uid2);
+		}
+	}
+	tview_lookup_seqs_split(view, seq1, seq2, &changed,
+				&unchanged, &new_seq1);
+	array_foreach(&unchanged, range) {
+		tview->super->lookup_flags_seqs(view, range->seq1,
+						range->seq2, flags,
+						flags_mask, seqs);
+	}
+	array_foreach(&changed, range) {
+		for (seq = range->seq1; seq <= range->seq2; seq++) {
+			if (seq >= t->first_new_seq)
+				break;
+			rec = mail_index_lookup(view, seq);
+			if ((rec->flags & flags_mask) == (uint8_t)flags)
+				seq_range_array_add(seqs, seq);
+		}
+	}
+	for (seq = new_seq1; seq <= seq2; seq++) {
+		rec = mail_index_transaction_lookup(t, seq);
+		if ((rec->flags & flags_mask) == (uint8_t)flags)
+			seq_range_array_add(seqs, seq);
+	}
+}
+
+static void
+tview_lookup_keywords_seqs(struct mail_index_view *view,
+			   uint32_t seq1, uint32_t seq2,
+			   const struct mail_keywords *keywords,
+			   ARRAY_TYPE(seq_range) *seqs)
+{
+	struct mail_index_view_transaction *tview =
+		(struct mail_index_view_transaction *)view;
+	struct mail_index_transaction *t = tview->t;
+	const struct mail_index_transaction_keyword_update *kw_update;
+	ARRAY_TYPE(seq_range) changed, unchanged;
+	ARRAY_TYPE(keyword_indexes) keyword_idx;
+	const struct seq_range *range;
+	uint32_t seq, new_seq1;
+
+	t_array_init(&changed, 8);
+	t_array_init(&keyword_idx, 32);
+	if (array_is_created(&t->keyword_updates)) {
+		array_foreach(&t->keyword_updates, kw_update) {
+			if (array_is_created(&kw_update->add_seq)) {
+				array_foreach(&kw_update->add_seq, range) {
+					tview_changed_seqs_add(&changed,
+						seq1, seq2,
+						range->seq1, range->seq2);
+				}
+			}
+			if (array_is_created(&kw_update->remove_seq)) {
+				array_foreach(&kw_update->remove_seq, range) {
+					tview_changed_seqs_add(&changed,
+						seq1, seq2,
+						range->seq1, range->seq2);
+				}
+			}
+		}
+	}
+	tview_lookup_seqs_split(view, seq1, seq2, &changed,
+				&unchanged, &new_seq1);
+	array_foreach(&unchanged, range) {
+		tview->super->lookup_keywords_seqs(view, range->seq1,
+						   range->seq2, keywords, seqs);
+	}
+	array_foreach(&changed, range) {
+		for (seq = range->seq1; seq <= range->seq2; seq++) {
+			if (seq >= t->first_new_seq)
+				break;
+			if (mail_index_lookup_keywords_match(view, seq,
+							     keywords,
+							     &keyword_idx))
+				seq_range_array_add(seqs, seq);
+		}
+	}
+	for (seq = new_seq1; seq <= seq2; seq++) {
+		if (mail_index_lookup_keywords_match(view, seq, keywords,
+						     &keyword_idx))
+			seq_range_array_add(seqs, seq);
+	}
+}
+
 static struct mail_index_map *
 tview_get_lookup_map(struct mail_index_view_transaction *tview)
 {
@@ -483,6 +622,8 @@ static struct mail_index_view_vfuncs trans_view_vfuncs = {
 	tview_lookup_uid,
 	tview_lookup_seq_range,
 	tview_lookup_first,
+	tview_lookup_flags_seqs,
+	tview_lookup_keywords_seqs,
 	tview_lookup_keywords,
 	tview_lookup_ext_full,
 	tview_get_header_ext,
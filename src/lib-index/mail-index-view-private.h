@@ -26,6 +26,14 @@ struct mail_index_view_vfuncs {
 	void (*lookup_first)(struct mail_index_view *view,
 			     enum mail_flags flags, uint8_t flags_mask,
 			     uint32_t *seq_r);
+	void (*lookup_flags_seqs)(struct mail_index_view *view,
+				  uint32_t seq1, uint32_t seq2,
+				  enum mail_flags flags, uint8_t flags_mask,
+				  ARRAY_TYPE(seq_range) *seqs);
+	void (*lookup_keywords_seqs)(struct mail_index_view *view,
+				     uint32_t seq1, uint32_t seq2,
+				     const struct mail_keywords *keywords,
+				     ARRAY_TYPE(seq_range) *seqs);
 	void (*lookup_keywords)(struct mail_index_view *view, uint32_t seq,
 				ARRAY_TYPE(keyword_indexes) *keyword_idx);
 	void (*lookup_ext_full)(struct mail_index_view *view, uint32_t seq,
@@ -78,6 +86,11 @@ struct mail_index_view {
 	unsigned int syncing:1;
 };
 
+bool mail_index_lookup_keywords_match(struct mail_index_view *view,
+				      uint32_t seq,
+				      const struct mail_keywords *keywords,
+				      ARRAY_TYPE(keyword_indexes) *keyword_idx);
+
 struct mail_index_view *
 mail_index_view_open_with_map(struct mail_index *index,
 			      struct mail_index_map *map);
@@ -288,6 +288,46 @@ static void view_lookup_first(struct mail_index_view *view,
 	}
 }
 
+static void
+view_lookup_flags_seqs(struct mail_index_view *view,
+		       uint32_t seq1, uint32_t seq2,
+		       enum mail_flags flags, uint8_t flags_mask,
+		       ARRAY_TYPE(seq_range) *seqs)
+{
+	struct mail_index_map *map = view->map;
+	const struct mail_index_record *rec;
+	uint32_t seq, match_seq1 = 0;
+
+	i_assert(seq1 > 0);
+	i_assert(seq2 <= map->hdr.messages_count);
+	i_assert(map->hdr.messages_count <= map->rec_map->records_count);
+
+	if (map != view->index->map) {
+		/* the head mapping may contain newer flags */
+		for (seq = seq1; seq <= seq2; seq++) {
+			rec = view_lookup_full(view, seq, &map, NULL);
+			if ((rec->flags & flags_mask) == (uint8_t)flags)
+				seq_range_array_add(seqs, seq);
+		}
+		return;
+	}
+
+	/* walk through the records directly and add the matches as ranges
+	   instead of one seq at a time */
+	for (seq = seq1; seq <= seq2; seq++) {
+		rec = MAIL_INDEX_MAP_IDX(map, seq-1);
+		if ((rec->flags & flags_mask) == (uint8_t)flags) {
+			if (match_seq1 == 0)
+				match_seq1 = seq;
+		} else if (match_seq1 != 0) {
+			seq_range_array_add_range(seqs, match_seq1, seq-1);
+			match_seq1 = 0;
+		}
+	}
+	if (match_seq1 != 0)
+		seq_range_array_add_range(seqs, match_seq1, seq2);
+}
+
 static void
 mail_index_data_lookup_keywords(struct mail_index_map *map,
 				const unsigned char *data,
@@ -345,6 +385,130 @@ static void view_lookup_keywords(struct mail_index_view *view, uint32_t seq,
 	mail_index_data_lookup_keywords(map, data, keyword_idx);
 }
 
+bool mail_index_lookup_keywords_match(struct mail_index_view *view,
+				      uint32_t seq,
+				      const struct mail_keywords *keywords,
+				      ARRAY_TYPE(keyword_indexes) *keyword_idx)
+{
+	const unsigned int *idx;
+	unsigned int i, j, count;
+
+	mail_index_lookup_keywords(view, seq, keyword_idx);
+	idx = array_get(keyword_idx, &count);
+
+	/* there probably aren't many keywords, so O(n*m) for now */
+	for (i = 0; i < keywords->count; i++) {
+		for (j = 0; j < count; j++) {
+			if (keywords->idx[i] == idx[j])
+				break;
+		}
+		if (j == count)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+static bool
+view_keywords_get_mask(struct mail_index_map *map,
+		       const struct mail_keywords *keywords,
+		       unsigned char *mask, unsigned int mask_size)
+{
+	const unsigned int *keyword_idx_map;
+	unsigned int i, j, keyword_count;
+
+	/* keyword_idx_map[] contains file => index keyword mapping */
+	if (!array_is_created(&map->keyword_idx_map))
+		return FALSE;
+	keyword_idx_map = array_get(&map->keyword_idx_map, &keyword_count);
+	if (keyword_count > mask_size * CHAR_BIT)
+		keyword_count = mask_size * CHAR_BIT;
+
+	memset(mask, 0, mask_size);
+	for (i = 0; i < keywords->count; i++) {
+		for (j = 0; j < keyword_count; j++) {
+			if (keyword_idx_map[j] == keywords->idx[i])
+				break;
+		}
+		if (j == keyword_count) {
+			/* keyword doesn't exist in this map,
+			   so no message can have it */
+			return FALSE;
+		}
+		mask[j / CHAR_BIT] |= 1 << (j % CHAR_BIT);
+	}
+	return TRUE;
+}
+
+static void
+view_lookup_keywords_seqs(struct mail_index_view *view,
+			  uint32_t seq1, uint32_t seq2,
+			  const struct mail_keywords *keywords,
+			  ARRAY_TYPE(seq_range) *seqs)
+{
+	struct mail_index_map *map = view->map;
+	ARRAY_TYPE(keyword_indexes) keyword_idx;
+	const struct mail_index_ext *ext;
+	const struct mail_index_record *rec;
+	const unsigned char *data;
+	unsigned char *mask;
+	unsigned int i, first, last;
+	uint32_t seq, ext_idx, match_seq1 = 0;
+
+	i_assert(seq1 > 0);
+	i_assert(seq2 <= map->hdr.messages_count);
+
+	if (seq1 > seq2)
+		return;
+	if (keywords->count == 0) {
+		seq_range_array_add_range(seqs, seq1, seq2);
+		return;
+	}
+	if (map != view->index->map) {
+		/* the head mapping may contain newer keywords */
+		t_array_init(&keyword_idx, 32);
+		for (seq = seq1; seq <= seq2; seq++) {
+			if (mail_index_lookup_keywords_match(view, seq, keywords,
+							     &keyword_idx))
+				seq_range_array_add(seqs, seq);
+		}
+		return;
+	}
+
+	if (!mail_index_map_get_ext_idx(map, view->index->keywords_ext_id,
+					&ext_idx))
+		return;
+	ext = array_idx(&map->extensions, ext_idx);
+	if (ext->record_offset == 0 || ext->record_size == 0)
+		return;
+
+	/* translate the keywords to a bitmask matching the records'
+	   keyword bytes. then we only need to compare the bytes that
+	   have any bits set in the mask. */
+	mask = t_malloc(ext->record_size);
+	if (!view_keywords_get_mask(map, keywords, mask, ext->record_size))
+		return;
+	for (first = 0; mask[first] == 0; first++) ;
+	for (last = ext->record_size-1; mask[last] == 0; last--) ;
+
+	for (seq = seq1; seq <= seq2; seq++) {
+		rec = MAIL_INDEX_MAP_IDX(map, seq-1);
+		data = CONST_PTR_OFFSET(rec, ext->record_offset);
+		for (i = first; i <= last; i++) {
+			if ((data[i] & mask[i]) != mask[i])
+				break;
+		}
+		if (i > last) {
+			if (match_seq1 == 0)
+				match_seq1 = seq;
+		} else if (match_seq1 != 0) {
+			seq_range_array_add_range(seqs, match_seq1, seq-1);
+			match_seq1 = 0;
+		}
+	}
+	if (match_seq1 != 0)
+		seq_range_array_add_range(seqs, match_seq1, seq2);
+}
+
 static const void *
 view_map_lookup_ext_full(struct mail_index_map *map,
 			 const struct mail_index_record *rec, uint32_t ext_id)
@@ -529,6 +693,26 @@ void mail_index_lookup_first(struct mail_index_view *view,
 	view->v.lookup_first(view, flags, flags_mask, seq_r);
 }
 
+void mail_index_lookup_flags_seqs(struct mail_index_view *view,
+				  uint32_t seq1, uint32_t seq2,
+				  enum mail_flags flags, uint8_t flags_mask,
+				  ARRAY_TYPE(seq_range) *seqs)
+{
+	if (seq1 <= seq2) {
+		view->v.lookup_flags_seqs(view, seq1, seq2, flags, flags_mask,
+					  seqs);
+	}
+}
+
+void mail_index_lookup_keywords_seqs(struct mail_index_view *view,
+				     uint32_t seq1, uint32_t seq2,
+				     const struct mail_keywords *keywords,
+				     ARRAY_TYPE(seq_range) *seqs)
+{
+	if (seq1 <= seq2)
+		view->v.lookup_keywords_seqs(view, seq1, seq2, keywords, seqs);
+}
+
 void mail_index_lookup_ext(struct mail_index_view *view, uint32_t seq,
 			   uint32_t ext_id, const void **data_r,
 			   bool *expunged_r)
@@ -596,6 +780,8 @@ static struct mail_index_view_vfuncs view_vfuncs = {
 	view_lookup_uid,
 	view_lookup_seq_range,
 	view_lookup_first,
+	view_lookup_flags_seqs,
+	view_lookup_keywords_seqs,
 	view_lookup_keywords,
 	view_lookup_ext_full,
 	view_get_header_ext,
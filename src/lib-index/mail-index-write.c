@@ -1,17 +1,29 @@
 /* Copyright (c) 2003-2013 Dovecot authors, see the included COPYING file */
 
 #include "lib.h"
+#include "ioloop.h"
+#include "str.h"
+#include "hex-binary.h"
+#include "md5.h"
 #include "read-full.h"
 #include "write-full.h"
 #include "ostream.h"
+#include "safe-mkstemp.h"
 #include "mail-index-private.h"
 #include "mail-transaction-log-private.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <dirent.h>
+#include <utime.h>
+#include <sys/stat.h>
 
 #define MAIL_INDEX_MIN_UPDATE_SIZE 1024
 /* if we're updating >= count-n messages, recreate the index */
 #define MAIL_INDEX_MAX_OVERWRITE_NEG_SEQ_COUNT 10
+/* if more than this percentage of the record chunks have changed,
+   recreate the index instead of overwriting it */
+#define MAIL_INDEX_INPLACE_MAX_CHANGED_PERCENTAGE 50
 
 static int mail_index_create_backup(struct mail_index *index)
 {
@@ -57,20 +69,12 @@ static int mail_index_create_backup(struct mail_index *index)
 	return 0;
 }
 
-static int mail_index_recreate(struct mail_index *index)
+static int
+mail_index_write_map_fd(struct mail_index_map *map, int fd, const char *path)
 {
-	struct mail_index_map *map = index->map;
 	struct ostream *output;
-	unsigned int base_size;
-	const char *path;
-	int ret = 0, fd;
-
-	i_assert(!MAIL_INDEX_IS_IN_MEMORY(index));
-	i_assert(map->hdr.indexid == index->indexid);
-
-	fd = mail_index_create_tmp_file(index, &path);
-	if (fd == -1)
-		return -1;
+	unsigned int base_size, i, count;
+	int ret = 0;
 
 	output = o_stream_create_fd_file(fd, 0, FALSE);
 	o_stream_cork(output);
@@ -79,14 +83,36 @@ static int mail_index_recreate(struct mail_index *index)
 	o_stream_nsend(output, &map->hdr, base_size);
 	o_stream_nsend(output, CONST_PTR_OFFSET(map->hdr_base, base_size),
 		       map->hdr.header_size - base_size);
-	o_stream_nsend(output, map->rec_map->records,
-		       map->rec_map->records_count * map->hdr.record_size);
+	for (i = 0; i < map->rec_map->records_count; i += count) {
+		count = I_MIN(map->rec_map->records_count - i,
+			      MAIL_INDEX_RECORD_CHUNK_COUNT);
+		o_stream_nsend(output, MAIL_INDEX_MAP_IDX(map, i),
+			       count * map->hdr.record_size);
+	}
 	o_stream_nflush(output);
 	if (o_stream_nfinish(output) < 0) {
-		mail_index_file_set_syscall_error(index, path, "write()");
+		mail_index_file_set_syscall_error(map->index, path, "write()");
 		ret = -1;
 	}
 	o_stream_destroy(&output);
+	return ret;
+}
+
+static int mail_index_recreate(struct mail_index *index)
+{
+	struct mail_index_map *map = index->map;
+	struct stat st;
+	const char *path;
+	int ret = 0, fd;
+
+	i_assert(!MAIL_INDEX_IS_IN_MEMORY(index));
+	i_assert(map->hdr.indexid == index->indexid);
+
+	fd = mail_index_create_tmp_file(index, &path);
+	if (fd == -1)
+		return -1;
+
+	ret = mail_index_write_map_fd(map, fd, path);
 
 	if (ret == 0 && index->fsync_mode != FSYNC_MODE_NEVER) {
 		if (fdatasync(fd) < 0) {
@@ -95,6 +121,10 @@ static int mail_index_recreate(struct mail_index *index)
 			ret = -1;
 		}
 	}
+	if (ret == 0 && fstat(fd, &st) < 0) {
+		mail_index_file_set_syscall_error(index, path, "fstat()");
+		ret = -1;
+	}
 
 	if (close(fd) < 0) {
 		mail_index_file_set_syscall_error(index, path, "close()");
@@ -115,10 +145,470 @@ static int mail_index_recreate(struct mail_index *index)
 			mail_index_set_error(index, "unlink(%s) failed: %m",
 					     path);
 		}
+	} else {
+		mail_index_written_records_set(index, map, &st);
+	}
+	return ret;
+}
+
+static int
+mail_index_write_seq(struct mail_index *index, int fd, uint32_t seq)
+{
+	if (pwrite_full(fd, &seq, sizeof(seq),
+			offsetof(struct mail_index_header, write_seq)) < 0) {
+		mail_index_set_syscall_error(index, "pwrite_full()");
+		return -1;
+	}
+	return 0;
+}
+
+static int
+mail_index_write_inplace_records(struct mail_index *index, int fd,
+				 uint32_t write_seq)
+{
+	struct mail_index_map *map = index->map;
+	struct mail_index_record_map *rec_map = map->rec_map;
+	struct mail_index_written_records *written = index->written;
+	struct mail_index_header hdr;
+	buffer_t *buf;
+	unsigned int i, count;
+	uoff_t offset;
+
+	/* the header first, so that a reader seeing the odd write_seq in
+	   the header knows that it needs to retry */
+	hdr = map->hdr;
+	hdr.write_seq = write_seq;
+	buf = buffer_create_dynamic(pool_datastack_create(), hdr.header_size);
+	buffer_append(buf, &hdr, sizeof(hdr));
+	buffer_append(buf, CONST_PTR_OFFSET(map->hdr_base, sizeof(hdr)),
+		      hdr.header_size - sizeof(hdr));
+	if (pwrite_full(fd, buf->data, buf->used, 0) < 0) {
+		mail_index_set_syscall_error(index, "pwrite_full()");
+		return -1;
+	}
+
+	for (i = 0; i < rec_map->chunks_count; i++) {
+		if (i < written->chunks_count &&
+		    rec_map->chunks[i] == written->chunks[i])
+			continue;
+
+		count = I_MIN(rec_map->records_count -
+			      (i << MAIL_INDEX_RECORD_CHUNK_SHIFT),
+			      MAIL_INDEX_RECORD_CHUNK_COUNT);
+		offset = hdr.header_size +
+			((uoff_t)i << MAIL_INDEX_RECORD_CHUNK_SHIFT) *
+			hdr.record_size;
+		if (pwrite_full(fd, rec_map->chunks[i],
+				(size_t)count * hdr.record_size, offset) < 0) {
+			mail_index_set_syscall_error(index, "pwrite_full()");
+			return -1;
+		}
+	}
+	if (rec_map->records_count < written->records_count) {
+		offset = hdr.header_size +
+			(uoff_t)rec_map->records_count * hdr.record_size;
+		if (ftruncate(fd, offset) < 0) {
+			mail_index_set_syscall_error(index, "ftruncate()");
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static bool mail_index_can_write_inplace(struct mail_index *index)
+{
+	struct mail_index_map *map = index->map;
+	struct mail_index_record_map *rec_map = map->rec_map;
+	struct mail_index_written_records *written = index->written;
+	unsigned int i, changed_count = 0;
+
+	if (written == NULL || rec_map->mmap_base != NULL)
+		return FALSE;
+	if (map->hdr.base_header_size != sizeof(map->hdr) ||
+	    map->hdr.header_size != written->header_size ||
+	    map->hdr.record_size != written->record_size) {
+		/* header or record layout changed */
+		return FALSE;
+	}
+
+	for (i = 0; i < rec_map->chunks_count; i++) {
+		if (i >= written->chunks_count ||
+		    rec_map->chunks[i] != written->chunks[i])
+			changed_count++;
+	}
+	return changed_count * 100 <=
+		rec_map->chunks_count * MAIL_INDEX_INPLACE_MAX_CHANGED_PERCENTAGE;
+}
+
+/* Overwrite only the changed record chunks of the existing index file.
+   Returns 1 if written, 0 if the file needs to be recreated instead,
+   -1 if error. */
+static int mail_index_write_inplace(struct mail_index *index)
+{
+	struct mail_index_written_records *written = index->written;
+	struct stat st;
+	uint32_t write_seq;
+	int fd, ret = 1;
+
+	if (!mail_index_can_write_inplace(index))
+		return 0;
+
+	fd = open(index->filepath, O_RDWR);
+	if (fd == -1) {
+		if (errno == ENOENT)
+			return 0;
+		mail_index_set_syscall_error(index, "open()");
+		return -1;
+	}
+	if (fstat(fd, &st) < 0) {
+		mail_index_set_syscall_error(index, "fstat()");
+		ret = -1;
+	} else if (st.st_ino != written->ino ||
+		   !CMP_DEV_T(st.st_dev, written->dev)) {
+		/* recreated by someone else */
+		ret = 0;
+	} else if (pread_full(fd, &write_seq, sizeof(write_seq),
+			offsetof(struct mail_index_header, write_seq)) <= 0) {
+		ret = 0;
+	} else if (write_seq != written->write_seq) {
+		/* written by someone else, or an earlier write was
+		   interrupted */
+		ret = 0;
+	}
+
+	if (ret > 0) T_BEGIN {
+		write_seq++;
+		if (mail_index_write_seq(index, fd, write_seq) < 0 ||
+		    mail_index_write_inplace_records(index, fd, write_seq) < 0)
+			ret = -1;
+		else if (index->fsync_mode != FSYNC_MODE_NEVER &&
+			 fdatasync(fd) < 0) {
+			mail_index_set_syscall_error(index, "fdatasync()");
+			ret = -1;
+		}
+	} T_END;
+	if (ret > 0) {
+		/* the records are consistent with the header again. make
+		   sure a crash doesn't leave the odd write_seq behind. */
+		write_seq++;
+		if (mail_index_write_seq(index, fd, write_seq) < 0)
+			ret = -1;
+		else if (index->fsync_mode != FSYNC_MODE_NEVER &&
+			 fdatasync(fd) < 0) {
+			mail_index_set_syscall_error(index, "fdatasync()");
+			ret = -1;
+		}
+	}
+	if (close(fd) < 0) {
+		mail_index_set_syscall_error(index, "close()");
+		ret = -1;
+	}
+	if (ret > 0) {
+		index->map->hdr.write_seq = write_seq;
+		mail_index_written_records_set(index, index->map, &st);
 	}
 	return ret;
 }
 
+static bool
+mail_index_shm_is_up_to_date(const struct mail_index_map *map,
+			     uint32_t log_file_seq, uint32_t log_file_head_offset)
+{
+	const struct mail_index_header *hdr = &map->hdr;
+	uoff_t min_write_bytes;
+
+	/* the whole index is written to the snapshot, so with large indexes
+	   wait for a proportionally larger log to replay */
+	min_write_bytes = (hdr->header_size +
+			   (uoff_t)map->rec_map->records_count *
+			   hdr->record_size) /
+		MAIL_INDEX_SHM_WRITE_INDEX_SIZE_DIVISOR;
+	if (min_write_bytes < MAIL_INDEX_SHM_MIN_WRITE_BYTES)
+		min_write_bytes = MAIL_INDEX_SHM_MIN_WRITE_BYTES;
+
+	return hdr->log_file_seq == log_file_seq &&
+		hdr->log_file_head_offset >= log_file_head_offset &&
+		hdr->log_file_head_offset - log_file_head_offset <
+		min_write_bytes;
+}
+
+static int mail_index_shm_mkdir(struct mail_index *index)
+{
+	int ret;
+
+	if ((ret = mail_index_shm_dir_check(index)) != 0)
+		return ret < 0 ? -1 : 0;
+
+	/* the parent directory is usually shared by all users, so it's up
+	   to the admin to create it with safe permissions */
+	if (mkdir(index->shm_dir, 0700) < 0 && errno != EEXIST) {
+		mail_index_file_set_syscall_error(index, index->shm_dir,
+						  "mkdir()");
+		i_free_and_null(index->shm_dir);
+		return -1;
+	}
+	return mail_index_shm_dir_check(index) > 0 ? 0 : -1;
+}
+
+static int
+mail_index_shm_create_tmp_file(struct mail_index *index, const char *path,
+			       const char **tmp_path_r)
+{
+	string_t *str;
+	int fd;
+
+	if (mail_index_shm_mkdir(index) < 0)
+		return -1;
+
+	str = t_str_new(256);
+	str_printfa(str, "%s"MAIL_INDEX_SHM_TMP_INFIX, path);
+	fd = safe_mkstemp_group(str, index->mode, index->gid,
+				index->gid_origin);
+	if (fd == -1 && errno == ENOENT) {
+		/* the directory was deleted */
+		index->shm_dir_checked = FALSE;
+		if (mail_index_shm_mkdir(index) < 0)
+			return -1;
+		str_truncate(str, 0);
+		str_printfa(str, "%s"MAIL_INDEX_SHM_TMP_INFIX, path);
+		fd = safe_mkstemp_group(str, index->mode, index->gid,
+					index->gid_origin);
+	}
+	if (fd == -1) {
+		mail_index_file_set_syscall_error(index, str_c(str),
+						  "safe_mkstemp()");
+		return -1;
+	}
+	*tmp_path_r = str_c(str);
+	return fd;
+}
+
+static int
+mail_index_shm_write_trailer(struct mail_index *index, int fd,
+			     const char *tmp_path)
+{
+	struct stat st;
+
+	/* the index path is written after the map, so that expiring can find
+	   out whether the index still exists */
+	if (fstat(fd, &st) < 0) {
+		mail_index_file_set_syscall_error(index, tmp_path, "fstat()");
+		return -1;
+	}
+	if (pwrite_full(fd, index->filepath, strlen(index->filepath) + 1,
+			st.st_size) < 0) {
+		mail_index_file_set_syscall_error(index, tmp_path,
+						  "pwrite_full()");
+		return -1;
+	}
+	return 0;
+}
+
+static bool
+mail_index_shm_is_orphan(const char *fname, const char *path)
+{
+	struct mail_index_header hdr;
+	unsigned char digest[MD5_RESULTLEN];
+	char index_path[PATH_MAX];
+	unsigned long long ino;
+	const char *p;
+	char *end;
+	struct stat st;
+	ssize_t ret;
+	int fd;
+
+	if (strstr(fname, MAIL_INDEX_SHM_TMP_INFIX) != NULL) {
+		/* temp file left behind by a crashed process */
+		return TRUE;
+	}
+	/* <md5 of the index path>.<index inode> */
+	p = strchr(fname, '.');
+	if (p == NULL || p - fname != MD5_RESULTLEN*2)
+		return FALSE;
+	ino = strtoull(p + 1, &end, 16);
+	if (p[1] == '\0' || *end != '\0')
+		return FALSE;
+
+	fd = open(path, O_RDONLY | O_NOFOLLOW);
+	if (fd == -1) {
+		if (errno != ENOENT)
+			i_error("open(%s) failed: %m", path);
+		return FALSE;
+	}
+	ret = pread_full(fd, &hdr, sizeof(hdr), 0);
+	if (ret > 0) {
+		ret = pread(fd, index_path, sizeof(index_path),
+			    hdr.header_size +
+			    (uoff_t)hdr.messages_count * hdr.record_size);
+	}
+	i_close_fd(&fd);
+	if (ret < 0) {
+		i_error("pread(%s) failed: %m", path);
+		return FALSE;
+	}
+	if (ret == 0 || memchr(index_path, '\0', ret) == NULL) {
+		/* truncated or otherwise broken */
+		return TRUE;
+	}
+
+	md5_get_digest(index_path, strlen(index_path), digest);
+	if (memcmp(binary_to_hex(digest, sizeof(digest)), fname,
+		   MD5_RESULTLEN*2) != 0)
+		return TRUE;
+	if (stat(index_path, &st) < 0) {
+		if (errno == ENOENT)
+			return TRUE;
+		i_error("stat(%s) failed: %m", index_path);
+		return FALSE;
+	}
+	/* the index was recreated, so the snapshot can't be used anymore */
+	return (unsigned long long)st.st_ino != ino;
+}
+
+static void mail_index_shm_expire(struct mail_index *index)
+{
+	const char *stamp_path, *path;
+	struct dirent *d;
+	struct stat st;
+	DIR *dir;
+	int fd;
+
+	stamp_path = t_strconcat(index->shm_dir, "/",
+				 MAIL_INDEX_SHM_EXPIRE_STAMP_FNAME, NULL);
+	if (stat(stamp_path, &st) == 0) {
+		if (st.st_mtime + MAIL_INDEX_SHM_EXPIRE_INTERVAL_SECS >
+		    ioloop_time)
+			return;
+		if (utime(stamp_path, NULL) < 0) {
+			i_error("utime(%s) failed: %m", stamp_path);
+			return;
+		}
+	} else if (errno != ENOENT) {
+		i_error("stat(%s) failed: %m", stamp_path);
+		return;
+	} else {
+		/* first time - nothing old to expire yet */
+		fd = open(stamp_path, O_WRONLY | O_CREAT, index->mode);
+		if (fd == -1)
+			i_error("creat(%s) failed: %m", stamp_path);
+		else
+			i_close_fd(&fd);
+		return;
+	}
+
+	dir = opendir(index->shm_dir);
+	if (dir == NULL) {
+		i_error("opendir(%s) failed: %m", index->shm_dir);
+		return;
+	}
+	while ((d = readdir(dir)) != NULL) {
+		if (d->d_name[0] == '.')
+			continue;
+		T_BEGIN {
+			path = t_strconcat(index->shm_dir, "/",
+					   d->d_name, NULL);
+			/* skip the snapshots that were written recently.
+			   they're most likely still in use. */
+			if (lstat(path, &st) == 0 && S_ISREG(st.st_mode) &&
+			    st.st_mtime + MAIL_INDEX_SHM_EXPIRE_INTERVAL_SECS <=
+			    ioloop_time &&
+			    mail_index_shm_is_orphan(d->d_name, path)) {
+				if (unlink(path) < 0 && errno != ENOENT)
+					i_error("unlink(%s) failed: %m", path);
+			}
+		} T_END;
+	}
+	if (closedir(dir) < 0)
+		i_error("closedir(%s) failed: %m", index->shm_dir);
+}
+
+void mail_index_write_shm(struct mail_index *index)
+{
+	struct mail_index_map *map = index->map;
+	struct stat st;
+	const char *path, *tmp_path;
+	int fd, ret;
+
+	if (index->shm_dir == NULL || MAIL_INDEX_IS_IN_MEMORY(index) ||
+	    index->fd == -1 || index->readonly)
+		return;
+	if (mail_index_shm_is_up_to_date(map,
+					 index->last_read_log_file_seq,
+					 index->last_read_log_file_head_offset) ||
+	    mail_index_shm_is_up_to_date(map, index->shm_log_file_seq,
+					 index->shm_log_file_head_offset))
+		return;
+
+	if (fstat(index->fd, &st) < 0) {
+		mail_index_set_syscall_error(index, "fstat()");
+		return;
+	}
+	path = mail_index_get_shm_path(index, &st);
+	if ((fd = mail_index_shm_create_tmp_file(index, path, &tmp_path)) == -1)
+		return;
+
+	/* the snapshot is only a cache, so no need to fsync it */
+	ret = mail_index_write_map_fd(map, fd, tmp_path);
+	if (ret == 0)
+		ret = mail_index_shm_write_trailer(index, fd, tmp_path);
+	if (close(fd) < 0) {
+		mail_index_file_set_syscall_error(index, tmp_path, "close()");
+		ret = -1;
+	}
+	if (ret == 0 && rename(tmp_path, path) < 0) {
+		mail_index_set_error(index, "rename(%s, %s) failed: %m",
+				     tmp_path, path);
+		ret = -1;
+	}
+	if (ret < 0) {
+		if (unlink(tmp_path) < 0 && errno != ENOENT) {
+			mail_index_file_set_syscall_error(index, tmp_path,
+							  "unlink()");
+		}
+		return;
+	}
+
+	if (index->shm_path != NULL && strcmp(index->shm_path, path) != 0) {
+		/* the index file was recreated since the old snapshot */
+		if (unlink(index->shm_path) < 0 && errno != ENOENT) {
+			mail_index_file_set_syscall_error(index,
+				index->shm_path, "unlink()");
+		}
+	}
+	i_free(index->shm_path);
+	index->shm_path = i_strdup(path);
+	index->shm_log_file_seq = map->hdr.log_file_seq;
+	index->shm_log_file_head_offset = map->hdr.log_file_head_offset;
+
+	mail_index_shm_expire(index);
+}
+
+void mail_index_unlink_shm(struct mail_index *index)
+{
+	struct stat st;
+	const char *path;
+
+	if (index->shm_dir == NULL)
+		return;
+
+	if (index->fd != -1 && fstat(index->fd, &st) == 0) {
+		path = mail_index_get_shm_path(index, &st);
+		if (unlink(path) < 0 && errno != ENOENT)
+			mail_index_file_set_syscall_error(index, path, "unlink()");
+	} else if (!MAIL_INDEX_IS_IN_MEMORY(index)) {
+		mail_index_unlink_shm_file(index->shm_dir, index->filepath);
+	}
+	if (index->shm_path != NULL) {
+		if (unlink(index->shm_path) < 0 && errno != ENOENT) {
+			mail_index_file_set_syscall_error(index,
+				index->shm_path, "unlink()");
+		}
+		i_free_and_null(index->shm_path);
+	}
+	index->shm_log_file_seq = 0;
+	index->shm_log_file_head_offset = 0;
+}
+
 #define mail_index_map_has_changed(map) \
 	((map)->header_changed || (map)->rec_map->records_changed)
 
@@ -133,10 +623,15 @@ void mail_index_write(struct mail_index *index, bool want_rotate)
 		return;
 
 	if (!MAIL_INDEX_IS_IN_MEMORY(index)) {
-		if (mail_index_recreate(index) < 0) {
+		/* if the in-place write fails, recreating the file also
+		   replaces the partially written one */
+		if (mail_index_write_inplace(index) <= 0 &&
+		    mail_index_recreate(index) < 0) {
 			(void)mail_index_move_to_memory(index);
 			return;
 		}
+		/* the snapshot is now older than the index file */
+		mail_index_unlink_shm(index);
 	}
 
 	index->last_read_log_file_seq = hdr->log_file_seq;
@@ -7,6 +7,8 @@
 #include "eacces-error.h"
 #include "hash.h"
 #include "str-sanitize.h"
+#include "hex-binary.h"
+#include "md5.h"
 #include "mmap-util.h"
 #include "nfs-workarounds.h"
 #include "read-full.h"
@@ -79,6 +81,8 @@ void mail_index_free(struct mail_index **_index)
 	i_free(index->ext_hdr_init_data);
 	i_free(index->gid_origin);
 	i_free(index->error);
+	i_free(index->shm_dir);
+	i_free(index->shm_path);
 	i_free(index->dir);
 	i_free(index->prefix);
 	i_free(index);
@@ -92,6 +96,73 @@ void mail_index_set_fsync_mode(struct mail_index *index,
 	index->fsync_mask = mask;
 }
 
+void mail_index_set_shm_dir(struct mail_index *index, const char *dir)
+{
+	i_free(index->shm_dir);
+	index->shm_dir = i_strdup_empty(dir);
+}
+
+static const char *
+mail_index_shm_path(const char *shm_dir, const char *index_path, ino_t ino)
+{
+	unsigned char digest[MD5_RESULTLEN];
+
+	md5_get_digest(index_path, strlen(index_path), digest);
+	return t_strdup_printf("%s/%s.%llx", shm_dir,
+			       binary_to_hex(digest, sizeof(digest)),
+			       (unsigned long long)ino);
+}
+
+const char *mail_index_get_shm_path(struct mail_index *index,
+				    const struct stat *st)
+{
+	i_assert(index->shm_dir != NULL);
+
+	return mail_index_shm_path(index->shm_dir, index->filepath,
+				   st->st_ino);
+}
+
+int mail_index_shm_dir_check(struct mail_index *index)
+{
+	struct stat st;
+
+	i_assert(index->shm_dir != NULL);
+
+	if (index->shm_dir_checked)
+		return 1;
+	if (lstat(index->shm_dir, &st) < 0) {
+		if (errno == ENOENT)
+			return 0;
+		mail_index_file_set_syscall_error(index, index->shm_dir,
+						  "lstat()");
+	} else if (!S_ISDIR(st.st_mode) || st.st_uid != geteuid() ||
+		   (st.st_mode & 077) != 0) {
+		mail_index_set_error(index, "%s isn't a directory owned by "
+			"uid %s with 0700 mode - disabling index snapshots",
+			index->shm_dir, dec2str(geteuid()));
+	} else {
+		index->shm_dir_checked = TRUE;
+		return 1;
+	}
+	i_free_and_null(index->shm_dir);
+	return -1;
+}
+
+void mail_index_unlink_shm_file(const char *shm_dir, const char *index_path)
+{
+	struct stat st;
+	const char *path;
+
+	if (stat(index_path, &st) < 0) {
+		if (errno != ENOENT)
+			i_error("stat(%s) failed: %m", index_path);
+		return;
+	}
+	path = mail_index_shm_path(shm_dir, index_path, st.st_ino);
+	if (unlink(path) < 0 && errno != ENOENT)
+		i_error("unlink(%s) failed: %m", path);
+}
+
 void mail_index_set_permissions(struct mail_index *index,
 				mode_t mode, gid_t gid, const char *gid_origin)
 {
@@ -616,6 +687,7 @@ int mail_index_open_or_create(struct mail_index *index,
 
 void mail_index_close_file(struct mail_index *index)
 {
+	mail_index_written_records_free(index);
 	if (index->file_lock != NULL)
 		file_lock_free(&index->file_lock);
 
@@ -659,6 +731,9 @@ int mail_index_unlink(struct mail_index *index)
 	if (MAIL_INDEX_IS_IN_MEMORY(index) || index->readonly)
 		return 0;
 
+	/* shared memory snapshot. this needs the main index's inode. */
+	mail_index_unlink_shm(index);
+
 	/* main index */
 	if (unlink(index->filepath) < 0 && errno != ENOENT)
 		last_errno = errno;
@@ -673,6 +748,11 @@ int mail_index_unlink(struct mail_index *index)
 	if (unlink(path) < 0 && errno != ENOENT)
 		last_errno = errno;
 
+	path = t_strconcat(index->filepath, MAIL_TRANSACTION_LOG_SUFFIX
+			   MAIL_TRANSACTION_LOG_GROUP_SYNC_SUFFIX, NULL);
+	if (unlink(path) < 0 && errno != ENOENT)
+		last_errno = errno;
+
 	/* cache */
 	path = t_strconcat(index->filepath, MAIL_CACHE_FILE_SUFFIX, NULL);
 	if (unlink(path) < 0 && errno != ENOENT)
@@ -796,6 +876,7 @@ int mail_index_move_to_memory(struct mail_index *index)
 
 	if (index->file_lock != NULL)
 		file_lock_free(&index->file_lock);
+	mail_index_written_records_free(index);
 
 	if (index->fd != -1) {
 		if (close(index->fd) < 0)
@@ -30,7 +30,22 @@ enum mail_index_open_flags {
 	MAIL_INDEX_OPEN_FLAG_NEVER_IN_MEMORY	= 0x200,
 	/* We're only going to save new messages to the index.
 	   Avoid unnecessary reads. */
-	MAIL_INDEX_OPEN_FLAG_SAVEONLY		= 0x400
+	MAIL_INDEX_OPEN_FLAG_SAVEONLY		= 0x400,
+	/* Let concurrent log appends share fdatasync()s. Each commit still
+	   returns only after its own changes have been synced. */
+	MAIL_INDEX_OPEN_FLAG_FSYNC_GROUP_COMMIT	= 0x800,
+	/* Update dovecot.index by overwriting only the changed records
+	   instead of always recreating the file. All processes accessing
+	   the index must use this flag, since mmap() is disabled with it. */
+	MAIL_INDEX_OPEN_FLAG_INPLACE_WRITE	= 0x1000,
+	/* Don't compress the cache file while syncing the index. The caller
+	   is expected to check mail_cache_need_compress() and get it done
+	   elsewhere with mail_cache_compress_external(). */
+	MAIL_INDEX_OPEN_FLAG_CACHE_COMPRESS_BACKGROUND = 0x2000,
+	/* Create new transaction log files in the packed format, which older
+	   Dovecot versions can't read. Existing log files are converted by
+	   rotating them at the next sync. */
+	MAIL_INDEX_OPEN_FLAG_LOG_PACKED		= 0x4000
 };
 
 enum mail_index_header_compat_flags {
@@ -92,7 +107,9 @@ struct mail_index_header {
 	uint32_t log_file_head_offset;
 
 	uint64_t unused_old_sync_size;
-	uint32_t unused_old_sync_stamp;
+	/* Increased before and after the file is overwritten in place, so
+	   it's odd while the records may be inconsistent with the header. */
+	uint32_t write_seq;
 
 	/* daily first UIDs that have been added to index. */
 	uint32_t day_stamp;
@@ -227,6 +244,18 @@ void mail_index_set_fsync_mode(struct mail_index *index, enum fsync_mode mode,
 			       enum mail_index_fsync_mask mask);
 void mail_index_set_permissions(struct mail_index *index,
 				mode_t mode, gid_t gid, const char *gid_origin);
+/* Keep a snapshot of the latest synced index mapping in the given directory,
+   which should be in shared memory (e.g. tmpfs). Opening the index can then
+   map the snapshot instead of reading dovecot.index and replaying all of the
+   transaction log written after it. The directory should be private to the
+   user: it's created with 0700 mode if it doesn't exist, but its parent
+   directory must already exist. If the directory isn't owned by us or it's
+   accessible by other users, the snapshots are disabled. */
+void mail_index_set_shm_dir(struct mail_index *index, const char *dir);
+/* Delete the snapshot of the given index file (e.g. dir/dovecot.index) from
+   the shm_dir. This should be called before the index is deleted or moved
+   elsewhere, since the snapshot is looked up by the index path. */
+void mail_index_unlink_shm_file(const char *shm_dir, const char *index_path);
 /* Set locking method and maximum time to wait for a lock
    (UINT_MAX = default). */
 void mail_index_set_lock_method(struct mail_index *index,
@@ -438,6 +467,19 @@ bool mail_index_lookup_seq(struct mail_index_view *view,
 void mail_index_lookup_first(struct mail_index_view *view,
 			     enum mail_flags flags, uint8_t flags_mask,
 			     uint32_t *seq_r);
+/* Add all messages in seq1..seq2 range with (mail->flags & flags_mask) ==
+   flags to seqs. This scans the records directly, so it's much faster than
+   looking up the messages one by one. */
+void mail_index_lookup_flags_seqs(struct mail_index_view *view,
+				  uint32_t seq1, uint32_t seq2,
+				  enum mail_flags flags, uint8_t flags_mask,
+				  ARRAY_TYPE(seq_range) *seqs);
+/* Add all messages in seq1..seq2 range that have all of the given keywords
+   to seqs. */
+void mail_index_lookup_keywords_seqs(struct mail_index_view *view,
+				     uint32_t seq1, uint32_t seq2,
+				     const struct mail_keywords *keywords,
+				     ARRAY_TYPE(seq_range) *seqs);
 
 /* Append a new record to index. */
 void mail_index_append(struct mail_index_transaction *t, uint32_t uid,
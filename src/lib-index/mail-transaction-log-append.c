@@ -3,14 +3,19 @@
 #include "lib.h"
 #include "array.h"
 #include "write-full.h"
+#include "file-lock.h"
 #include "mail-index-private.h"
 #include "mail-transaction-log-private.h"
 
-void mail_transaction_log_append_add(struct mail_transaction_log_append_ctx *ctx,
-				     enum mail_transaction_type type,
-				     const void *data, size_t size)
+#include <sys/stat.h>
+
+static void
+log_append_add(struct mail_transaction_log_append_ctx *ctx,
+	       enum mail_transaction_type type, const void *data, size_t size,
+	       size_t record_size)
 {
 	struct mail_transaction_header hdr;
+	buffer_t *packed;
 
 	i_assert((type & MAIL_TRANSACTION_TYPE_MASK) != 0);
 	i_assert((size % 4) == 0);
@@ -25,6 +30,18 @@ void mail_transaction_log_append_add(struct mail_transaction_log_append_ctx *ctx
 		hdr.type |= MAIL_TRANSACTION_EXPUNGE_PROT;
 	if (type == MAIL_TRANSACTION_BOUNDARY)
 		hdr.type |= MAIL_TRANSACTION_EXTERNAL;
+
+	if (MAIL_TRANSACTION_LOG_FILE_IS_PACKED(ctx->log->head) &&
+	    (ctx->log->index->flags & MAIL_INDEX_OPEN_FLAG_LOG_PACKED) != 0) {
+		packed = buffer_create_dynamic(pool_datastack_create(), 256);
+		if (mail_transaction_pack(hdr.type, data, size, record_size,
+					  packed) && packed->used < size) {
+			hdr.type = MAIL_TRANSACTION_PACKED |
+				(hdr.type & ~MAIL_TRANSACTION_TYPE_MASK);
+			data = packed->data;
+			size = packed->used;
+		}
+	}
 	hdr.size = sizeof(hdr) + size;
 	hdr.size = mail_index_uint32_to_offset(hdr.size);
 
@@ -35,6 +52,25 @@ void mail_transaction_log_append_add(struct mail_transaction_log_append_ctx *ctx
 	ctx->transaction_count++;
 }
 
+void mail_transaction_log_append_add(struct mail_transaction_log_append_ctx *ctx,
+				     enum mail_transaction_type type,
+				     const void *data, size_t size)
+{
+	T_BEGIN {
+		log_append_add(ctx, type, data, size, 0);
+	} T_END;
+}
+
+void mail_transaction_log_append_add_records(struct mail_transaction_log_append_ctx *ctx,
+					     enum mail_transaction_type type,
+					     const void *data, size_t size,
+					     size_t record_size)
+{
+	T_BEGIN {
+		log_append_add(ctx, type, data, size, record_size);
+	} T_END;
+}
+
 static int
 log_buffer_move_to_memory(struct mail_transaction_log_append_ctx *ctx)
 {
@@ -90,7 +126,12 @@ static int log_buffer_write(struct mail_transaction_log_append_ctx *ctx)
 	if ((ctx->want_fsync &&
 	     file->log->index->fsync_mode != FSYNC_MODE_NEVER) ||
 	    file->log->index->fsync_mode == FSYNC_MODE_ALWAYS) {
-		if (fdatasync(file->fd) < 0) {
+		if ((file->log->index->flags &
+		     MAIL_INDEX_OPEN_FLAG_FSYNC_GROUP_COMMIT) != 0) {
+			/* fdatasync() after the log is unlocked, so others
+			   can append while we're waiting for the disk. */
+			ctx->want_group_fsync = TRUE;
+		} else if (fdatasync(file->fd) < 0) {
 			mail_index_file_set_syscall_error(ctx->log->index,
 							  file->filepath,
 							  "fdatasync()");
@@ -198,6 +239,119 @@ mail_transaction_log_append_locked(struct mail_transaction_log_append_ctx *ctx)
 	return 0;
 }
 
+static int log_group_sync_open(struct mail_transaction_log *log)
+{
+	struct mail_index *index = log->index;
+	const char *path;
+	mode_t old_mask;
+
+	if (log->group_sync_fd != -1)
+		return 0;
+
+	path = t_strconcat(log->filepath,
+			   MAIL_TRANSACTION_LOG_GROUP_SYNC_SUFFIX, NULL);
+	old_mask = umask(0);
+	log->group_sync_fd = open(path, O_RDWR | O_CREAT, index->mode);
+	umask(old_mask);
+	if (log->group_sync_fd == -1) {
+		mail_index_file_set_syscall_error(index, path, "open()");
+		return -1;
+	}
+	mail_index_fchown(index, log->group_sync_fd, path);
+	return 0;
+}
+
+static bool
+log_group_sync_is_done(struct mail_transaction_log *log,
+		       struct mail_transaction_log_file *file,
+		       uoff_t end_offset)
+{
+	struct mail_transaction_log_group_sync rec;
+
+	if (pread(log->group_sync_fd, &rec, sizeof(rec), 0) != sizeof(rec))
+		return FALSE;
+	return rec.file_seq == file->hdr.file_seq &&
+		rec.synced_offset >= end_offset;
+}
+
+static int log_file_fdatasync(struct mail_transaction_log_file *file)
+{
+	if (fdatasync(file->fd) < 0) {
+		mail_index_file_set_syscall_error(file->log->index,
+						  file->filepath,
+						  "fdatasync()");
+		return -1;
+	}
+	file->log->fsync_stats.solo_syncs++;
+	return 0;
+}
+
+static int
+log_group_fsync(struct mail_transaction_log_file *file, uoff_t end_offset)
+{
+	struct mail_transaction_log *log = file->log;
+	struct mail_index *index = log->index;
+	struct mail_transaction_log_group_sync rec;
+	struct file_lock *lock;
+	enum file_lock_method lock_method;
+	struct stat st;
+	int ret;
+
+	if (log_group_sync_open(log) < 0)
+		return log_file_fdatasync(file);
+	if (log_group_sync_is_done(log, file, end_offset)) {
+		log->fsync_stats.batched_syncs++;
+		return 0;
+	}
+
+	/* only one process syncs at a time. the others wait here and
+	   usually find that their data got synced while they waited. */
+	lock_method = index->lock_method == FILE_LOCK_METHOD_DOTLOCK ?
+		FILE_LOCK_METHOD_FCNTL : index->lock_method;
+	ret = file_wait_lock(log->group_sync_fd, log->filepath, F_WRLCK,
+			     lock_method,
+			     I_MIN(MAIL_TRANSACTION_LOG_LOCK_TIMEOUT,
+				   index->max_lock_timeout_secs), &lock);
+	if (ret <= 0) {
+		if (ret < 0) {
+			mail_index_file_set_syscall_error(index,
+				log->filepath, "file_wait_lock(sync)");
+		}
+		return log_file_fdatasync(file);
+	}
+
+	if (log_group_sync_is_done(log, file, end_offset)) {
+		log->fsync_stats.batched_syncs++;
+		ret = 0;
+	} else if (fstat(file->fd, &st) < 0) {
+		mail_index_file_set_syscall_error(index, file->filepath,
+						  "fstat()");
+		ret = -1;
+	} else if (log_file_fdatasync(file) < 0) {
+		ret = -1;
+	} else {
+		/* everything written before the fstat() is now on disk,
+		   including other processes' appends */
+		i_assert((uoff_t)st.st_size >= end_offset);
+		memset(&rec, 0, sizeof(rec));
+		rec.file_seq = file->hdr.file_seq;
+		rec.synced_offset = st.st_size;
+		if (pwrite_full(log->group_sync_fd, &rec, sizeof(rec), 0) < 0) {
+			mail_index_file_set_syscall_error(index,
+				log->filepath, "pwrite_full(sync)");
+		}
+		ret = 0;
+	}
+	file_unlock(&lock);
+	return ret;
+}
+
+void mail_transaction_log_get_fsync_stats(struct mail_transaction_log *log,
+					  struct mail_transaction_log_fsync_stats *stats_r)
+{
+	*stats_r = log->fsync_stats;
+}
+
 int mail_transaction_log_append_begin(struct mail_index *index,
 				      enum mail_transaction_type flags,
 				      struct mail_transaction_log_append_ctx **ctx_r)
@@ -226,13 +380,23 @@ int mail_transaction_log_append_commit(struct mail_transaction_log_append_ctx **
 {
 	struct mail_transaction_log_append_ctx *ctx = *_ctx;
 	struct mail_index *index = ctx->log->index;
+	struct mail_transaction_log_file *file = ctx->log->head;
+	uoff_t end_offset;
 	int ret = 0;
 
 	*_ctx = NULL;
 
 	ret = mail_transaction_log_append_locked(ctx);
+	end_offset = file->sync_offset;
 	if (!index->log_sync_locked)
-		mail_transaction_log_file_unlock(index->log->head);
+		mail_transaction_log_file_unlock(file);
+
+	if (ret == 0 && ctx->want_group_fsync &&
+	    !MAIL_TRANSACTION_LOG_FILE_IN_MEMORY(file)) {
+		/* the data is already visible to others, so on failure we
+		   can't truncate it away anymore. just report the error. */
+		ret = log_group_fsync(file, end_offset);
+	}
 
 	buffer_free(&ctx->output);
 	i_free(ctx);
@@ -222,7 +222,10 @@ mail_transaction_log_init_hdr(struct mail_transaction_log *log,
 
 	memset(hdr, 0, sizeof(*hdr));
 	hdr->major_version = MAIL_TRANSACTION_LOG_MAJOR_VERSION;
-	hdr->minor_version = MAIL_TRANSACTION_LOG_MINOR_VERSION;
+	hdr->minor_version =
+		(index->flags & MAIL_INDEX_OPEN_FLAG_LOG_PACKED) != 0 ?
+		MAIL_TRANSACTION_LOG_PACKED_MINOR_VERSION :
+		MAIL_TRANSACTION_LOG_MINOR_VERSION;
 	hdr->hdr_size = sizeof(struct mail_transaction_log_header);
 	hdr->indexid = log->index->indexid;
 	hdr->create_stamp = ioloop_time;
@@ -984,7 +987,7 @@ log_file_track_mailbox_sync_offset_hdr(struct mail_transaction_log_file *file,
 void mail_transaction_update_modseq(const struct mail_transaction_header *hdr,
 				    const void *data, uint64_t *cur_modseq)
 {
-	uint32_t trans_size;
+	uint32_t trans_size, type;
 
 	trans_size = mail_index_offset_to_uint32(hdr->size);
 	i_assert(trans_size != 0);
@@ -1011,7 +1014,12 @@ void mail_transaction_update_modseq(const struct mail_transaction_header *hdr,
 		return;
 	}
 
-	switch (hdr->type & MAIL_TRANSACTION_TYPE_MASK) {
+	type = hdr->type & MAIL_TRANSACTION_TYPE_MASK;
+	if (type == MAIL_TRANSACTION_PACKED) {
+		type = mail_transaction_packed_get_type(data,
+					trans_size - sizeof(*hdr));
+	}
+	switch (type) {
 	case MAIL_TRANSACTION_EXPUNGE | MAIL_TRANSACTION_EXPUNGE_PROT:
 	case MAIL_TRANSACTION_EXPUNGE_GUID | MAIL_TRANSACTION_EXPUNGE_PROT:
 		if ((hdr->type & MAIL_TRANSACTION_EXTERNAL) == 0) {
@@ -1461,21 +1469,36 @@ mail_transaction_log_file_insert_read(struct mail_transaction_log_file *file,
 static int
 mail_transaction_log_file_read_more(struct mail_transaction_log_file *file)
 {
+	struct stat st;
 	void *data;
-	size_t size;
+	size_t size, read_size = LOG_PREFETCH;
 	uint32_t read_offset;
 	ssize_t ret;
+	bool size_checked = FALSE;
 
 	read_offset = file->buffer_offset + buffer_get_used_size(file->buffer);
 
 	do {
-		data = buffer_append_space_unsafe(file->buffer, LOG_PREFETCH);
-		ret = pread(file->fd, data, LOG_PREFETCH, read_offset);
+		data = buffer_append_space_unsafe(file->buffer, read_size);
+		ret = pread(file->fd, data, read_size, read_offset);
 		if (ret > 0)
 			read_offset += ret;
 
 		size = read_offset - file->buffer_offset;
 		buffer_set_used_size(file->buffer, size);
+
+		read_size = LOG_PREFETCH;
+		if (ret == LOG_PREFETCH && !size_checked) {
+			/* there's probably more. read everything that already
+			   exists with a single pread(). with NFS this avoids
+			   a round-trip for each LOG_PREFETCH bytes. */
+			size_checked = TRUE;
+			if (fstat(file->fd, &st) == 0 &&
+			    st.st_size > read_offset &&
+			    (uoff_t)st.st_size - read_offset > LOG_PREFETCH &&
+			    st.st_size < (uint32_t)-1)
+				read_size = st.st_size - read_offset;
+		}
 	} while (ret > 0 || (ret < 0 && errno == EINTR));
 
 	file->last_size = read_offset;
@@ -0,0 +1,345 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "buffer.h"
+#include "numpack.h"
+#include "mail-transaction-log.h"
+
+/* MAIL_TRANSACTION_PACKED record begins with the original record's type
+   (including the expunge protection mask). It's followed by:
+
+   expunge, keyword-reset: <count> { <uid1 delta> <uid2 - uid1> }
+   flag-update: <count> { <uid1 delta> <uid2 - uid1> <add_flags>
+                          <remove_flags> <modseq_inc_flag> }
+   keyword-update: <modify_type> <name_size> <name>
+                   <count> { <uid1 delta> <uid2 - uid1> }
+   ext-rec-update: <data size> <count> { <uid delta> <data> }
+
+   All numbers except the single byte flags are written with numpack. UID
+   deltas are relative to the previous record's (last) UID. The data is
+   padded with zeros to 32bit alignment. */
+
+#define UID_RANGE_SIZE (sizeof(uint32_t)*2)
+/* extension records' size is 16bit */
+#define PACKED_EXT_REC_MAX_DATA_SIZE 65536
+
+static bool
+pack_uid_ranges(buffer_t *dest, const void *data, size_t size,
+		size_t rec_size, size_t extra_size)
+{
+	const uint32_t *range;
+	uint32_t prev_uid = 0;
+	size_t i, count;
+
+	if (size % rec_size != 0)
+		return FALSE;
+
+	count = size / rec_size;
+	numpack_encode(dest, count);
+	for (i = 0; i < count; i++) {
+		range = CONST_PTR_OFFSET(data, i * rec_size);
+		if (range[0] < prev_uid || range[1] < range[0])
+			return FALSE;
+
+		numpack_encode(dest, range[0] - prev_uid);
+		numpack_encode(dest, range[1] - range[0]);
+		buffer_append(dest, range + 2, extra_size);
+		prev_uid = range[1];
+	}
+	return TRUE;
+}
+
+static bool
+pack_keyword_update(buffer_t *dest, const void *data, size_t size)
+{
+	const struct mail_transaction_keyword_update *u = data;
+	size_t uidset_offset;
+	uint8_t modify_type;
+
+	if (size < sizeof(*u) || u->name_size == 0)
+		return FALSE;
+	uidset_offset = sizeof(*u) + u->name_size;
+	if ((uidset_offset % 4) != 0)
+		uidset_offset += 4 - (uidset_offset % 4);
+	if (uidset_offset > size)
+		return FALSE;
+
+	modify_type = u->modify_type;
+	buffer_append(dest, &modify_type, 1);
+	numpack_encode(dest, u->name_size);
+	buffer_append(dest, u + 1, u->name_size);
+	return pack_uid_ranges(dest, CONST_PTR_OFFSET(data, uidset_offset),
+			       size - uidset_offset, UID_RANGE_SIZE, 0);
+}
+
+static bool
+pack_ext_rec_updates(buffer_t *dest, const void *data, size_t size,
+		     size_t rec_size)
+{
+	const struct mail_transaction_ext_rec_update *rec;
+	uint32_t prev_uid = 0;
+	size_t i, count;
+
+	if (rec_size <= sizeof(*rec) || (rec_size % 4) != 0 ||
+	    rec_size - sizeof(*rec) > PACKED_EXT_REC_MAX_DATA_SIZE ||
+	    size % rec_size != 0)
+		return FALSE;
+
+	count = size / rec_size;
+	numpack_encode(dest, rec_size - sizeof(*rec));
+	numpack_encode(dest, count);
+	for (i = 0; i < count; i++) {
+		rec = CONST_PTR_OFFSET(data, i * rec_size);
+		if (rec->uid <= prev_uid)
+			return FALSE;
+
+		numpack_encode(dest, rec->uid - prev_uid);
+		buffer_append(dest, rec + 1, rec_size - sizeof(*rec));
+		prev_uid = rec->uid;
+	}
+	return TRUE;
+}
+
+bool mail_transaction_pack(enum mail_transaction_type _type,
+			   const void *data, size_t size, size_t record_size,
+			   buffer_t *dest)
+{
+	uint32_t type = _type & MAIL_TRANSACTION_TYPE_MASK;
+	size_t start_pos = dest->used;
+	bool ret;
+
+	numpack_encode(dest, type);
+
+	switch (type) {
+	case MAIL_TRANSACTION_EXPUNGE | MAIL_TRANSACTION_EXPUNGE_PROT:
+		ret = pack_uid_ranges(dest, data, size,
+				      sizeof(struct mail_transaction_expunge), 0);
+		break;
+	case MAIL_TRANSACTION_KEYWORD_RESET:
+		ret = pack_uid_ranges(dest, data, size,
+			sizeof(struct mail_transaction_keyword_reset), 0);
+		break;
+	case MAIL_TRANSACTION_FLAG_UPDATE:
+		/* the padding byte isn't written */
+		ret = pack_uid_ranges(dest, data, size,
+			sizeof(struct mail_transaction_flag_update), 3);
+		break;
+	case MAIL_TRANSACTION_KEYWORD_UPDATE:
+		ret = pack_keyword_update(dest, data, size);
+		break;
+	case MAIL_TRANSACTION_EXT_REC_UPDATE:
+		ret = pack_ext_rec_updates(dest, data, size, record_size);
+		break;
+	default:
+		ret = FALSE;
+		break;
+	}
+	if (!ret) {
+		buffer_set_used_size(dest, start_pos);
+		return FALSE;
+	}
+	if ((dest->used % 4) != 0)
+		buffer_append_zero(dest, 4 - (dest->used % 4));
+	return TRUE;
+}
+
+static int
+unpack_num(const uint8_t **p, const uint8_t *end, uint32_t *num_r,
+	   const char **error_r)
+{
+	uint64_t num;
+
+	if (numpack_decode(p, end, &num) < 0 || num > (uint32_t)-1) {
+		*error_r = "Invalid number";
+		return -1;
+	}
+	*num_r = num;
+	return 0;
+}
+
+static int
+unpack_count(const uint8_t **p, const uint8_t *end, size_t min_rec_size,
+	     uint32_t *count_r, const char **error_r)
+{
+	if (unpack_num(p, end, count_r, error_r) < 0)
+		return -1;
+	/* make sure a small corrupted record can't expand to a huge one */
+	if (*count_r > (size_t)(end - *p) / min_rec_size) {
+		*error_r = t_strdup_printf("Record count too large (%u)",
+					   *count_r);
+		return -1;
+	}
+	return 0;
+}
+
+static int
+unpack_uid_delta(const uint8_t **p, const uint8_t *end, uint32_t prev_uid,
+		 uint32_t *uid_r, const char **error_r)
+{
+	uint32_t delta;
+
+	if (unpack_num(p, end, &delta, error_r) < 0)
+		return -1;
+	if (delta > (uint32_t)-1 - prev_uid) {
+		*error_r = "UID delta too large";
+		return -1;
+	}
+	*uid_r = prev_uid + delta;
+	return 0;
+}
+
+static int
+unpack_uid_ranges(const uint8_t **p, const uint8_t *end, buffer_t *dest,
+		  size_t rec_size, size_t extra_size, const char **error_r)
+{
+	uint32_t *range, i, count, prev_uid = 0, uid1, uid2;
+
+	if (unpack_count(p, end, 2 + extra_size, &count, error_r) < 0)
+		return -1;
+
+	for (i = 0; i < count; i++) {
+		if (unpack_uid_delta(p, end, prev_uid, &uid1, error_r) < 0 ||
+		    unpack_uid_delta(p, end, uid1, &uid2, error_r) < 0)
+			return -1;
+		if ((size_t)(end - *p) < extra_size) {
+			*error_r = "Record truncated";
+			return -1;
+		}
+
+		range = buffer_append_space_unsafe(dest, rec_size);
+		memset(range, 0, rec_size);
+		range[0] = uid1;
+		range[1] = uid2;
+		memcpy(range + 2, *p, extra_size);
+		*p += extra_size;
+		prev_uid = uid2;
+	}
+	return 0;
+}
+
+static int
+unpack_keyword_update(const uint8_t **p, const uint8_t *end, buffer_t *dest,
+		      const char **error_r)
+{
+	struct mail_transaction_keyword_update u;
+	uint32_t name_size;
+
+	memset(&u, 0, sizeof(u));
+	if (*p == end) {
+		*error_r = "Keyword update truncated";
+		return -1;
+	}
+	u.modify_type = *(*p)++;
+	if (unpack_num(p, end, &name_size, error_r) < 0)
+		return -1;
+	if (name_size == 0 || name_size > (uint16_t)-1 ||
+	    name_size > (size_t)(end - *p)) {
+		*error_r = "Invalid keyword name size";
+		return -1;
+	}
+	u.name_size = name_size;
+
+	buffer_append(dest, &u, sizeof(u));
+	buffer_append(dest, *p, name_size);
+	*p += name_size;
+	if ((dest->used % 4) != 0)
+		buffer_append_zero(dest, 4 - (dest->used % 4));
+	return unpack_uid_ranges(p, end, dest, UID_RANGE_SIZE, 0, error_r);
+}
+
+static int
+unpack_ext_rec_updates(const uint8_t **p, const uint8_t *end, buffer_t *dest,
+		       const char **error_r)
+{
+	struct mail_transaction_ext_rec_update rec;
+	uint32_t data_size, i, count, prev_uid = 0;
+
+	if (unpack_num(p, end, &data_size, error_r) < 0)
+		return -1;
+	if (data_size == 0 || (data_size % 4) != 0 ||
+	    data_size > PACKED_EXT_REC_MAX_DATA_SIZE) {
+		*error_r = t_strdup_printf("Invalid record size %u",
+					   data_size);
+		return -1;
+	}
+	if (unpack_count(p, end, 1 + data_size, &count, error_r) < 0)
+		return -1;
+
+	for (i = 0; i < count; i++) {
+		if (unpack_uid_delta(p, end, prev_uid, &rec.uid, error_r) < 0)
+			return -1;
+		if (rec.uid == prev_uid) {
+			*error_r = "Duplicate UID";
+			return -1;
+		}
+		if ((size_t)(end - *p) < data_size) {
+			*error_r = "Record truncated";
+			return -1;
+		}
+		buffer_append(dest, &rec, sizeof(rec));
+		buffer_append(dest, *p, data_size);
+		*p += data_size;
+		prev_uid = rec.uid;
+	}
+	return 0;
+}
+
+int mail_transaction_unpack(const void *data, size_t size,
+			    enum mail_transaction_type *type_r,
+			    buffer_t *dest, const char **error_r)
+{
+	const uint8_t *p = data, *end = p + size;
+	uint32_t type;
+	int ret;
+
+	if (unpack_num(&p, end, &type, error_r) < 0)
+		return -1;
+
+	switch (type) {
+	case MAIL_TRANSACTION_EXPUNGE | MAIL_TRANSACTION_EXPUNGE_PROT:
+		ret = unpack_uid_ranges(&p, end, dest,
+			sizeof(struct mail_transaction_expunge), 0, error_r);
+		break;
+	case MAIL_TRANSACTION_KEYWORD_RESET:
+		ret = unpack_uid_ranges(&p, end, dest,
+			sizeof(struct mail_transaction_keyword_reset), 0,
+			error_r);
+		break;
+	case MAIL_TRANSACTION_FLAG_UPDATE:
+		ret = unpack_uid_ranges(&p, end, dest,
+			sizeof(struct mail_transaction_flag_update), 3,
+			error_r);
+		break;
+	case MAIL_TRANSACTION_KEYWORD_UPDATE:
+		ret = unpack_keyword_update(&p, end, dest, error_r);
+		break;
+	case MAIL_TRANSACTION_EXT_REC_UPDATE:
+		ret = unpack_ext_rec_updates(&p, end, dest, error_r);
+		break;
+	default:
+		*error_r = t_strdup_printf("Unsupported record type 0x%x",
+					   type);
+		return -1;
+	}
+	if (ret < 0)
+		return -1;
+
+	if (end - p >= 4) {
+		*error_r = "Unexpected data at the end of record";
+		return -1;
+	}
+	*type_r = type;
+	return 0;
+}
+
+enum mail_transaction_type
+mail_transaction_packed_get_type(const void *data, size_t size)
+{
+	const uint8_t *p = data;
+	uint64_t type;
+
+	if (numpack_decode(&p, p + size, &type) < 0 ||
+	    type > MAIL_TRANSACTION_TYPE_MASK)
+		return 0;
+	return type;
+}
@@ -23,9 +23,18 @@ struct dotlock_settings;
 #define MAIL_TRANSACTION_LOG2_STALE_SECS (60*60*24*2)
 
 #define MAIL_TRANSACTION_LOG_FILE_IN_MEMORY(file) ((file)->fd == -1)
+#define MAIL_TRANSACTION_LOG_FILE_IS_PACKED(file) \
+	((file)->hdr.minor_version >= MAIL_TRANSACTION_LOG_PACKED_MINOR_VERSION)
 
 #define LOG_FILE_MODSEQ_CACHE_SIZE 10
 
+/* Contents of the .log.sync file: everything in the log file_seq up to
+   synced_offset has already been fdatasync()ed. */
+struct mail_transaction_log_group_sync {
+	uint32_t file_seq;
+	uint32_t synced_offset;
+};
+
 struct modseq_cache {
 	uoff_t offset;
 	uint64_t highest_modseq;
@@ -98,6 +107,10 @@ struct mail_transaction_log {
 	unsigned int dotlock_count;
 	struct dotlock *dotlock;
 
+	/* .log.sync file shared by all processes doing group commits */
+	int group_sync_fd;
+	struct mail_transaction_log_fsync_stats fsync_stats;
+
 	unsigned int nfs_flush:1;
 	unsigned int log_2_unlink_checked:1;
 };
@@ -11,6 +11,10 @@ struct mail_transaction_log_view {
 	uoff_t min_file_offset, max_file_offset;
 
 	struct mail_transaction_header tmp_hdr;
+	/* the current record, if it was unpacked from
+	   MAIL_TRANSACTION_PACKED */
+	struct mail_transaction_header unpacked_hdr;
+	buffer_t *unpack_buf;
 
 	/* a list of log files we've referenced. we have to keep this list
 	   explicitly because more files may be added into the linked list
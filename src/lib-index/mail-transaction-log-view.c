@@ -55,6 +55,8 @@ void mail_transaction_log_view_close(struct mail_transaction_log_view **_view)
 	mail_transaction_logs_clean(view->log);
 
 	array_free(&view->file_refs);
+	if (view->unpack_buf != NULL)
+		buffer_free(&view->unpack_buf);
 	i_free(view);
 }
 
@@ -673,6 +675,46 @@ log_view_is_record_valid(struct mail_transaction_log_file *file,
 	return TRUE;
 }
 
+static int
+log_view_unpack(struct mail_transaction_log_view *view,
+		const struct mail_transaction_header **hdr,
+		const void **data)
+{
+	enum mail_transaction_type type;
+	const char *error;
+	uint32_t size;
+
+	size = mail_index_offset_to_uint32((*hdr)->size) - sizeof(**hdr);
+	if (view->unpack_buf == NULL)
+		view->unpack_buf = buffer_create_dynamic(default_pool, 1024);
+	else
+		buffer_set_used_size(view->unpack_buf, 0);
+
+	if (mail_transaction_unpack(*data, size, &type, view->unpack_buf,
+				    &error) < 0) {
+		mail_transaction_log_file_set_corrupted(view->cur,
+			"Invalid packed record (offset=%"PRIuUOFF_T"): %s",
+			view->cur_offset, error);
+		return -1;
+	}
+	if (view->unpack_buf->used == 0 ||
+	    view->unpack_buf->used >= 0x40000000 - sizeof(**hdr)) {
+		mail_transaction_log_file_set_corrupted(view->cur,
+			"Invalid packed record size (offset=%"PRIuUOFF_T")",
+			view->cur_offset);
+		return -1;
+	}
+
+	view->unpacked_hdr.type = type |
+		((*hdr)->type & ~MAIL_TRANSACTION_TYPE_MASK);
+	view->unpacked_hdr.size =
+		mail_index_uint32_to_offset(sizeof(**hdr) +
+					    view->unpack_buf->used);
+	*hdr = &view->unpacked_hdr;
+	*data = view->unpack_buf->data;
+	return 0;
+}
+
 static int
 log_view_get_next(struct mail_transaction_log_view *view,
 		  const struct mail_transaction_header **hdr_r,
@@ -740,6 +782,14 @@ log_view_get_next(struct mail_transaction_log_view *view,
 		return -1;
 	}
 
+	if (rec_type == MAIL_TRANSACTION_PACKED) {
+		T_BEGIN {
+			ret = log_view_unpack(view, &hdr, &data);
+		} T_END;
+		if (ret < 0)
+			return -1;
+	}
+
 	T_BEGIN {
 		ret = log_view_is_record_valid(file, hdr, data) ? 1 : -1;
 	} T_END;
@@ -33,6 +33,7 @@ mail_transaction_log_alloc(struct mail_index *index)
 
 	log = i_new(struct mail_transaction_log, 1);
 	log->index = index;
+	log->group_sync_fd = -1;
 	return log;
 }
 
@@ -132,6 +133,14 @@ void mail_transaction_log_close(struct mail_transaction_log *log)
 		log->head->refcount--;
 	mail_transaction_logs_clean(log);
 	i_assert(log->files == NULL);
+
+	if (log->group_sync_fd != -1) {
+		if (close(log->group_sync_fd) < 0) {
+			mail_index_file_set_syscall_error(log->index,
+				log->filepath, "close(sync)");
+		}
+		log->group_sync_fd = -1;
+	}
 }
 
 void mail_transaction_log_free(struct mail_transaction_log **_log)
@@ -226,6 +235,14 @@ void mail_transaction_logs_clean(struct mail_transaction_log *log)
 
 bool mail_transaction_log_want_rotate(struct mail_transaction_log *log)
 {
+	bool want_packed = (log->index->flags &
+			    MAIL_INDEX_OPEN_FLAG_LOG_PACKED) != 0;
+
+	if (MAIL_TRANSACTION_LOG_FILE_IS_PACKED(log->head) != want_packed &&
+	    log->head->sync_offset > log->head->hdr.hdr_size) {
+		/* convert the log to the wanted format */
+		return TRUE;
+	}
 	return LOG_WANT_ROTATE(log->head);
 }
 
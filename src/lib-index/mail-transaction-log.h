@@ -4,9 +4,14 @@
 #include "mail-index.h"
 
 #define MAIL_TRANSACTION_LOG_SUFFIX ".log"
+/* Appended to the log path for the file tracking group-committed fsyncs */
+#define MAIL_TRANSACTION_LOG_GROUP_SYNC_SUFFIX ".sync"
 
 #define MAIL_TRANSACTION_LOG_MAJOR_VERSION 1
 #define MAIL_TRANSACTION_LOG_MINOR_VERSION 2
+/* Log files with this minor version may contain MAIL_TRANSACTION_PACKED
+   records. They're created only with MAIL_INDEX_OPEN_FLAG_LOG_PACKED. */
+#define MAIL_TRANSACTION_LOG_PACKED_MINOR_VERSION 3
 #define MAIL_TRANSACTION_LOG_HEADER_MIN_SIZE 24
 
 struct mail_transaction_log_header {
@@ -45,6 +50,9 @@ enum mail_transaction_type {
 	MAIL_TRANSACTION_INDEX_UNDELETED	= 0x00040000,
 	MAIL_TRANSACTION_BOUNDARY		= 0x00080000,
 	MAIL_TRANSACTION_ATTRIBUTE_UPDATE       = 0x00100000,
+	/* Another record packed with mail_transaction_pack(). Transaction
+	   log views return only the unpacked records. */
+	MAIL_TRANSACTION_PACKED			= 0x00200000,
 
 	MAIL_TRANSACTION_TYPE_MASK		= 0x0fffffff,
 
@@ -179,6 +187,15 @@ struct mail_transaction_log_append_ctx {
 	unsigned int append_sync_offset:1;
 	unsigned int sync_includes_this:1;
 	unsigned int want_fsync:1;
+	unsigned int want_group_fsync:1;
+};
+
+struct mail_transaction_log_fsync_stats {
+	/* Number of commits that had to fdatasync() the log themselves */
+	unsigned int solo_syncs;
+	/* Number of commits whose data had already been fdatasync()ed by
+	   another commit in the same group */
+	unsigned int batched_syncs;
 };
 
 #define LOG_IS_BEFORE(seq1, offset1, seq2, offset2) \
@@ -270,7 +287,18 @@ int mail_transaction_log_append_begin(struct mail_index *index,
 void mail_transaction_log_append_add(struct mail_transaction_log_append_ctx *ctx,
 				     enum mail_transaction_type type,
 				     const void *data, size_t size);
+/* Like mail_transaction_log_append_add(), but data is an array of
+   record_size sized records. This is needed for packing extension record
+   updates. */
+void mail_transaction_log_append_add_records(struct mail_transaction_log_append_ctx *ctx,
+					     enum mail_transaction_type type,
+					     const void *data, size_t size,
+					     size_t record_size);
 int mail_transaction_log_append_commit(struct mail_transaction_log_append_ctx **ctx);
+/* Returns how commits in this process were fsynced when
+   MAIL_INDEX_OPEN_FLAG_FSYNC_GROUP_COMMIT is used. */
+void mail_transaction_log_get_fsync_stats(struct mail_transaction_log *log,
+					  struct mail_transaction_log_fsync_stats *stats_r);
 
 /* Lock transaction log for index synchronization. Log cannot be read or
    written to while it's locked. Returns end offset. */
@@ -297,4 +325,22 @@ int mail_transaction_log_get_mtime(struct mail_transaction_log *log,
 /* Unlink transaction log files */
 int mail_transaction_log_unlink(struct mail_transaction_log *log);
 
+/* Append a packed version of the given record's data to dest. record_size
+   is needed only for MAIL_TRANSACTION_EXT_REC_UPDATE records. Returns FALSE
+   if the record type can't be packed or the records aren't sorted by UID,
+   in which case nothing is added to dest. */
+bool mail_transaction_pack(enum mail_transaction_type type,
+			   const void *data, size_t size, size_t record_size,
+			   buffer_t *dest);
+/* Append the original contents of a MAIL_TRANSACTION_PACKED record's data
+   to dest and return its type. Returns 0 if ok, -1 if the data is
+   corrupted. */
+int mail_transaction_unpack(const void *data, size_t size,
+			    enum mail_transaction_type *type_r,
+			    buffer_t *dest, const char **error_r);
+/* Returns the original type of a MAIL_TRANSACTION_PACKED record,
+   or 0 if it's corrupted. */
+enum mail_transaction_type
+mail_transaction_packed_get_type(const void *data, size_t size);
+
 #endif
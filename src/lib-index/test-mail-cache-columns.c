@@ -0,0 +1,463 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "ioloop.h"
+#include "hostpid.h"
+#include "buffer.h"
+#include "unlink-directory.h"
+#include "test-common.h"
+#include "mail-cache-private.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define TEST_MESSAGES_COUNT 100
+/* large enough to make the columns section exceed
+   MAIL_CACHE_COLUMNS_MAX_SIZE with TEST_BIG_MESSAGES_COUNT messages */
+#define TEST_BIG_FIELD_SIZE 64000
+#define TEST_BIG_MESSAGES_COUNT 2200
+
+enum test_field {
+	TEST_FIELD_DATE,
+	TEST_FIELD_SIZE,
+	TEST_FIELD_HEADER,
+	TEST_FIELD_FLAGS,
+	TEST_FIELD_TEMP,
+	TEST_FIELD_BIG,
+
+	TEST_FIELD_COUNT
+};
+
+struct test_index {
+	struct ioloop *ioloop;
+	char *dir;
+	struct mail_index *index;
+	struct mail_cache *cache;
+	struct mail_cache_field fields[TEST_FIELD_COUNT];
+	/* register also the big field */
+	bool big;
+};
+
+static const struct mail_cache_field test_fields[TEST_FIELD_COUNT] = {
+	{ .name = "date", .type = MAIL_CACHE_FIELD_FIXED_SIZE,
+	  .field_size = sizeof(uint32_t),
+	  .decision = MAIL_CACHE_DECISION_YES | MAIL_CACHE_DECISION_FORCED },
+	{ .name = "size", .type = MAIL_CACHE_FIELD_FIXED_SIZE,
+	  .field_size = sizeof(uint64_t),
+	  .decision = MAIL_CACHE_DECISION_YES | MAIL_CACHE_DECISION_FORCED },
+	{ .name = "header", .type = MAIL_CACHE_FIELD_STRING,
+	  .field_size = UINT_MAX,
+	  .decision = MAIL_CACHE_DECISION_YES | MAIL_CACHE_DECISION_FORCED },
+	{ .name = "flags", .type = MAIL_CACHE_FIELD_BITMASK,
+	  .field_size = sizeof(uint32_t),
+	  .decision = MAIL_CACHE_DECISION_YES | MAIL_CACHE_DECISION_FORCED },
+	{ .name = "temp", .type = MAIL_CACHE_FIELD_FIXED_SIZE,
+	  .field_size = sizeof(uint32_t),
+	  .decision = MAIL_CACHE_DECISION_TEMP | MAIL_CACHE_DECISION_FORCED },
+	{ .name = "big", .type = MAIL_CACHE_FIELD_FIXED_SIZE,
+	  .field_size = TEST_BIG_FIELD_SIZE,
+	  .decision = MAIL_CACHE_DECISION_YES | MAIL_CACHE_DECISION_FORCED }
+};
+
+static bool test_expect_errors;
+static unsigned int test_errors_count;
+
+static void ATTR_FORMAT(2, 0)
+test_columns_error_handler(const struct failure_context *ctx,
+			   const char *format, va_list args)
+{
+	if (test_expect_errors) {
+		test_errors_count++;
+		return;
+	}
+	default_error_handler(ctx, format, args);
+	test_assert(!"unexpected error");
+}
+
+static void test_index_open(struct test_index *t)
+{
+	t->index = mail_index_alloc(t->dir, "dovecot.index");
+	if (mail_index_open_or_create(t->index, MAIL_INDEX_OPEN_FLAG_CREATE) < 0)
+		i_fatal("mail_index_open_or_create() failed: %s",
+			mail_index_get_error_message(t->index));
+	t->cache = mail_index_get_cache(t->index);
+	memcpy(t->fields, test_fields, sizeof(t->fields));
+	mail_cache_register_fields(t->cache, t->fields, t->big ?
+				   TEST_FIELD_COUNT : TEST_FIELD_BIG);
+}
+
+static void test_index_close(struct test_index *t)
+{
+	mail_index_close(t->index);
+	mail_index_free(&t->index);
+	t->cache = NULL;
+}
+
+static void test_index_init(struct test_index *t, bool big)
+{
+	memset(t, 0, sizeof(*t));
+	t->big = big;
+	t->ioloop = io_loop_create();
+	t->dir = i_strdup_printf("/tmp/test-mail-cache-columns.%s.XXXXXX",
+				 my_pid);
+	if (mkdtemp(t->dir) == NULL)
+		i_fatal("mkdtemp(%s) failed: %m", t->dir);
+	test_index_open(t);
+}
+
+static void test_index_deinit(struct test_index *t)
+{
+	if (t->index != NULL)
+		test_index_close(t);
+	if (unlink_directory(t->dir, UNLINK_DIRECTORY_FLAG_RMDIR) < 0)
+		i_error("unlink_directory(%s) failed: %m", t->dir);
+	i_free(t->dir);
+	io_loop_destroy(&t->ioloop);
+}
+
+static uint32_t test_date(uint32_t seq) { return seq * 1000; }
+static uint64_t test_size(uint32_t seq) { return (uint64_t)seq << 33; }
+static bool test_has_date(uint32_t seq) { return seq % 3 != 0; }
+
+static void test_index_fill(struct test_index *t, unsigned int count)
+{
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	struct mail_cache_view *cache_view;
+	struct mail_cache_transaction_ctx *cache_trans;
+	uint32_t seq, new_seq, date, flags = 1, uid_validity = ioloop_time;
+	uint64_t size;
+	const char *header;
+	unsigned char *big;
+
+	view = mail_index_view_open(t->index);
+	trans = mail_index_transaction_begin(view, 0);
+	mail_index_update_header(trans,
+		offsetof(struct mail_index_header, uid_validity),
+		&uid_validity, sizeof(uid_validity), TRUE);
+	for (seq = 1; seq <= count; seq++)
+		mail_index_append(trans, seq * 2, &new_seq);
+	if (mail_index_transaction_commit(&trans) < 0)
+		i_fatal("mail_index_transaction_commit() failed");
+	mail_index_view_close(&view);
+
+	view = mail_index_view_open(t->index);
+	trans = mail_index_transaction_begin(view, 0);
+	cache_view = mail_cache_view_open(t->cache, view);
+	cache_trans = mail_cache_get_transaction(cache_view, trans);
+	for (seq = 1; seq <= count; seq++) {
+		if (test_has_date(seq)) {
+			date = test_date(seq);
+			mail_cache_add(cache_trans, seq,
+				       t->fields[TEST_FIELD_DATE].idx,
+				       &date, sizeof(date));
+		}
+		size = test_size(seq);
+		mail_cache_add(cache_trans, seq, t->fields[TEST_FIELD_SIZE].idx,
+			       &size, sizeof(size));
+		header = t_strdup_printf("Subject: %u", seq);
+		mail_cache_add(cache_trans, seq,
+			       t->fields[TEST_FIELD_HEADER].idx,
+			       header, strlen(header));
+		mail_cache_add(cache_trans, seq,
+			       t->fields[TEST_FIELD_FLAGS].idx,
+			       &flags, sizeof(flags));
+		mail_cache_add(cache_trans, seq,
+			       t->fields[TEST_FIELD_TEMP].idx,
+			       &seq, sizeof(seq));
+	}
+	if (t->big) {
+		big = t_malloc0(TEST_BIG_FIELD_SIZE);
+		memset(big, 'x', TEST_BIG_FIELD_SIZE);
+		mail_cache_add(cache_trans, 1, t->fields[TEST_FIELD_BIG].idx,
+			       big, TEST_BIG_FIELD_SIZE);
+	}
+	if (mail_index_transaction_commit(&trans) < 0)
+		i_fatal("mail_index_transaction_commit() failed");
+	mail_cache_view_close(&cache_view);
+	mail_index_view_close(&view);
+
+	/* the cache file was created by the first commit, before the
+	   records were added. compress it again to fill the columns. */
+	test_assert(mail_cache_open_and_verify(t->cache) == 0);
+	t->cache->need_compress_file_seq = t->cache->hdr->file_seq;
+	if (mail_cache_compress_external(t->cache) < 0)
+		i_fatal("mail_cache_compress_external() failed");
+	if (mail_index_refresh(t->index) < 0)
+		i_fatal("mail_index_refresh() failed");
+}
+
+static const struct mail_cache_column_header *
+test_get_column_header(struct test_index *t)
+{
+	const void *data;
+
+	if (mail_cache_map(t->cache, sizeof(struct mail_cache_header),
+			   sizeof(struct mail_cache_column_header), &data) <= 0)
+		return NULL;
+	return data;
+}
+
+static void test_columns_verify(struct test_index *t, unsigned int count)
+{
+	struct mail_index_view *view;
+	struct mail_cache_view *cache_view;
+	buffer_t *buf = buffer_create_dynamic(pool_datastack_create(), 64);
+	unsigned int date_idx = t->fields[TEST_FIELD_DATE].idx;
+	unsigned int size_idx = t->fields[TEST_FIELD_SIZE].idx;
+	unsigned int i;
+	uint32_t seq, date;
+	uint64_t size;
+	int ret;
+
+	view = mail_index_view_open(t->index);
+	cache_view = mail_cache_view_open(t->cache, view);
+	test_assert(mail_cache_open_and_verify(t->cache) == 0);
+	test_assert(t->cache->columns_count == 2);
+	test_assert(t->cache->columns_messages_count == count);
+
+	for (seq = 1; seq <= count; seq++) {
+		buffer_set_used_size(buf, 0);
+		ret = mail_cache_columns_lookup(cache_view, seq, date_idx, buf);
+		if (!test_has_date(seq))
+			test_assert(ret == 0);
+		else {
+			date = test_date(seq);
+			test_assert(ret == 1);
+			test_assert(buf->used == sizeof(date) &&
+				    memcmp(buf->data, &date, sizeof(date)) == 0);
+		}
+		buffer_set_used_size(buf, 0);
+		size = test_size(seq);
+		ret = mail_cache_lookup_field(cache_view, buf, seq, size_idx);
+		test_assert(ret == 1);
+		test_assert(buf->used == sizeof(size) &&
+			    memcmp(buf->data, &size, sizeof(size)) == 0);
+
+		/* only fixed size fields with YES decision are columns */
+		for (i = TEST_FIELD_HEADER; i <= TEST_FIELD_TEMP; i++) {
+			test_assert(mail_cache_columns_lookup(cache_view, seq,
+						t->fields[i].idx, NULL) == 0);
+		}
+		test_assert(mail_cache_field_exists(cache_view, seq,
+				t->fields[TEST_FIELD_HEADER].idx) == 1);
+	}
+	/* the hint doesn't break lookups in reverse order */
+	for (seq = count; seq > 0; seq--) {
+		test_assert(mail_cache_columns_lookup(cache_view, seq, size_idx,
+						      NULL) == 1);
+	}
+	mail_cache_view_close(&cache_view);
+	mail_index_view_close(&view);
+}
+
+static void test_mail_cache_columns_init(void)
+{
+	struct test_index t;
+	const struct mail_cache_column_header *col_hdr;
+	const struct mail_cache_column_field *cols;
+	const uint32_t *uids;
+	const void *data;
+	uoff_t offset, size;
+	unsigned int i;
+
+	test_begin("mail cache columns init");
+	test_index_init(&t, FALSE);
+	test_index_fill(&t, TEST_MESSAGES_COUNT);
+	test_assert(mail_cache_open_and_verify(t.cache) == 0);
+
+	col_hdr = test_get_column_header(&t);
+	test_assert(col_hdr != NULL);
+	if (col_hdr == NULL) {
+		test_index_deinit(&t);
+		test_end();
+		return;
+	}
+	/* date and size, in the order of field registration */
+	test_assert(col_hdr->columns_count == 2);
+	test_assert(col_hdr->messages_count == TEST_MESSAGES_COUNT);
+	offset = sizeof(struct mail_cache_header) + sizeof(*col_hdr) +
+		2 * sizeof(struct mail_cache_column_field);
+	test_assert(col_hdr->uids_offset == offset);
+	offset += TEST_MESSAGES_COUNT * sizeof(uint32_t);
+	size = offset - sizeof(struct mail_cache_header) +
+		MAIL_CACHE_COLUMN_ALIGN((TEST_MESSAGES_COUNT + 7) / 8) * 2 +
+		MAIL_CACHE_COLUMN_ALIGN(TEST_MESSAGES_COUNT * sizeof(uint32_t)) +
+		MAIL_CACHE_COLUMN_ALIGN(TEST_MESSAGES_COUNT * sizeof(uint64_t));
+	test_assert(col_hdr->size == size);
+
+	test_assert(mail_cache_map(t.cache, sizeof(struct mail_cache_header),
+				   col_hdr->size, &data) > 0);
+	col_hdr = data;
+	cols = CONST_PTR_OFFSET(col_hdr, sizeof(*col_hdr));
+	for (i = 0; i < col_hdr->columns_count; i++) {
+		test_assert(t.cache->file_field_map[cols[i].file_field_idx] ==
+			    t.fields[i == 0 ? TEST_FIELD_DATE :
+				     TEST_FIELD_SIZE].idx);
+		test_assert(cols[i].bitmap_offset == offset);
+		offset += MAIL_CACHE_COLUMN_ALIGN((TEST_MESSAGES_COUNT + 7) / 8);
+		test_assert(cols[i].data_offset == offset);
+		offset += MAIL_CACHE_COLUMN_ALIGN(TEST_MESSAGES_COUNT *
+						  cols[i].field_size);
+		test_assert(cols[i].bitmap_offset % sizeof(uint32_t) == 0);
+		test_assert(cols[i].data_offset % sizeof(uint32_t) == 0);
+	}
+	test_assert(cols[0].field_size == sizeof(uint32_t));
+	test_assert(cols[1].field_size == sizeof(uint64_t));
+
+	uids = CONST_PTR_OFFSET(col_hdr, col_hdr->uids_offset -
+				sizeof(struct mail_cache_header));
+	for (i = 0; i < TEST_MESSAGES_COUNT; i++)
+		test_assert(uids[i] == (i + 1) * 2);
+	test_index_deinit(&t);
+	test_end();
+}
+
+static void test_mail_cache_columns_lookup(void)
+{
+	struct test_index t;
+
+	test_begin("mail cache columns lookup");
+	test_index_init(&t, FALSE);
+	test_index_fill(&t, TEST_MESSAGES_COUNT);
+	test_columns_verify(&t, TEST_MESSAGES_COUNT);
+
+	/* the columns are parsed again from the file after reopening */
+	test_index_close(&t);
+	test_index_open(&t);
+	test_assert(t.cache->columns_count == 0);
+	test_columns_verify(&t, TEST_MESSAGES_COUNT);
+	test_index_deinit(&t);
+	test_end();
+}
+
+static void test_mail_cache_columns_max_size(void)
+{
+	struct test_index t;
+	const struct mail_cache_column_header *col_hdr;
+	struct mail_index_view *view;
+	struct mail_cache_view *cache_view;
+	buffer_t *buf = buffer_create_dynamic(pool_datastack_create(), 64);
+	unsigned int date_idx = t.fields[TEST_FIELD_DATE].idx;
+	uint32_t date = test_date(1);
+
+	test_begin("mail cache columns max size");
+	test_index_init(&t, TRUE);
+	test_index_fill(&t, TEST_BIG_MESSAGES_COUNT);
+	test_assert(mail_cache_open_and_verify(t.cache) == 0);
+
+	/* the section would have been too large - only the header is
+	   written and the fields are looked up from the records */
+	col_hdr = test_get_column_header(&t);
+	test_assert(col_hdr != NULL);
+	if (col_hdr != NULL) {
+		test_assert(col_hdr->size == sizeof(*col_hdr));
+		test_assert(col_hdr->columns_count == 0);
+		test_assert(col_hdr->messages_count == 0);
+	}
+	test_assert(t.cache->columns_count == 0);
+
+	view = mail_index_view_open(t.index);
+	cache_view = mail_cache_view_open(t.cache, view);
+	test_assert(mail_cache_columns_lookup(cache_view, 1, date_idx, NULL) == 0);
+	test_assert(mail_cache_lookup_field(cache_view, buf, 1, date_idx) == 1);
+	test_assert(buf->used == sizeof(date) &&
+		    memcmp(buf->data, &date, sizeof(date)) == 0);
+	buffer_set_used_size(buf, 0);
+	test_assert(mail_cache_lookup_field(cache_view, buf, 1,
+					    t.fields[TEST_FIELD_BIG].idx) == 1);
+	test_assert(buf->used == TEST_BIG_FIELD_SIZE);
+	mail_cache_view_close(&cache_view);
+	mail_index_view_close(&view);
+
+	test_index_deinit(&t);
+	test_end();
+}
+
+static void
+test_columns_corrupt(const char *name, uoff_t offset, uint32_t value,
+		     bool truncate)
+{
+	struct test_index t;
+	struct mail_index_view *view;
+	struct mail_cache_view *cache_view;
+	buffer_t *buf = buffer_create_dynamic(pool_datastack_create(), 64);
+	const char *path;
+	int fd;
+
+	test_begin(t_strdup_printf("mail cache columns corrupted %s", name));
+	test_index_init(&t, FALSE);
+	test_index_fill(&t, TEST_MESSAGES_COUNT);
+	test_index_close(&t);
+
+	path = t_strconcat(t.dir, "/dovecot.index"MAIL_CACHE_FILE_SUFFIX, NULL);
+	fd = open(path, O_RDWR);
+	if (fd == -1)
+		i_fatal("open(%s) failed: %m", path);
+	if (truncate) {
+		if (ftruncate(fd, offset) < 0)
+			i_fatal("ftruncate(%s) failed: %m", path);
+	} else {
+		if (pwrite(fd, &value, sizeof(value), offset) != sizeof(value))
+			i_fatal("pwrite(%s) failed: %m", path);
+	}
+	i_close_fd(&fd);
+
+	test_index_open(&t);
+	view = mail_index_view_open(t.index);
+	cache_view = mail_cache_view_open(t.cache, view);
+	test_expect_errors = TRUE;
+	test_errors_count = 0;
+	test_assert(mail_cache_lookup_field(cache_view, buf, 1,
+					    t.fields[TEST_FIELD_DATE].idx) <= 0);
+	test_assert(t.cache->columns_count == 0);
+	test_assert(test_errors_count > 0);
+	test_expect_errors = FALSE;
+	mail_cache_view_close(&cache_view);
+	mail_index_view_close(&view);
+
+	test_index_deinit(&t);
+	test_end();
+}
+
+static void test_mail_cache_columns_corrupted(void)
+{
+	uoff_t col_hdr_offset = sizeof(struct mail_cache_header);
+	uoff_t field_offset = col_hdr_offset +
+		sizeof(struct mail_cache_column_header);
+
+	i_set_error_handler(test_columns_error_handler);
+	test_columns_corrupt("size", col_hdr_offset +
+		offsetof(struct mail_cache_column_header, size),
+		(uint32_t)-1, FALSE);
+	test_columns_corrupt("short size", col_hdr_offset +
+		offsetof(struct mail_cache_column_header, size),
+		sizeof(struct mail_cache_column_header), FALSE);
+	test_columns_corrupt("uids offset", col_hdr_offset +
+		offsetof(struct mail_cache_column_header, uids_offset),
+		0x7fffff00, FALSE);
+	test_columns_corrupt("field index", field_offset +
+		offsetof(struct mail_cache_column_field, file_field_idx),
+		1000, FALSE);
+	test_columns_corrupt("field size", field_offset +
+		offsetof(struct mail_cache_column_field, field_size),
+		3, FALSE);
+	test_columns_corrupt("data offset", field_offset +
+		offsetof(struct mail_cache_column_field, data_offset),
+		0x7fffff00, FALSE);
+	test_columns_corrupt("truncated", field_offset, 0, TRUE);
+}
+
+int main(void)
+{
+	static void (*test_functions[])(void) = {
+		test_mail_cache_columns_init,
+		test_mail_cache_columns_lookup,
+		test_mail_cache_columns_max_size,
+		test_mail_cache_columns_corrupted,
+		NULL
+	};
+	return test_run(test_functions);
+}
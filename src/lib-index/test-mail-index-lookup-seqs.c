@@ -0,0 +1,307 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "array.h"
+#include "ioloop.h"
+#include "hostpid.h"
+#include "seq-range-array.h"
+#include "unlink-directory.h"
+#include "test-common.h"
+#include "mail-index-private.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#define TEST_MESSAGES_COUNT 200
+#define TEST_APPEND_COUNT 10
+
+static const char *test_keyword_names[] = { "a", "b", "c", NULL };
+
+struct test_index {
+	struct ioloop *ioloop;
+	char *dir;
+	struct mail_index *index;
+};
+
+static enum mail_flags test_flags(uint32_t seq)
+{
+	return (seq % 3 == 0 ? MAIL_SEEN : 0) |
+		(seq % 5 == 0 ? MAIL_FLAGGED : 0) |
+		(seq % 11 == 0 ? MAIL_DELETED : 0);
+}
+
+static void
+test_set_keywords(struct mail_index_transaction *trans, uint32_t seq)
+{
+	struct mail_keywords *kw;
+	const char *names[4];
+	unsigned int count = 0;
+
+	if (seq % 2 == 0)
+		names[count++] = "a";
+	if (seq % 7 == 0)
+		names[count++] = "b";
+	if (seq % 13 == 0)
+		names[count++] = "c";
+	names[count] = NULL;
+
+	kw = mail_index_keywords_create(trans->view->index, names);
+	mail_index_update_keywords(trans, seq, MODIFY_REPLACE, kw);
+	mail_index_keywords_unref(&kw);
+}
+
+static void test_index_init(struct test_index *t)
+{
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	uint32_t seq, new_seq, uid_validity = 1;
+
+	memset(t, 0, sizeof(*t));
+	t->ioloop = io_loop_create();
+	t->dir = i_strdup_printf("/tmp/test-mail-index-lookup-seqs.%s.XXXXXX",
+				 my_pid);
+	if (mkdtemp(t->dir) == NULL)
+		i_fatal("mkdtemp(%s) failed: %m", t->dir);
+	t->index = mail_index_alloc(t->dir, "dovecot.index");
+	if (mail_index_open_or_create(t->index,
+				      MAIL_INDEX_OPEN_FLAG_CREATE) < 0)
+		i_fatal("mail_index_open_or_create() failed: %s",
+			mail_index_get_error_message(t->index));
+
+	view = mail_index_view_open(t->index);
+	trans = mail_index_transaction_begin(view, 0);
+	mail_index_update_header(trans,
+		offsetof(struct mail_index_header, uid_validity),
+		&uid_validity, sizeof(uid_validity), TRUE);
+	for (seq = 1; seq <= TEST_MESSAGES_COUNT; seq++) {
+		mail_index_append(trans, seq, &new_seq);
+		mail_index_update_flags(trans, new_seq, MODIFY_REPLACE,
+					test_flags(seq));
+		test_set_keywords(trans, new_seq);
+	}
+	if (mail_index_transaction_commit(&trans) < 0)
+		i_fatal("mail_index_transaction_commit() failed");
+	mail_index_view_close(&view);
+}
+
+static void test_index_deinit(struct test_index *t)
+{
+	mail_index_close(t->index);
+	mail_index_free(&t->index);
+	if (unlink_directory(t->dir, UNLINK_DIRECTORY_FLAG_RMDIR) < 0)
+		i_error("unlink_directory(%s) failed: %m", t->dir);
+	i_free(t->dir);
+	io_loop_destroy(&t->ioloop);
+}
+
+static bool
+test_seqs_equal(const ARRAY_TYPE(seq_range) *seqs1,
+		const ARRAY_TYPE(seq_range) *seqs2)
+{
+	const struct seq_range *r1, *r2;
+	unsigned int i, count1, count2;
+
+	r1 = array_get(seqs1, &count1);
+	r2 = array_get(seqs2, &count2);
+	if (count1 != count2)
+		return FALSE;
+	for (i = 0; i < count1; i++) {
+		if (r1[i].seq1 != r2[i].seq1 || r1[i].seq2 != r2[i].seq2)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+static void
+test_lookup_flags(struct mail_index_view *view, uint32_t seq1, uint32_t seq2,
+		  enum mail_flags flags, uint8_t flags_mask)
+{
+	ARRAY_TYPE(seq_range) seqs, expected;
+	const struct mail_index_record *rec;
+	uint32_t seq;
+
+	t_array_init(&seqs, 8);
+	t_array_init(&expected, 8);
+	for (seq = seq1; seq <= seq2; seq++) {
+		rec = mail_index_lookup(view, seq);
+		if ((rec->flags & flags_mask) == (uint8_t)flags)
+			seq_range_array_add(&expected, seq);
+	}
+	mail_index_lookup_flags_seqs(view, seq1, seq2, flags, flags_mask,
+				     &seqs);
+	test_assert(test_seqs_equal(&seqs, &expected));
+}
+
+static void
+test_lookup_keywords(struct mail_index_view *view,
+		     uint32_t seq1, uint32_t seq2, const char *const *names)
+{
+	ARRAY_TYPE(seq_range) seqs, expected;
+	ARRAY_TYPE(keyword_indexes) keyword_idx;
+	struct mail_keywords *kw;
+	const unsigned int *idx;
+	unsigned int i, j, count;
+	uint32_t seq;
+
+	kw = mail_index_keywords_create(view->index, names);
+	t_array_init(&seqs, 8);
+	t_array_init(&expected, 8);
+	t_array_init(&keyword_idx, 8);
+	for (seq = seq1; seq <= seq2; seq++) {
+		array_clear(&keyword_idx);
+		mail_index_lookup_keywords(view, seq, &keyword_idx);
+		idx = array_get(&keyword_idx, &count);
+		for (i = 0; i < kw->count; i++) {
+			for (j = 0; j < count; j++) {
+				if (idx[j] == kw->idx[i])
+					break;
+			}
+			if (j == count)
+				break;
+		}
+		if (i == kw->count)
+			seq_range_array_add(&expected, seq);
+	}
+	mail_index_lookup_keywords_seqs(view, seq1, seq2, kw, &seqs);
+	test_assert(test_seqs_equal(&seqs, &expected));
+	mail_index_keywords_unref(&kw);
+}
+
+static void test_lookups(struct mail_index_view *view)
+{
+	static const char *kw_a[] = { "a", NULL };
+	static const char *kw_b[] = { "b", NULL };
+	static const char *kw_ab[] = { "a", "b", NULL };
+	static const char *kw_abc[] = { "a", "b", "c", NULL };
+	uint32_t count = mail_index_view_get_messages_count(view);
+	uint32_t ranges[][2] = {
+		{ 1, count }, { 1, 1 }, { count, count },
+		{ 7, count / 2 }, { count / 3, count }
+	};
+	unsigned int i;
+
+	for (i = 0; i < N_ELEMENTS(ranges); i++) T_BEGIN {
+		uint32_t seq1 = ranges[i][0], seq2 = ranges[i][1];
+
+		test_lookup_flags(view, seq1, seq2, MAIL_SEEN, MAIL_SEEN);
+		test_lookup_flags(view, seq1, seq2, 0, MAIL_SEEN);
+		test_lookup_flags(view, seq1, seq2, MAIL_SEEN | MAIL_FLAGGED,
+				  MAIL_SEEN | MAIL_FLAGGED | MAIL_DELETED);
+		test_lookup_flags(view, seq1, seq2, 0, 0);
+		test_lookup_keywords(view, seq1, seq2, kw_a);
+		test_lookup_keywords(view, seq1, seq2, kw_b);
+		test_lookup_keywords(view, seq1, seq2, kw_ab);
+		test_lookup_keywords(view, seq1, seq2, kw_abc);
+	} T_END;
+}
+
+static void test_mail_index_lookup_seqs_view(void)
+{
+	struct test_index t;
+	struct mail_index_view *view;
+
+	test_begin("mail index lookup seqs: view");
+	test_index_init(&t);
+	view = mail_index_view_open(t.index);
+	test_assert(mail_index_view_get_messages_count(view) ==
+		    TEST_MESSAGES_COUNT);
+	test_lookups(view);
+	mail_index_view_close(&view);
+	test_index_deinit(&t);
+	test_end();
+}
+
+static void
+test_transaction_changes(struct mail_index_transaction *trans)
+{
+	struct mail_keywords *kw;
+	uint32_t seq, new_seq;
+
+	mail_index_update_flags_range(trans, 10, 30, MODIFY_ADD, MAIL_SEEN);
+	mail_index_update_flags(trans, 45, MODIFY_REMOVE, MAIL_FLAGGED);
+	mail_index_update_flags(trans, 50, MODIFY_REPLACE, 0);
+
+	kw = mail_index_keywords_create(trans->view->index,
+					test_keyword_names);
+	for (seq = 60; seq <= 80; seq++)
+		mail_index_update_keywords(trans, seq, MODIFY_ADD, kw);
+	mail_index_update_keywords(trans, 98, MODIFY_REMOVE, kw);
+	mail_index_keywords_unref(&kw);
+
+	for (seq = 1; seq <= TEST_APPEND_COUNT; seq++) {
+		mail_index_append(trans, 0, &new_seq);
+		mail_index_update_flags(trans, new_seq, MODIFY_REPLACE,
+					test_flags(seq));
+		test_set_keywords(trans, new_seq);
+	}
+}
+
+static void test_mail_index_lookup_seqs_transaction(void)
+{
+	struct test_index t;
+	struct mail_index_view *view, *tview;
+	struct mail_index_transaction *trans;
+
+	test_begin("mail index lookup seqs: transaction view");
+	test_index_init(&t);
+	view = mail_index_view_open(t.index);
+	trans = mail_index_transaction_begin(view, 0);
+
+	/* no changes - everything is looked up from the parent view */
+	tview = mail_index_transaction_open_updated_view(trans);
+	test_lookups(tview);
+	mail_index_view_close(&tview);
+
+	test_transaction_changes(trans);
+	tview = mail_index_transaction_open_updated_view(trans);
+	test_assert(mail_index_view_get_messages_count(tview) ==
+		    TEST_MESSAGES_COUNT + TEST_APPEND_COUNT);
+	test_lookups(tview);
+	mail_index_view_close(&tview);
+
+	mail_index_transaction_rollback(&trans);
+	mail_index_view_close(&view);
+	test_index_deinit(&t);
+	test_end();
+}
+
+static void test_mail_index_lookup_seqs_reset(void)
+{
+	struct test_index t;
+	struct mail_index_view *view, *tview;
+	struct mail_index_transaction *trans;
+	ARRAY_TYPE(seq_range) seqs;
+
+	test_begin("mail index lookup seqs: reset transaction view");
+	test_index_init(&t);
+	view = mail_index_view_open(t.index);
+	trans = mail_index_transaction_begin(view, 0);
+	mail_index_reset(trans);
+	test_transaction_changes(trans);
+
+	/* the existing messages are still returned the same way as by
+	   mail_index_lookup() */
+	tview = mail_index_transaction_open_updated_view(trans);
+	test_lookups(tview);
+	t_array_init(&seqs, 8);
+	mail_index_lookup_flags_seqs(tview, 1, TEST_MESSAGES_COUNT, 0, 0,
+				     &seqs);
+	test_assert(seq_range_count(&seqs) == TEST_MESSAGES_COUNT);
+	mail_index_view_close(&tview);
+
+	mail_index_transaction_rollback(&trans);
+	mail_index_view_close(&view);
+	test_index_deinit(&t);
+	test_end();
+}
+
+int main(void)
+{
+	static void (*test_functions[])(void) = {
+		test_mail_index_lookup_seqs_view,
+		test_mail_index_lookup_seqs_transaction,
+		test_mail_index_lookup_seqs_reset,
+		NULL
+	};
+	return test_run(test_functions);
+}
@@ -0,0 +1,212 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "test-common.h"
+#include "mail-index-private.h"
+
+#define CHUNK_COUNT MAIL_INDEX_RECORD_CHUNK_COUNT
+
+static void test_map_append(struct mail_index_map *map, unsigned int count)
+{
+	struct mail_index_record *rec;
+	unsigned int i;
+
+	for (i = 0; i < count; i++) {
+		rec = mail_index_record_map_append_space(map);
+		memset(rec, 0, map->hdr.record_size);
+		rec->uid = map->hdr.next_uid++;
+		map->rec_map->records_count++;
+		map->rec_map->last_appended_uid = rec->uid;
+		map->hdr.messages_count++;
+	}
+}
+
+static struct mail_index_map *
+test_map_create(struct mail_index *index, unsigned int count)
+{
+	struct mail_index_map *map;
+
+	map = mail_index_map_alloc(index);
+	test_map_append(map, count);
+	return map;
+}
+
+static struct mail_index_map *test_map_private_clone(struct mail_index_map *map)
+{
+	struct mail_index_map *new_map;
+
+	new_map = mail_index_map_clone(map);
+	test_assert(new_map->rec_map == map->rec_map);
+	mail_index_record_map_move_to_private(new_map);
+	test_assert(new_map->rec_map != map->rec_map);
+	return new_map;
+}
+
+/* Returns TRUE if the map's records have UIDs first_uid.. except for the
+   expunged range. */
+static bool
+test_map_uids_equal(struct mail_index_map *map, uint32_t first_uid,
+		    uint32_t count, uint32_t expunged_uid1,
+		    uint32_t expunged_uid2)
+{
+	const struct mail_index_record *rec;
+	uint32_t idx, uid = first_uid;
+
+	if (map->rec_map->records_count != count)
+		return FALSE;
+	for (idx = 0; idx < count; idx++, uid++) {
+		if (uid == expunged_uid1)
+			uid = expunged_uid2 + 1;
+		rec = MAIL_INDEX_MAP_IDX(map, idx);
+		if (rec->uid != uid)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+static void test_mail_index_map_chunk_cow(void)
+{
+	struct mail_index *index;
+	struct mail_index_map *map, *map2;
+	struct mail_index_record *rec;
+	void *chunk;
+	unsigned int i;
+
+	test_begin("mail index map chunk copy-on-write");
+	index = mail_index_alloc(NULL, "test");
+	map = test_map_create(index, CHUNK_COUNT * 3 - 10);
+	test_assert(map->rec_map->chunks_count == 3);
+
+	/* making the map private shares all the chunks */
+	map2 = test_map_private_clone(map);
+	test_assert(map2->rec_map->chunks_count == 3);
+	for (i = 0; i < 3; i++)
+		test_assert(map2->rec_map->chunks[i] == map->rec_map->chunks[i]);
+
+	/* modifying a record copies only its chunk */
+	rec = mail_index_map_idx_modifiable(map2, CHUNK_COUNT + 5);
+	rec->flags = MAIL_SEEN;
+	test_assert(map2->rec_map->chunks[0] == map->rec_map->chunks[0]);
+	test_assert(map2->rec_map->chunks[1] != map->rec_map->chunks[1]);
+	test_assert(map2->rec_map->chunks[2] == map->rec_map->chunks[2]);
+	test_assert(MAIL_INDEX_MAP_IDX(map, CHUNK_COUNT + 5)->flags == 0);
+	test_assert(MAIL_INDEX_MAP_IDX(map2, CHUNK_COUNT + 5)->flags == MAIL_SEEN);
+	test_assert(test_map_uids_equal(map, 1, CHUNK_COUNT * 3 - 10, 0, 0));
+	test_assert(test_map_uids_equal(map2, 1, CHUNK_COUNT * 3 - 10, 0, 0));
+
+	/* the copied chunk is now private, so it's modified in place */
+	chunk = map2->rec_map->chunks[1];
+	rec = mail_index_map_idx_modifiable(map2, CHUNK_COUNT + 6);
+	rec->flags = MAIL_FLAGGED;
+	test_assert(map2->rec_map->chunks[1] == chunk);
+
+	/* unreferencing the original map keeps the shared chunks alive for
+	   map2, after which they're no longer shared */
+	mail_index_unmap(&map);
+	test_assert(test_map_uids_equal(map2, 1, CHUNK_COUNT * 3 - 10, 0, 0));
+	chunk = map2->rec_map->chunks[0];
+	rec = mail_index_map_idx_modifiable(map2, 0);
+	rec->flags = MAIL_ANSWERED;
+	test_assert(map2->rec_map->chunks[0] == chunk);
+	test_assert(MAIL_INDEX_MAP_IDX(map2, 0)->flags == MAIL_ANSWERED);
+
+	mail_index_unmap(&map2);
+	mail_index_free(&index);
+	test_end();
+}
+
+static void test_mail_index_map_chunk_expunge(void)
+{
+	struct mail_index *index;
+	struct mail_index_map *map, *map2;
+	uint32_t count = CHUNK_COUNT * 3 - 10;
+
+	test_begin("mail index map chunk expunge");
+	index = mail_index_alloc(NULL, "test");
+	map = test_map_create(index, count);
+
+	/* expunge a range spanning the first chunk boundary */
+	map2 = test_map_private_clone(map);
+	mail_index_record_map_delete(map2, CHUNK_COUNT - 10, 20);
+	map2->hdr.messages_count -= 20;
+	test_assert(test_map_uids_equal(map2, 1, count - 20,
+					CHUNK_COUNT - 9, CHUNK_COUNT + 10));
+	test_assert(map2->rec_map->chunks_count == 3);
+	test_assert(test_map_uids_equal(map, 1, count, 0, 0));
+	mail_index_unmap(&map2);
+
+	/* expunge the tail, dropping the last chunk. nothing is moved,
+	   so the remaining chunks stay shared. */
+	map2 = test_map_private_clone(map);
+	mail_index_record_map_delete(map2, CHUNK_COUNT * 2 - 8,
+				     count - (CHUNK_COUNT * 2 - 8));
+	map2->hdr.messages_count = CHUNK_COUNT * 2 - 8;
+	test_assert(test_map_uids_equal(map2, 1, CHUNK_COUNT * 2 - 8, 0, 0));
+	test_assert(map2->rec_map->chunks_count == 2);
+	test_assert(map2->rec_map->chunks[0] == map->rec_map->chunks[0]);
+	test_assert(map2->rec_map->chunks[1] == map->rec_map->chunks[1]);
+	test_assert(test_map_uids_equal(map, 1, count, 0, 0));
+	mail_index_unmap(&map2);
+
+	/* expunge whole chunks from the beginning */
+	map2 = test_map_private_clone(map);
+	mail_index_record_map_delete(map2, 0, CHUNK_COUNT * 2);
+	map2->hdr.messages_count -= CHUNK_COUNT * 2;
+	test_assert(test_map_uids_equal(map2, CHUNK_COUNT * 2 + 1,
+					count - CHUNK_COUNT * 2, 0, 0));
+	test_assert(map2->rec_map->chunks_count == 1);
+	test_assert(test_map_uids_equal(map, 1, count, 0, 0));
+	mail_index_unmap(&map2);
+
+	mail_index_unmap(&map);
+	mail_index_free(&index);
+	test_end();
+}
+
+static void test_mail_index_map_chunk_append(void)
+{
+	struct mail_index *index;
+	struct mail_index_map *map, *map2;
+	uint32_t count = CHUNK_COUNT - 4;
+
+	test_begin("mail index map chunk append");
+	index = mail_index_alloc(NULL, "test");
+	map = test_map_create(index, count);
+	test_assert(map->rec_map->chunks_count == 1);
+
+	/* appending to a shared chunk copies it and continues to a new
+	   chunk that is grown as needed */
+	map2 = test_map_private_clone(map);
+	test_map_append(map2, 100);
+	test_assert(test_map_uids_equal(map2, 1, count + 100, 0, 0));
+	test_assert(map2->rec_map->chunks_count == 2);
+	test_assert(map2->rec_map->chunks[0] != map->rec_map->chunks[0]);
+	test_assert(map2->rec_map->last_appended_uid == count + 100);
+
+	/* the original map didn't change */
+	test_assert(test_map_uids_equal(map, 1, count, 0, 0));
+	test_assert(map->rec_map->chunks_count == 1);
+	mail_index_unmap(&map);
+
+	/* fill the second chunk exactly and continue to a third one */
+	test_map_append(map2, CHUNK_COUNT * 2 - (count + 100));
+	test_assert(map2->rec_map->chunks_count == 2);
+	test_map_append(map2, 1);
+	test_assert(map2->rec_map->chunks_count == 3);
+	test_assert(test_map_uids_equal(map2, 1, CHUNK_COUNT * 2 + 1, 0, 0));
+
+	mail_index_unmap(&map2);
+	mail_index_free(&index);
+	test_end();
+}
+
+int main(void)
+{
+	static void (*test_functions[])(void) = {
+		test_mail_index_map_chunk_cow,
+		test_mail_index_map_chunk_expunge,
+		test_mail_index_map_chunk_append,
+		NULL
+	};
+	return test_run(test_functions);
+}
@@ -0,0 +1,333 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "ioloop.h"
+#include "hostpid.h"
+#include "mkdir-parents.h"
+#include "unlink-directory.h"
+#include "test-common.h"
+#include "mail-index-private.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+/* enough appends for the log to grow past MAIL_INDEX_SHM_MIN_WRITE_BYTES,
+   but not past MAIL_INDEX_MAX_WRITE_BYTES */
+#define TEST_APPEND_COUNT 300
+
+struct test_shm {
+	struct ioloop *ioloop;
+	char *dir;
+	const char *index_dir, *shm_dir;
+};
+
+static bool test_expect_errors;
+static unsigned int test_errors_count;
+
+static void ATTR_FORMAT(2, 0)
+test_shm_error_handler(const struct failure_context *ctx,
+		       const char *format, va_list args)
+{
+	if (test_expect_errors) {
+		test_errors_count++;
+		return;
+	}
+	default_error_handler(ctx, format, args);
+	test_assert(!"unexpected error");
+}
+
+static struct mail_index *test_index_open(struct test_shm *t)
+{
+	struct mail_index *index;
+
+	index = mail_index_alloc(t->index_dir, "dovecot.index");
+	mail_index_set_shm_dir(index, t->shm_dir);
+	if (mail_index_open_or_create(index, MAIL_INDEX_OPEN_FLAG_CREATE) < 0)
+		i_fatal("mail_index_open_or_create() failed: %s",
+			mail_index_get_error_message(index));
+	return index;
+}
+
+static void test_index_close(struct mail_index **_index)
+{
+	struct mail_index *index = *_index;
+
+	*_index = NULL;
+	mail_index_close(index);
+	mail_index_free(&index);
+}
+
+static void test_index_sync(struct mail_index *index)
+{
+	struct mail_index_sync_ctx *ctx;
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	struct mail_index_sync_rec sync_rec;
+
+	if (mail_index_sync_begin(index, &ctx, &view, &trans, 0) < 0)
+		i_fatal("mail_index_sync_begin() failed: %s",
+			mail_index_get_error_message(index));
+	while (mail_index_sync_next(ctx, &sync_rec)) ;
+	if (mail_index_sync_commit(&ctx) < 0)
+		i_fatal("mail_index_sync_commit() failed: %s",
+			mail_index_get_error_message(index));
+}
+
+static void test_index_append(struct mail_index *index, unsigned int count)
+{
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	uint32_t i, seq, next_uid, uid_validity = ioloop_time;
+
+	view = mail_index_view_open(index);
+	next_uid = mail_index_get_header(view)->next_uid;
+	trans = mail_index_transaction_begin(view, 0);
+	mail_index_update_header(trans,
+		offsetof(struct mail_index_header, uid_validity),
+		&uid_validity, sizeof(uid_validity), TRUE);
+	for (i = 0; i < count; i++)
+		mail_index_append(trans, next_uid + i, &seq);
+	if (mail_index_transaction_commit(&trans) < 0)
+		i_fatal("mail_index_transaction_commit() failed: %s",
+			mail_index_get_error_message(index));
+	mail_index_view_close(&view);
+	test_index_sync(index);
+}
+
+static struct mail_index *test_index_create(struct test_shm *t)
+{
+	struct mail_index *index;
+
+	/* snapshots are written only while dovecot.index is open. normally
+	   it's first written when the log is rotated, so force it here. */
+	index = test_index_open(t);
+	test_index_append(index, 1);
+	index->last_read_log_file_seq = index->map->hdr.log_file_seq;
+	index->need_recreate = TRUE;
+	test_index_sync(index);
+	test_index_close(&index);
+
+	index = test_index_open(t);
+	i_assert(index->fd != -1);
+	return index;
+}
+
+static const char *test_shm_path(struct mail_index *index)
+{
+	struct stat st;
+
+	if (fstat(index->fd, &st) < 0)
+		i_fatal("fstat(%s) failed: %m", index->filepath);
+	return mail_index_get_shm_path(index, &st);
+}
+
+static void test_shm_init(struct test_shm *t)
+{
+	memset(t, 0, sizeof(*t));
+	t->ioloop = io_loop_create();
+	t->dir = i_strdup_printf("/tmp/test-mail-index-shm.%s.XXXXXX",
+				 my_pid);
+	if (mkdtemp(t->dir) == NULL)
+		i_fatal("mkdtemp(%s) failed: %m", t->dir);
+	t->index_dir = t_strconcat(t->dir, "/index", NULL);
+	t->shm_dir = t_strconcat(t->dir, "/shm/dovecot/user", NULL);
+	if (mkdir(t->index_dir, 0700) < 0)
+		i_fatal("mkdir(%s) failed: %m", t->index_dir);
+	/* the shared parent is created by the admin */
+	if (mkdir_parents(t_strconcat(t->dir, "/shm/dovecot", NULL), 0700) < 0)
+		i_fatal("mkdir_parents(%s/shm/dovecot) failed: %m", t->dir);
+}
+
+static void test_shm_deinit(struct test_shm *t)
+{
+	if (unlink_directory(t->dir, UNLINK_DIRECTORY_FLAG_RMDIR) < 0)
+		i_error("unlink_directory(%s) failed: %m", t->dir);
+	i_free(t->dir);
+	io_loop_destroy(&t->ioloop);
+}
+
+static void test_mail_index_shm_write(void)
+{
+	struct test_shm t;
+	struct mail_index *index;
+	struct stat st;
+	mode_t old_mask;
+
+	test_begin("mail index shm write");
+	old_mask = umask(022);
+	test_shm_init(&t);
+	index = test_index_create(&t);
+	test_index_append(index, TEST_APPEND_COUNT);
+
+	test_assert(index->shm_path != NULL &&
+		    strcmp(index->shm_path, test_shm_path(index)) == 0);
+	test_assert(stat(test_shm_path(index), &st) == 0);
+
+	/* the user's directory is private */
+	test_assert(lstat(t.shm_dir, &st) == 0 && S_ISDIR(st.st_mode) &&
+		    (st.st_mode & 07777) == 0700);
+
+	test_index_close(&index);
+	test_shm_deinit(&t);
+	umask(old_mask);
+	test_end();
+}
+
+static void test_mail_index_shm_read(void)
+{
+	struct test_shm t;
+	struct mail_index *index, *index2;
+	struct mail_index_view *view;
+	const struct mail_index_record *rec;
+	uint32_t seq, count;
+
+	test_begin("mail index shm read");
+	test_shm_init(&t);
+	index = test_index_create(&t);
+	test_index_append(index, TEST_APPEND_COUNT);
+	test_assert(index->shm_path != NULL);
+
+	/* the second open maps the snapshot instead of replaying the log */
+	index2 = test_index_open(&t);
+	test_assert(index2->shm_path != NULL &&
+		    strcmp(index2->shm_path, index->shm_path) == 0);
+	test_assert(index2->map->hdr.log_file_head_offset ==
+		    index->map->hdr.log_file_head_offset);
+
+	view = mail_index_view_open(index2);
+	count = mail_index_view_get_messages_count(view);
+	test_assert(count == TEST_APPEND_COUNT + 1);
+	for (seq = 1; seq <= count; seq++) {
+		rec = mail_index_lookup(view, seq);
+		test_assert(rec->uid == seq);
+	}
+	mail_index_view_close(&view);
+
+	/* changes after the snapshot are still read from the log */
+	test_index_append(index, 1);
+	test_assert(mail_index_refresh(index2) == 0);
+	view = mail_index_view_open(index2);
+	test_assert(mail_index_view_get_messages_count(view) ==
+		    TEST_APPEND_COUNT + 2);
+	mail_index_view_close(&view);
+
+	test_index_close(&index2);
+	test_index_close(&index);
+	test_shm_deinit(&t);
+	test_end();
+}
+
+static void test_mail_index_shm_unlink(void)
+{
+	struct test_shm t;
+	struct mail_index *index;
+	const char *shm_path, *index_path;
+	struct stat st;
+
+	test_begin("mail index shm unlink");
+	test_shm_init(&t);
+	index = test_index_create(&t);
+	test_index_append(index, TEST_APPEND_COUNT);
+	shm_path = t_strdup(test_shm_path(index));
+	index_path = t_strdup(index->filepath);
+	test_assert(stat(shm_path, &st) == 0);
+
+	/* deleting the index by path (e.g. mailbox rename) */
+	mail_index_unlink_shm_file(t.shm_dir, index_path);
+	test_assert(stat(shm_path, &st) < 0 && errno == ENOENT);
+
+	/* deleting the index */
+	test_index_append(index, TEST_APPEND_COUNT);
+	test_assert(stat(shm_path, &st) == 0);
+	test_assert(mail_index_unlink(index) == 0);
+	test_assert(stat(shm_path, &st) < 0 && errno == ENOENT);
+
+	test_index_close(&index);
+	test_shm_deinit(&t);
+	test_end();
+}
+
+static void test_shm_unsafe_dir(struct test_shm *t)
+{
+	struct mail_index *index;
+
+	test_expect_errors = TRUE;
+	test_errors_count = 0;
+	index = test_index_create(t);
+	test_index_append(index, TEST_APPEND_COUNT);
+	test_assert(test_errors_count > 0);
+	test_expect_errors = FALSE;
+
+	/* snapshots are disabled, so nothing was written */
+	test_assert(index->shm_dir == NULL && index->shm_path == NULL);
+	test_index_close(&index);
+}
+
+static void test_mail_index_shm_unsafe_dir(void)
+{
+	struct test_shm t;
+	const char *other_dir;
+
+	test_begin("mail index shm unsafe dir");
+	i_set_error_handler(test_shm_error_handler);
+
+	/* accessible by other users */
+	test_shm_init(&t);
+	if (mkdir(t.shm_dir, 0700) < 0 || chmod(t.shm_dir, 0777) < 0)
+		i_fatal("mkdir(%s) failed: %m", t.shm_dir);
+	test_shm_unsafe_dir(&t);
+	test_shm_deinit(&t);
+
+	/* symlink to someone else's directory */
+	test_shm_init(&t);
+	other_dir = t_strconcat(t.dir, "/other", NULL);
+	if (mkdir(other_dir, 0700) < 0)
+		i_fatal("mkdir(%s) failed: %m", other_dir);
+	if (symlink(other_dir, t.shm_dir) < 0)
+		i_fatal("symlink(%s) failed: %m", t.shm_dir);
+	test_shm_unsafe_dir(&t);
+	test_shm_deinit(&t);
+	test_end();
+}
+
+static void test_mail_index_shm_no_parent(void)
+{
+	struct test_shm t;
+	struct mail_index *index;
+	const char *parent;
+
+	test_begin("mail index shm no parent");
+	i_set_error_handler(test_shm_error_handler);
+	test_shm_init(&t);
+
+	/* the missing parent isn't created */
+	parent = t_strconcat(t.dir, "/shm/dovecot", NULL);
+	if (rmdir(parent) < 0)
+		i_fatal("rmdir(%s) failed: %m", parent);
+	test_expect_errors = TRUE;
+	test_errors_count = 0;
+	index = test_index_create(&t);
+	test_index_append(index, TEST_APPEND_COUNT);
+	test_assert(test_errors_count == 1);
+	test_expect_errors = FALSE;
+	test_assert(index->shm_dir == NULL && index->shm_path == NULL);
+	test_index_close(&index);
+
+	test_shm_deinit(&t);
+	test_end();
+}
+
+int main(void)
+{
+	static void (*test_functions[])(void) = {
+		test_mail_index_shm_write,
+		test_mail_index_shm_read,
+		test_mail_index_shm_unlink,
+		test_mail_index_shm_unsafe_dir,
+		test_mail_index_shm_no_parent,
+		NULL
+	};
+	return test_run(test_functions);
+}
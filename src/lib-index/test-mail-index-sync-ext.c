@@ -32,6 +32,14 @@ bool mail_index_lookup_seq(struct mail_index_view *view ATTR_UNUSED,
 	*seq_r = uid;
 	return TRUE;
 }
+void mail_index_record_map_init_records(struct mail_index_map *map ATTR_UNUSED,
+					unsigned int records_count ATTR_UNUSED) {}
+void mail_index_record_map_free_chunks(struct mail_index_record_map *rec_map ATTR_UNUSED) {}
+struct mail_index_record *
+mail_index_map_idx_modifiable(struct mail_index_map *map, uint32_t idx)
+{
+	return PTR_OFFSET(map->rec_map->chunks[0], idx * map->hdr.record_size);
+}
 
 static void test_mail_index_sync_ext_atomic_inc(void)
 {
@@ -48,12 +56,13 @@ static void test_mail_index_sync_ext_atomic_inc(void)
 	ctx.view->map->hdr.next_uid = 2;
 	ctx.view->map->hdr.record_size = sizeof(struct mail_index_record) + 16;
 	ctx.view->map->rec_map = t_new(struct mail_index_record_map, 1);
-	ctx.view->map->rec_map->records =
+	ctx.view->map->rec_map->chunks = t_new(void *, 1);
+	ctx.view->map->rec_map->chunks[0] =
 		t_malloc(ctx.view->map->hdr.record_size);
 	t_array_init(&ctx.view->map->extensions, 4);
 	ext = array_append_space(&ctx.view->map->extensions);
 	ext->record_offset = sizeof(struct mail_index_record);
-	ptr = PTR_OFFSET(ctx.view->map->rec_map->records, ext->record_offset);
+	ptr = PTR_OFFSET(ctx.view->map->rec_map->chunks[0], ext->record_offset);
 
 	memset(&u, 0, sizeof(u));
 	test_assert(mail_index_sync_ext_atomic_inc(&ctx, &u) == -1);
@@ -0,0 +1,332 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "ioloop.h"
+#include "hostpid.h"
+#include "time-util.h"
+#include "unlink-directory.h"
+#include "test-common.h"
+#include "mail-index-private.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+/* enough records for several chunks, so that changing one of them is
+   written in-place */
+#define TEST_MESSAGES_COUNT (MAIL_INDEX_RECORD_CHUNK_COUNT * 4)
+#define TEST_WRITER_DELAY_MSECS 100
+
+struct test_write {
+	struct ioloop *ioloop;
+	char *dir;
+	struct mail_index *index;
+};
+
+static bool test_expect_errors;
+static unsigned int test_errors_count;
+
+static void ATTR_FORMAT(2, 0)
+test_write_error_handler(const struct failure_context *ctx,
+			 const char *format, va_list args)
+{
+	if (test_expect_errors) {
+		test_errors_count++;
+		return;
+	}
+	default_error_handler(ctx, format, args);
+	test_assert(!"unexpected error");
+}
+
+static struct mail_index *test_index_open(struct test_write *t)
+{
+	struct mail_index *index;
+
+	index = mail_index_alloc(t->dir, "dovecot.index");
+	if (mail_index_open_or_create(index, MAIL_INDEX_OPEN_FLAG_CREATE |
+				      MAIL_INDEX_OPEN_FLAG_INPLACE_WRITE) < 0)
+		i_fatal("mail_index_open_or_create() failed: %s",
+			mail_index_get_error_message(index));
+	return index;
+}
+
+static void test_index_close(struct mail_index **_index)
+{
+	struct mail_index *index = *_index;
+
+	*_index = NULL;
+	mail_index_close(index);
+	mail_index_free(&index);
+}
+
+static void test_index_sync_write(struct mail_index *index)
+{
+	struct mail_index_sync_ctx *ctx;
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	struct mail_index_sync_rec sync_rec;
+
+	if (mail_index_sync_begin(index, &ctx, &view, &trans, 0) < 0)
+		i_fatal("mail_index_sync_begin() failed: %s",
+			mail_index_get_error_message(index));
+	while (mail_index_sync_next(ctx, &sync_rec)) ;
+
+	/* dovecot.index is normally written only after enough changes */
+	index->last_read_log_file_seq = index->map->hdr.log_file_seq;
+	index->need_recreate = TRUE;
+	if (mail_index_sync_commit(&ctx) < 0)
+		i_fatal("mail_index_sync_commit() failed: %s",
+			mail_index_get_error_message(index));
+}
+
+static void test_index_update_flags(struct mail_index *index, uint32_t seq,
+				    enum mail_flags flags)
+{
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+
+	view = mail_index_view_open(index);
+	trans = mail_index_transaction_begin(view, 0);
+	mail_index_update_flags(trans, seq, MODIFY_REPLACE, flags);
+	if (mail_index_transaction_commit(&trans) < 0)
+		i_fatal("mail_index_transaction_commit() failed: %s",
+			mail_index_get_error_message(index));
+	mail_index_view_close(&view);
+	test_index_sync_write(index);
+}
+
+static void test_write_init(struct test_write *t)
+{
+	struct mail_index_view *view;
+	struct mail_index_transaction *trans;
+	uint32_t seq, new_seq, uid_validity = 1;
+
+	memset(t, 0, sizeof(*t));
+	t->ioloop = io_loop_create();
+	t->dir = i_strdup_printf("/tmp/test-mail-index-write.%s.XXXXXX",
+				 my_pid);
+	if (mkdtemp(t->dir) == NULL)
+		i_fatal("mkdtemp(%s) failed: %m", t->dir);
+
+	t->index = test_index_open(t);
+	view = mail_index_view_open(t->index);
+	trans = mail_index_transaction_begin(view, 0);
+	mail_index_update_header(trans,
+		offsetof(struct mail_index_header, uid_validity),
+		&uid_validity, sizeof(uid_validity), TRUE);
+	for (seq = 1; seq <= TEST_MESSAGES_COUNT; seq++)
+		mail_index_append(trans, seq, &new_seq);
+	if (mail_index_transaction_commit(&trans) < 0)
+		i_fatal("mail_index_transaction_commit() failed");
+	mail_index_view_close(&view);
+
+	/* the first write recreates the file */
+	test_index_sync_write(t->index);
+	test_assert(t->index->written != NULL);
+}
+
+static void test_write_deinit(struct test_write *t)
+{
+	test_index_close(&t->index);
+	if (unlink_directory(t->dir, UNLINK_DIRECTORY_FLAG_RMDIR) < 0)
+		i_error("unlink_directory(%s) failed: %m", t->dir);
+	i_free(t->dir);
+	io_loop_destroy(&t->ioloop);
+}
+
+static ino_t test_index_file_ino(struct mail_index *index)
+{
+	struct stat st;
+
+	if (stat(index->filepath, &st) < 0)
+		i_fatal("stat(%s) failed: %m", index->filepath);
+	return st.st_ino;
+}
+
+static uint32_t test_index_file_write_seq(struct mail_index *index)
+{
+	uint32_t write_seq;
+	int fd;
+
+	fd = open(index->filepath, O_RDONLY);
+	if (fd == -1)
+		i_fatal("open(%s) failed: %m", index->filepath);
+	if (pread(fd, &write_seq, sizeof(write_seq),
+		  offsetof(struct mail_index_header, write_seq)) !=
+	    sizeof(write_seq))
+		i_fatal("pread(%s) failed: %m", index->filepath);
+	i_close_fd(&fd);
+	return write_seq;
+}
+
+static void test_index_file_set_write_seq(struct mail_index *index,
+					  uint32_t write_seq)
+{
+	int fd;
+
+	fd = open(index->filepath, O_WRONLY);
+	if (fd == -1)
+		i_fatal("open(%s) failed: %m", index->filepath);
+	if (pwrite(fd, &write_seq, sizeof(write_seq),
+		   offsetof(struct mail_index_header, write_seq)) !=
+	    sizeof(write_seq))
+		i_fatal("pwrite(%s) failed: %m", index->filepath);
+	i_close_fd(&fd);
+}
+
+/* Open the index with another handle and check that it sees the flag
+   changes. */
+static bool
+test_index_reread(struct test_write *t, uint32_t changed_seq,
+		  enum mail_flags changed_flags)
+{
+	struct mail_index *index;
+	struct mail_index_view *view;
+	const struct mail_index_record *rec;
+	uint32_t seq;
+	bool ret = TRUE;
+
+	index = test_index_open(t);
+	view = mail_index_view_open(index);
+	if (mail_index_view_get_messages_count(view) != TEST_MESSAGES_COUNT)
+		ret = FALSE;
+	for (seq = 1; seq <= TEST_MESSAGES_COUNT && ret; seq++) {
+		rec = mail_index_lookup(view, seq);
+		if (rec->uid != seq ||
+		    rec->flags != (seq == changed_seq ? changed_flags : 0))
+			ret = FALSE;
+	}
+	mail_index_view_close(&view);
+	test_index_close(&index);
+	return ret;
+}
+
+static void test_mail_index_write_inplace(void)
+{
+	struct test_write t;
+	uint32_t seq = MAIL_INDEX_RECORD_CHUNK_COUNT + 10;
+	uint32_t write_seq;
+	ino_t ino;
+
+	test_begin("mail index write in-place");
+	test_write_init(&t);
+	ino = test_index_file_ino(t.index);
+	write_seq = test_index_file_write_seq(t.index);
+	test_assert(write_seq % 2 == 0);
+
+	/* changing one chunk is written in-place */
+	test_index_update_flags(t.index, seq, MAIL_SEEN);
+	test_assert(test_index_file_ino(t.index) == ino);
+	test_assert(test_index_file_write_seq(t.index) == write_seq + 2);
+	test_assert(t.index->map->hdr.write_seq == write_seq + 2);
+	test_assert(test_index_reread(&t, seq, MAIL_SEEN));
+
+	/* and again, now on top of the previous in-place write */
+	test_index_update_flags(t.index, seq, MAIL_FLAGGED);
+	test_assert(test_index_file_ino(t.index) == ino);
+	test_assert(test_index_file_write_seq(t.index) == write_seq + 4);
+	test_assert(test_index_reread(&t, seq, MAIL_FLAGGED));
+
+	test_write_deinit(&t);
+	test_end();
+}
+
+static void test_mail_index_write_inplace_read_retry(void)
+{
+	struct test_write t;
+	struct timeval tv_start, tv_end;
+	uint32_t seq = 10;
+	uint32_t write_seq;
+	pid_t pid;
+	int status;
+
+	test_begin("mail index write in-place read retry");
+	test_write_init(&t);
+	test_index_update_flags(t.index, seq, MAIL_SEEN);
+	write_seq = test_index_file_write_seq(t.index);
+
+	/* a writer is in the middle of an in-place write and finishes it
+	   a bit later. the reader must wait for it instead of using the
+	   file or treating it as corrupted. */
+	test_index_file_set_write_seq(t.index, write_seq + 1);
+	if (gettimeofday(&tv_start, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	pid = fork();
+	if (pid == (pid_t)-1)
+		i_fatal("fork() failed: %m");
+	if (pid == 0) {
+		usleep(TEST_WRITER_DELAY_MSECS * 1000);
+		test_index_file_set_write_seq(t.index, write_seq + 2);
+		_exit(0);
+	}
+	test_assert(test_index_reread(&t, seq, MAIL_SEEN));
+	if (gettimeofday(&tv_end, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	test_assert(timeval_diff_msecs(&tv_end, &tv_start) >=
+		    TEST_WRITER_DELAY_MSECS);
+	if (waitpid(pid, &status, 0) < 0)
+		i_fatal("waitpid() failed: %m");
+	test_assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+	test_write_deinit(&t);
+	test_end();
+}
+
+static void test_mail_index_write_inplace_crashed(void)
+{
+	struct test_write t;
+	struct mail_index *index;
+	struct mail_index_view *view;
+	struct stat st;
+	uint32_t seq = 10;
+	uint32_t write_seq;
+	ino_t ino;
+
+	test_begin("mail index write in-place crashed");
+	i_set_error_handler(test_write_error_handler);
+	test_write_init(&t);
+	test_index_update_flags(t.index, seq, MAIL_SEEN);
+	ino = test_index_file_ino(t.index);
+	write_seq = test_index_file_write_seq(t.index);
+
+	/* the writer crashed in the middle of an in-place write. the next
+	   writer doesn't trust the file and recreates it. */
+	test_index_file_set_write_seq(t.index, write_seq + 1);
+	test_index_update_flags(t.index, seq, MAIL_DELETED);
+	test_assert(test_index_file_ino(t.index) != ino);
+	test_assert(test_index_file_write_seq(t.index) % 2 == 0);
+	test_assert(test_index_reread(&t, seq, MAIL_DELETED));
+
+	/* without a writer, readers give up waiting. the file is treated
+	   as corrupted and the index is reset, so the mailbox gets
+	   resynced. */
+	write_seq = test_index_file_write_seq(t.index);
+	test_index_file_set_write_seq(t.index, write_seq + 1);
+	test_expect_errors = TRUE;
+	test_errors_count = 0;
+	index = test_index_open(&t);
+	test_assert(test_errors_count > 0);
+	test_expect_errors = FALSE;
+	view = mail_index_view_open(index);
+	test_assert(mail_index_view_get_messages_count(view) == 0);
+	mail_index_view_close(&view);
+	test_assert(stat(index->filepath, &st) < 0 && errno == ENOENT);
+	test_index_close(&index);
+
+	test_write_deinit(&t);
+	test_end();
+}
+
+int main(void)
+{
+	static void (*test_functions[])(void) = {
+		test_mail_index_write_inplace,
+		test_mail_index_write_inplace_read_retry,
+		test_mail_index_write_inplace_crashed,
+		NULL
+	};
+	return test_run(test_functions);
+}
@@ -17,6 +17,11 @@ void mail_index_file_set_syscall_error(struct mail_index *index ATTR_UNUSED,
 {
 }
 
+void mail_index_fchown(struct mail_index *index ATTR_UNUSED,
+		       int fd ATTR_UNUSED, const char *path ATTR_UNUSED)
+{
+}
+
 int mail_transaction_log_lock_head(struct mail_transaction_log *log ATTR_UNUSED)
 {
 	return log_lock_failure ? -1 : 0;
@@ -114,6 +119,126 @@ static void test_append_sync_offset(struct mail_transaction_log *log)
 	test_end();
 }
 
+static void test_append_packed(struct mail_transaction_log *log)
+{
+	static const struct mail_transaction_flag_update updates[] = {
+		{ 1, 1, MAIL_SEEN, 0, 0, 0 },
+		{ 5, 10, 0, MAIL_DELETED, 1, 0 },
+		{ 100000, 100000, MAIL_ANSWERED, 0, 0, 0 }
+	};
+	struct mail_transaction_log_file *file = log->head;
+	struct mail_transaction_log_append_ctx *ctx;
+	const struct mail_transaction_header *hdr;
+	enum mail_transaction_type type;
+	const char *error;
+	buffer_t *buf;
+	uint32_t size;
+
+	test_begin("transaction log append: packed");
+	buffer_set_used_size(file->buffer, 0);
+	file->buffer_offset = 0;
+	file->hdr.minor_version = MAIL_TRANSACTION_LOG_PACKED_MINOR_VERSION;
+	log->index->flags |= MAIL_INDEX_OPEN_FLAG_LOG_PACKED;
+
+	test_assert(mail_transaction_log_append_begin(log->index, 0, &ctx) == 0);
+	mail_transaction_log_append_add(ctx, MAIL_TRANSACTION_FLAG_UPDATE,
+					updates, sizeof(updates));
+	test_assert(mail_transaction_log_append_commit(&ctx) == 0);
+
+	/* single change, so there's no boundary */
+	hdr = file->buffer->data;
+	test_assert(hdr->type == MAIL_TRANSACTION_PACKED);
+	size = mail_index_offset_to_uint32(hdr->size) - sizeof(*hdr);
+	test_assert(size < sizeof(updates) && size % 4 == 0);
+
+	buf = buffer_create_dynamic(pool_datastack_create(), 64);
+	test_assert(mail_transaction_unpack(hdr + 1, size, &type, buf,
+					    &error) == 0);
+	test_assert(type == MAIL_TRANSACTION_FLAG_UPDATE);
+	test_assert(buf->used == sizeof(updates) &&
+		    memcmp(buf->data, updates, sizeof(updates)) == 0);
+
+	/* the file's format decides, not just the flag */
+	buffer_set_used_size(file->buffer, 0);
+	file->buffer_offset = 0;
+	file->hdr.minor_version = MAIL_TRANSACTION_LOG_MINOR_VERSION;
+	test_assert(mail_transaction_log_append_begin(log->index, 0, &ctx) == 0);
+	mail_transaction_log_append_add(ctx, MAIL_TRANSACTION_FLAG_UPDATE,
+					updates, sizeof(updates));
+	test_assert(mail_transaction_log_append_commit(&ctx) == 0);
+	hdr = file->buffer->data;
+	test_assert(hdr->type == MAIL_TRANSACTION_FLAG_UPDATE);
+
+	log->index->flags &= ~MAIL_INDEX_OPEN_FLAG_LOG_PACKED;
+	test_end();
+}
+
+static void test_append_group_fsync(struct mail_transaction_log *log, int fd,
+				    const char *path)
+{
+	static unsigned int buf[] = { 0x12345678 };
+	struct mail_transaction_log_file *file = log->head;
+	struct mail_transaction_log_append_ctx *ctx;
+	struct mail_transaction_log_fsync_stats stats;
+	struct mail_transaction_log_group_sync rec;
+	const char *sync_path;
+
+	test_begin("transaction log append: group fsync");
+	log->filepath = i_strdup(path);
+	log->group_sync_fd = -1;
+	log->index->flags |= MAIL_INDEX_OPEN_FLAG_FSYNC_GROUP_COMMIT;
+	log->index->fsync_mode = FSYNC_MODE_ALWAYS;
+	log->index->mode = 0600;
+	log->index->max_lock_timeout_secs = 1;
+	file->log = log;
+	file->hdr.file_seq = 2;
+	file->fd = fd;
+	file->sync_offset = file->last_size = 0;
+	file->buffer_offset = 0;
+	buffer_set_used_size(file->buffer, 0);
+
+	/* nothing synced yet: we must sync ourself */
+	test_assert(mail_transaction_log_append_begin(log->index, 0, &ctx) == 0);
+	mail_transaction_log_append_add(ctx, MAIL_TRANSACTION_APPEND,
+					&buf[0], sizeof(buf[0]));
+	test_assert(mail_transaction_log_append_commit(&ctx) == 0);
+	mail_transaction_log_get_fsync_stats(log, &stats);
+	test_assert(stats.solo_syncs == 1 && stats.batched_syncs == 0);
+
+	test_assert(pread(log->group_sync_fd, &rec, sizeof(rec), 0) == sizeof(rec));
+	test_assert(rec.file_seq == 2 && rec.synced_offset == file->sync_offset);
+
+	/* another process has already synced past our write */
+	rec.synced_offset = file->sync_offset + 1024;
+	test_assert(pwrite(log->group_sync_fd, &rec, sizeof(rec), 0) == sizeof(rec));
+	test_assert(mail_transaction_log_append_begin(log->index, 0, &ctx) == 0);
+	mail_transaction_log_append_add(ctx, MAIL_TRANSACTION_APPEND,
+					&buf[0], sizeof(buf[0]));
+	test_assert(mail_transaction_log_append_commit(&ctx) == 0);
+	mail_transaction_log_get_fsync_stats(log, &stats);
+	test_assert(stats.solo_syncs == 1 && stats.batched_syncs == 1);
+
+	/* the synced offset belongs to an older log file */
+	rec.file_seq = 1;
+	test_assert(pwrite(log->group_sync_fd, &rec, sizeof(rec), 0) == sizeof(rec));
+	test_assert(mail_transaction_log_append_begin(log->index, 0, &ctx) == 0);
+	mail_transaction_log_append_add(ctx, MAIL_TRANSACTION_APPEND,
+					&buf[0], sizeof(buf[0]));
+	test_assert(mail_transaction_log_append_commit(&ctx) == 0);
+	mail_transaction_log_get_fsync_stats(log, &stats);
+	test_assert(stats.solo_syncs == 2 && stats.batched_syncs == 1);
+
+	sync_path = t_strconcat(path, MAIL_TRANSACTION_LOG_GROUP_SYNC_SUFFIX, NULL);
+	if (close(log->group_sync_fd) < 0)
+		i_fatal("close(%s) failed: %m", sync_path);
+	log->group_sync_fd = -1;
+	(void)unlink(sync_path);
+	log->index->flags &= ~MAIL_INDEX_OPEN_FLAG_FSYNC_GROUP_COMMIT;
+	log->index->fsync_mode = FSYNC_MODE_OPTIMIZED;
+	file->fd = -1;
+	test_end();
+}
+
 static void test_mail_transaction_log_append(void)
 {
 	struct mail_transaction_log *log;
@@ -143,6 +268,7 @@ static void test_mail_transaction_log_append(void)
 	test_end();
 
 	test_append_sync_offset(log);
+	test_append_packed(log);
 
 	/* do this after head->buffer has already been initialized */
 	test_begin("transaction log append: garbage truncation");
@@ -157,6 +283,8 @@ static void test_mail_transaction_log_append(void)
 	file->fd = -1;
 	test_end();
 
+	test_append_group_fsync(log, fd, tmp_path);
+
 	unlink(tmp_path);
 }
 
@@ -0,0 +1,182 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "buffer.h"
+#include "numpack.h"
+#include "test-common.h"
+#include "mail-transaction-log.h"
+
+struct test_ext_rec {
+	uint32_t uid;
+	uint8_t data[6];
+	uint8_t padding[2];
+};
+
+static void
+test_pack_roundtrip(enum mail_transaction_type type, const void *data,
+		    size_t size, size_t record_size)
+{
+	enum mail_transaction_type unpacked_type;
+	buffer_t *packed, *unpacked;
+	const char *error;
+
+	packed = buffer_create_dynamic(pool_datastack_create(), 64);
+	unpacked = buffer_create_dynamic(pool_datastack_create(), 64);
+	test_assert(mail_transaction_pack(type, data, size, record_size,
+					  packed));
+	test_assert(packed->used % 4 == 0);
+	test_assert(packed->used < size);
+	test_assert(mail_transaction_packed_get_type(packed->data,
+						     packed->used) == type);
+
+	test_assert(mail_transaction_unpack(packed->data, packed->used,
+					    &unpacked_type, unpacked,
+					    &error) == 0);
+	test_assert(unpacked_type == type);
+	test_assert(unpacked->used == size &&
+		    memcmp(unpacked->data, data, size) == 0);
+}
+
+static void test_mail_transaction_pack(void)
+{
+	static const struct mail_transaction_expunge expunges[] = {
+		{ 1, 5 }, { 7, 7 }, { 100, 1000 }, { 4000000000U, 4294967295U }
+	};
+	static const struct mail_transaction_flag_update updates[] = {
+		{ 1, 1, 0x01, 0, 0, 0 },
+		{ 5, 10, 0, 0x08, 1, 0 },
+		{ 100000, 100000, 0x02, 0x04, 0, 0 }
+	};
+	static const struct mail_transaction_keyword_reset resets[] = {
+		{ 10, 20 }, { 30, 30 }
+	};
+	static const struct test_ext_rec ext_recs[] = {
+		{ 3, { 1, 2, 3, 4, 5, 6 }, { 0, 0 } },
+		{ 4, { 0xff, 0, 0, 0, 0, 0xee }, { 0, 0 } },
+		{ 5000, { 0, 0, 0, 0, 0, 0 }, { 0, 0 } }
+	};
+	struct mail_transaction_keyword_update kw_hdr;
+	static const uint32_t kw_uids[] = { 1, 3, 10, 10, 12, 400 };
+	buffer_t *kw;
+
+	test_begin("mail transaction pack");
+	test_pack_roundtrip(MAIL_TRANSACTION_EXPUNGE |
+			    MAIL_TRANSACTION_EXPUNGE_PROT,
+			    expunges, sizeof(expunges), 0);
+	test_pack_roundtrip(MAIL_TRANSACTION_FLAG_UPDATE,
+			    updates, sizeof(updates), 0);
+	test_pack_roundtrip(MAIL_TRANSACTION_KEYWORD_RESET,
+			    resets, sizeof(resets), 0);
+	test_pack_roundtrip(MAIL_TRANSACTION_EXT_REC_UPDATE,
+			    ext_recs, sizeof(ext_recs), sizeof(ext_recs[0]));
+
+	memset(&kw_hdr, 0, sizeof(kw_hdr));
+	kw_hdr.modify_type = MODIFY_REMOVE;
+	kw_hdr.name_size = 5;
+	kw = buffer_create_dynamic(pool_datastack_create(), 64);
+	buffer_append(kw, &kw_hdr, sizeof(kw_hdr));
+	buffer_append(kw, "hello", kw_hdr.name_size);
+	buffer_append_zero(kw, 3);
+	buffer_append(kw, kw_uids, sizeof(kw_uids));
+	test_pack_roundtrip(MAIL_TRANSACTION_KEYWORD_UPDATE,
+			    kw->data, kw->used, 0);
+	test_end();
+}
+
+static void test_mail_transaction_pack_unsupported(void)
+{
+	static const struct mail_transaction_expunge unsorted[] = {
+		{ 10, 20 }, { 1, 5 }
+	};
+	static const struct mail_transaction_expunge inverted[] = {
+		{ 10, 5 }
+	};
+	static const uint32_t appends[8] = { 1, 0, 0, 0, 2, 0, 0, 0 };
+	buffer_t *buf;
+
+	test_begin("mail transaction pack: unsupported");
+	buf = buffer_create_dynamic(pool_datastack_create(), 64);
+	test_assert(!mail_transaction_pack(MAIL_TRANSACTION_EXPUNGE |
+					   MAIL_TRANSACTION_EXPUNGE_PROT,
+					   unsorted, sizeof(unsorted), 0, buf));
+	test_assert(!mail_transaction_pack(MAIL_TRANSACTION_EXPUNGE |
+					   MAIL_TRANSACTION_EXPUNGE_PROT,
+					   inverted, sizeof(inverted), 0, buf));
+	test_assert(!mail_transaction_pack(MAIL_TRANSACTION_APPEND,
+					   appends, sizeof(appends), 0, buf));
+	/* record size is required for extension records */
+	test_assert(!mail_transaction_pack(MAIL_TRANSACTION_EXT_REC_UPDATE,
+					   appends, sizeof(appends), 0, buf));
+	test_assert(buf->used == 0);
+	test_end();
+}
+
+static void test_mail_transaction_unpack_corrupted(void)
+{
+	static const struct mail_transaction_expunge expunges[] = {
+		{ 1, 5 }, { 7, 7 }
+	};
+	enum mail_transaction_type type;
+	buffer_t *packed, *dest;
+	const char *error;
+	size_t used;
+
+	test_begin("mail transaction unpack: corrupted");
+	packed = buffer_create_dynamic(pool_datastack_create(), 64);
+	dest = buffer_create_dynamic(pool_datastack_create(), 64);
+
+	/* unknown type */
+	numpack_encode(packed, MAIL_TRANSACTION_APPEND);
+	numpack_encode(packed, 0);
+	test_assert(mail_transaction_unpack(packed->data, packed->used,
+					    &type, dest, &error) < 0);
+
+	/* count larger than the data */
+	buffer_set_used_size(packed, 0);
+	numpack_encode(packed, MAIL_TRANSACTION_KEYWORD_RESET);
+	numpack_encode(packed, 1000000);
+	numpack_encode(packed, 1);
+	numpack_encode(packed, 1);
+	test_assert(mail_transaction_unpack(packed->data, packed->used,
+					    &type, dest, &error) < 0);
+
+	/* UID overflow */
+	buffer_set_used_size(packed, 0);
+	numpack_encode(packed, MAIL_TRANSACTION_KEYWORD_RESET);
+	numpack_encode(packed, 2);
+	numpack_encode(packed, 4294967295U);
+	numpack_encode(packed, 0);
+	numpack_encode(packed, 1);
+	numpack_encode(packed, 0);
+	test_assert(mail_transaction_unpack(packed->data, packed->used,
+					    &type, dest, &error) < 0);
+
+	/* truncated */
+	buffer_set_used_size(packed, 0);
+	test_assert(mail_transaction_pack(MAIL_TRANSACTION_EXPUNGE |
+					  MAIL_TRANSACTION_EXPUNGE_PROT,
+					  expunges, sizeof(expunges), 0,
+					  packed));
+	used = packed->used;
+	while (used > 0 && ((const uint8_t *)packed->data)[used-1] == 0)
+		used--;
+	test_assert(mail_transaction_unpack(packed->data, used - 1,
+					    &type, dest, &error) < 0);
+
+	/* trailing garbage */
+	buffer_append_zero(packed, 4);
+	test_assert(mail_transaction_unpack(packed->data, packed->used,
+					    &type, dest, &error) < 0);
+	test_end();
+}
+
+int main(void)
+{
+	static void (*test_functions[])(void) = {
+		test_mail_transaction_pack,
+		test_mail_transaction_pack_unsupported,
+		test_mail_transaction_unpack_corrupted,
+		NULL
+	};
+	return test_run(test_functions);
+}
@@ -107,11 +107,12 @@ static bool message_search_more_decoded2(struct message_search_context *ctx,
 	return FALSE;
 }
 
-bool message_search_more(struct message_search_context *ctx,
-			 struct message_block *raw_block)
+static bool message_search_decode(struct message_search_context *ctx,
+				  struct message_block *raw_block,
+				  bool skip_headers,
+				  struct message_block *block_r)
 {
 	struct message_header_line *hdr = raw_block->hdr;
-	struct message_block block;
 
 	if (raw_block->part != ctx->prev_part) {
 		/* part changes. we must change this before looking at
@@ -127,7 +128,7 @@ bool message_search_more(struct message_search_context *ctx,
 
 	if (hdr != NULL) {
 		handle_header(ctx, hdr);
-		if ((ctx->flags & MESSAGE_SEARCH_FLAG_SKIP_HEADERS) != 0) {
+		if (skip_headers) {
 			/* we want to search only message bodies, but
 			   but decoder needs some headers so that it can
 			   decode the body properly. */
@@ -143,15 +144,25 @@ bool message_search_more(struct message_search_context *ctx,
 		if (!ctx->content_type_text)
 			return FALSE;
 	}
-	if (!message_decoder_decode_next_block(ctx->decoder, raw_block, &block))
+	if (!message_decoder_decode_next_block(ctx->decoder, raw_block, block_r))
 		return FALSE;
 
-	if (block.hdr != NULL &&
-	    (ctx->flags & MESSAGE_SEARCH_FLAG_SKIP_HEADERS) != 0) {
+	if (block_r->hdr != NULL && skip_headers) {
 		/* Content-* header */
 		return FALSE;
 	}
+	return TRUE;
+}
+
+bool message_search_more(struct message_search_context *ctx,
+			 struct message_block *raw_block)
+{
+	struct message_block block;
+	bool skip_headers =
+		(ctx->flags & MESSAGE_SEARCH_FLAG_SKIP_HEADERS) != 0;
 
+	if (!message_search_decode(ctx, raw_block, skip_headers, &block))
+		return FALSE;
 	return message_search_more_decoded2(ctx, &block);
 }
 
@@ -228,3 +239,102 @@ int message_search_msg(struct message_search_context *ctx,
 	} T_END;
 	return ret;
 }
+
+static unsigned int
+message_search_multi_block(struct message_search_context *const *ctxs,
+			   unsigned int count, struct message_block *raw_block,
+			   bool skip_headers, bool *matched)
+{
+	struct message_search_context *ctx = ctxs[0];
+	struct message_block block;
+	unsigned int i, match_count = 0;
+
+	/* the first context's decoder is shared by all of the keys */
+	for (i = 1; i < count; i++) {
+		if (raw_block->part != ctxs[i]->prev_part) {
+			str_find_reset(ctxs[i]->str_find_ctx);
+			ctxs[i]->prev_part = raw_block->part;
+		}
+	}
+	if (!message_search_decode(ctx, raw_block, skip_headers, &block))
+		return 0;
+
+	for (i = 0; i < count; i++) {
+		if (matched[i])
+			continue;
+		if (block.hdr != NULL &&
+		    (ctxs[i]->flags & MESSAGE_SEARCH_FLAG_SKIP_HEADERS) != 0)
+			continue;
+		if (message_search_more_decoded2(ctxs[i], &block)) {
+			matched[i] = TRUE;
+			match_count++;
+		}
+	}
+	return match_count;
+}
+
+static int
+message_search_msg_multi_real(struct message_search_context *const *ctxs,
+			      unsigned int count, struct istream *input,
+			      struct message_part *parts, bool *matched)
+{
+	const enum message_header_parser_flags hdr_parser_flags =
+		MESSAGE_HEADER_PARSER_FLAG_CLEAN_ONELINE;
+	struct message_parser_ctx *parser_ctx;
+	struct message_block raw_block;
+	struct message_part *new_parts;
+	unsigned int i, unmatched_count = count;
+	bool skip_headers = TRUE;
+	int ret;
+
+	for (i = 0; i < count; i++) {
+		message_search_reset(ctxs[i]);
+		matched[i] = FALSE;
+		if ((ctxs[i]->flags & MESSAGE_SEARCH_FLAG_SKIP_HEADERS) == 0)
+			skip_headers = FALSE;
+	}
+
+	if (parts != NULL) {
+		parser_ctx = message_parser_init_from_parts(parts,
+						input, hdr_parser_flags, 0);
+	} else {
+		parser_ctx = message_parser_init(pool_datastack_create(),
+						 input, hdr_parser_flags, 0);
+	}
+
+	while ((ret = message_parser_parse_next_block(parser_ctx,
+						      &raw_block)) > 0) {
+		unmatched_count -= message_search_multi_block(ctxs, count,
+					&raw_block, skip_headers, matched);
+		if (unmatched_count == 0) {
+			ret = 1;
+			break;
+		}
+	}
+	i_assert(ret != 0);
+	if (ret < 0 && input->stream_errno == 0) {
+		/* normal exit */
+		ret = 0;
+	}
+	if (message_parser_deinit(&parser_ctx, &new_parts) < 0) {
+		/* broken parts */
+		input->stream_errno = 0;
+		ret = -1;
+	}
+	return ret;
+}
+
+int message_search_msg_multi(struct message_search_context *const *ctxs,
+			     unsigned int count, struct istream *input,
+			     struct message_part *parts, bool *matched_r)
+{
+	int ret;
+
+	i_assert(count > 0);
+
+	T_BEGIN {
+		ret = message_search_msg_multi_real(ctxs, count, input,
+						    parts, matched_r);
+	} T_END;
+	return ret;
+}
@@ -29,5 +29,14 @@ void message_search_reset(struct message_search_context *ctx);
 int message_search_msg(struct message_search_context *ctx,
 		       struct istream *input, struct message_part *parts)
 	ATTR_NULL(3);
+/* Search multiple keys from a full message while parsing and decoding it
+   only once. All the contexts must have been created with the same
+   normalizer. matched_r[i] is set to TRUE if ctxs[i]'s key was found.
+   Returns 1 if all keys were found, 0 if not, -1 on error the same way as
+   message_search_msg(). */
+int message_search_msg_multi(struct message_search_context *const *ctxs,
+			     unsigned int count, struct istream *input,
+			     struct message_part *parts, bool *matched_r)
+	ATTR_NULL(4);
 
 #endif
@@ -27,21 +27,42 @@ qp_is_end_of_line(const unsigned char *src, size_t *src_pos, size_t size)
 	return -1;
 }
 
+static inline size_t
+qp_find_next(const unsigned char *src, size_t pos, size_t size, int c)
+{
+	const unsigned char *p;
+
+	if (pos >= size)
+		return size;
+	p = memchr(src + pos, c, size - pos);
+	return p == NULL ? size : (size_t)(p - src);
+}
+
 static int
 quoted_printable_decode_full(const unsigned char *src, size_t src_size,
 			     size_t *src_pos_r, buffer_t *dest, bool eof)
 {
 	char hexbuf[3];
-	size_t src_pos, pos, next;
+	size_t src_pos, pos, next, eq_pos, lf_pos;
 	bool errors = FALSE;
 	int ret;
 
 	hexbuf[2] = '\0';
 
+	/* Use memchr() to find the next '=' and LF. Everything between them
+	   is literal data that gets appended with a single buffer_append() */
+	eq_pos = qp_find_next(src, 0, src_size, '=');
+	lf_pos = qp_find_next(src, 0, src_size, '\n');
+
 	next = 0;
-	for (src_pos = 0; src_pos < src_size; src_pos++) {
-		if (src[src_pos] != '=' && src[src_pos] != '\n')
-			continue;
+	for (src_pos = 0;; src_pos++) {
+		if (eq_pos < src_pos)
+			eq_pos = qp_find_next(src, src_pos, src_size, '=');
+		if (lf_pos < src_pos)
+			lf_pos = qp_find_next(src, src_pos, src_size, '\n');
+		src_pos = I_MIN(eq_pos, lf_pos);
+		if (src_pos >= src_size)
+			break;
 
 		if (src[src_pos] == '\n') {
 			/* drop trailing whitespace */
@@ -0,0 +1,112 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "istream.h"
+#include "charset-utf8.h"
+#include "message-search.h"
+#include "test-common.h"
+
+static const char test_msg[] =
+"From: user@example.com\n"
+"Subject: hello world\n"
+"Content-Type: multipart/mixed; boundary=\"foo\"\n"
+"\n"
+"--foo\n"
+"Content-Type: text/plain\n"
+"Content-Transfer-Encoding: quoted-printable\n"
+"\n"
+"first p=61rt body\n"
+"--foo\n"
+"Content-Type: application/octet-stream\n"
+"\n"
+"binary needle\n"
+"--foo\n"
+"Content-Type: text/plain\n"
+"Content-Transfer-Encoding: base64\n"
+"\n"
+"c2Vjb25kIHBhcnQgYm9keQ==\n"
+"--foo--\n";
+
+static const struct {
+	const char *key;
+	enum message_search_flags flags;
+	bool match;
+} test_keys[] = {
+	{ "first part", 0, TRUE },
+	{ "second part body", MESSAGE_SEARCH_FLAG_SKIP_HEADERS, TRUE },
+	{ "hello world", 0, TRUE },
+	{ "hello world", MESSAGE_SEARCH_FLAG_SKIP_HEADERS, FALSE },
+	{ "needle", 0, FALSE },
+	{ "part body--", 0, FALSE },
+	{ "text/plain", 0, TRUE },
+	{ "text/plain", MESSAGE_SEARCH_FLAG_SKIP_HEADERS, FALSE }
+};
+
+static void test_message_search_single(void)
+{
+	struct message_search_context *ctx;
+	struct istream *input;
+	unsigned int i;
+	int ret;
+
+	test_begin("message search");
+	input = i_stream_create_from_data(test_msg, sizeof(test_msg)-1);
+	for (i = 0; i < N_ELEMENTS(test_keys); i++) {
+		ctx = message_search_init(test_keys[i].key, NULL,
+					  test_keys[i].flags);
+		i_stream_seek(input, 0);
+		ret = message_search_msg(ctx, input, NULL);
+		test_assert(ret == (test_keys[i].match ? 1 : 0));
+		message_search_deinit(&ctx);
+	}
+	i_stream_unref(&input);
+	test_end();
+}
+
+static void test_message_search_multi(void)
+{
+	struct message_search_context *ctxs[N_ELEMENTS(test_keys)];
+	bool matched[N_ELEMENTS(test_keys)];
+	struct istream *input;
+	unsigned int i, first, count;
+	int ret;
+
+	test_begin("message search multi");
+	input = i_stream_create_from_data(test_msg, sizeof(test_msg)-1);
+	for (i = 0; i < N_ELEMENTS(test_keys); i++) {
+		ctxs[i] = message_search_init(test_keys[i].key, NULL,
+					      test_keys[i].flags);
+	}
+	/* try all the key ranges, so that each key gets to be the first one
+	   whose decoder is used */
+	for (first = 0; first < N_ELEMENTS(test_keys); first++) {
+		count = N_ELEMENTS(test_keys) - first;
+		i_stream_seek(input, 0);
+		ret = message_search_msg_multi(ctxs + first, count, input,
+					       NULL, matched);
+		test_assert(ret == (count == 1 && test_keys[first].match ? 1 : 0));
+		for (i = 0; i < count; i++)
+			test_assert(matched[i] == test_keys[first + i].match);
+	}
+
+	/* all found */
+	i_stream_seek(input, 0);
+	ret = message_search_msg_multi(ctxs, 3, input, NULL, matched);
+	test_assert(ret == 1);
+	test_assert(matched[0] && matched[1] && matched[2]);
+
+	for (i = 0; i < N_ELEMENTS(test_keys); i++)
+		message_search_deinit(&ctxs[i]);
+	i_stream_unref(&input);
+	test_end();
+}
+
+int main(void)
+{
+	static void (*test_functions[])(void) = {
+		test_message_search_single,
+		test_message_search_multi,
+		NULL
+	};
+	return test_run(test_functions);
+}
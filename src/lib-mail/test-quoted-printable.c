@@ -3,9 +3,12 @@
 #include "lib.h"
 #include "buffer.h"
 #include "str.h"
+#include "hex-binary.h"
 #include "quoted-printable.h"
 #include "test-common.h"
 
+#include <stdlib.h>
+
 struct test_quoted_printable_decode_data {
 	const char *input;
 	const char *output;
@@ -63,6 +66,106 @@ static void test_quoted_printable_decode(void)
 	test_end();
 }
 
+/* The original byte-at-a-time decoder, used as a reference */
+static int
+test_qp_decode_reference(const unsigned char *src, size_t src_size,
+			 size_t *src_pos_r, buffer_t *dest)
+{
+	char hexbuf[3];
+	size_t src_pos, pos, next, i;
+	bool errors = FALSE;
+
+	hexbuf[2] = '\0';
+
+	next = 0;
+	for (src_pos = 0; src_pos < src_size; src_pos++) {
+		if (src[src_pos] == '\n') {
+			pos = src_pos;
+			if (pos > 0 && src[pos-1] == '\r')
+				pos--;
+			while (pos > 0 && (src[pos-1] == ' ' || src[pos-1] == '\t'))
+				pos--;
+			buffer_append(dest, src + next, pos - next);
+			next = src_pos+1;
+			buffer_append(dest, "\r\n", 2);
+			continue;
+		}
+		if (src[src_pos] != '=')
+			continue;
+
+		buffer_append(dest, src + next, src_pos - next);
+		next = src_pos;
+
+		for (i = src_pos + 1; i < src_size; i++) {
+			if (src[i] != ' ' && src[i] != '\t' && src[i] != '\r')
+				break;
+		}
+		if (i < src_size && src[i] == '\n') {
+			src_pos = i;
+			next = src_pos+1;
+			continue;
+		}
+		if (i == src_size || src_pos+2 >= src_size)
+			break;
+
+		hexbuf[0] = src[src_pos+1];
+		hexbuf[1] = src[src_pos+2];
+		if (hex_to_binary(hexbuf, dest) == 0) {
+			src_pos += 2;
+			next = src_pos + 1;
+		} else {
+			errors = TRUE;
+			next = src_pos;
+		}
+	}
+	if (src_pos == src_size) {
+		if (src_pos > 0 && src[src_pos-1] == '\r')
+			src_pos--;
+		while (src_pos > 0 && (src[src_pos-1] == ' ' ||
+				       src[src_pos-1] == '\t'))
+			src_pos--;
+		buffer_append(dest, src + next, src_pos - next);
+		next = src_pos;
+	}
+	*src_pos_r = next;
+	return errors ? -1 : 0;
+}
+
+static void test_quoted_printable_decode_random(void)
+{
+	static const char *parts[] = {
+		"hello world", "foo", " ", "\t", "=3D", "=0a", "=\r\n", "=\n",
+		"= \n", "  \r\n", "\n", "\r", "=", "=A", "=Ax", "=xy"
+	};
+	string_t *input;
+	buffer_t *buf, *buf2;
+	unsigned int i, j, count;
+	size_t src_pos, src_pos2;
+	int ret, ret2;
+
+	test_begin("quoted printable decode random");
+	input = t_str_new(1024);
+	buf = buffer_create_dynamic(pool_datastack_create(), 1024);
+	buf2 = buffer_create_dynamic(pool_datastack_create(), 1024);
+	for (i = 0; i < 1000; i++) {
+		str_truncate(input, 0);
+		count = rand() % 100;
+		for (j = 0; j < count; j++)
+			str_append(input, parts[rand() % N_ELEMENTS(parts)]);
+
+		buffer_set_used_size(buf, 0);
+		buffer_set_used_size(buf2, 0);
+		ret = quoted_printable_decode(str_data(input), str_len(input),
+					      &src_pos, buf);
+		ret2 = test_qp_decode_reference(str_data(input),
+						str_len(input), &src_pos2, buf2);
+		test_assert(ret == ret2);
+		test_assert(src_pos == src_pos2);
+		test_assert(buffer_cmp(buf, buf2));
+	}
+	test_end();
+}
+
 static void test_quoted_printable_decode_final(void)
 {
 	static struct test_quoted_printable_decode_data data[] = {
@@ -120,6 +223,7 @@ int main(void)
 {
 	static void (*test_functions[])(void) = {
 		test_quoted_printable_decode,
+		test_quoted_printable_decode_random,
 		test_quoted_printable_decode_final,
 		test_quoted_printable_q_decode,
 		NULL
@@ -41,6 +41,7 @@ struct master_service {
 	unsigned int idle_kill_secs;
 
 	struct master_status master_status;
+	struct master_service_accept_stats accept_stats;
 	unsigned int last_sent_status_avail_count;
 	time_t last_sent_status_time;
 	struct timeout *to_status;
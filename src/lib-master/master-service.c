@@ -8,6 +8,9 @@
 #include "strescape.h"
 #include "env-util.h"
 #include "home-expand.h"
+#include "hostpid.h"
+#include "time-util.h"
+#include "mem-profile.h"
 #include "process-title.h"
 #include "restrict-access.h"
 #include "fd-close-on-exec.h"
@@ -41,6 +44,9 @@
    force it. */
 #define MASTER_SERVICE_DIE_TIMEOUT_MSECS (30*1000)
 
+/* Maximum number of connections to accept from a listener per wakeup */
+#define MASTER_SERVICE_MAX_ACCEPTS_PER_WAKEUP 32
+
 struct master_service *master_service;
 
 static void master_service_io_listeners_close(struct master_service *service);
@@ -89,6 +95,19 @@ sig_state_changed(const siginfo_t *si ATTR_UNUSED, void *context)
 	master_service_refresh_login_state(service);
 }
 
+static void
+sig_mem_profile_dump(const siginfo_t *si ATTR_UNUSED,
+		     void *context ATTR_UNUSED)
+{
+	const char *dir = mem_profile_get_dir();
+
+	if (dir == NULL) {
+		/* profiling isn't enabled for this process */
+		return;
+	}
+	(void)mem_profile_dump_file(t_strdup_printf("%s/%s", dir, my_pid));
+}
+
 static void master_service_verify_version_string(struct master_service *service)
 {
 	if (service->version_string != NULL &&
@@ -155,7 +174,9 @@ master_service_init(const char *name, enum master_service_flags flags,
 		i_strdup(master_service_getopt_string()) :
 		i_strconcat(getopt_str, master_service_getopt_string(), NULL);
 	service->flags = flags;
-	service->ioloop = io_loop_create();
+	service->ioloop = (flags & MASTER_SERVICE_FLAG_TIMING_WHEEL) != 0 ?
+		io_loop_create_flags(IO_LOOP_FLAG_TIMING_WHEEL) :
+		io_loop_create();
 	service->service_count_left = UINT_MAX;
 	service->config_fd = -1;
 
@@ -437,6 +458,12 @@ void master_service_init_finish(struct master_service *service)
 		lib_signals_set_handler(SIGUSR1, LIBSIG_FLAGS_SAFE,
 					sig_state_changed, service);
 	}
+#ifdef MEM_PROFILE_DUMP_SIGNAL
+	/* always catch the signal, so that a process without profiling
+	   enabled doesn't die because of it */
+	lib_signals_set_handler(MEM_PROFILE_DUMP_SIGNAL, LIBSIG_FLAGS_SAFE,
+				sig_mem_profile_dump, service);
+#endif
 
 	if ((service->flags & MASTER_SERVICE_FLAG_STANDALONE) == 0) {
 		if (fstat(MASTER_STATUS_FD, &st) < 0 || !S_ISFIFO(st.st_mode))
@@ -605,6 +632,12 @@ bool master_service_is_master_stopped(struct master_service *service)
 	return service->io_status_error == NULL;
 }
 
+const struct master_service_accept_stats *
+master_service_get_accept_stats(struct master_service *service)
+{
+	return &service->accept_stats;
+}
+
 void master_service_anvil_send(struct master_service *service, const char *cmd)
 {
 	ssize_t ret;
@@ -767,7 +800,28 @@ void master_service_deinit(struct master_service **_service)
 	lib_deinit();
 }
 
-static void master_service_listen(struct master_service_listener *l)
+static void
+master_service_accept_stats_update(struct master_service *service)
+{
+	struct master_service_accept_stats *stats = &service->accept_stats;
+	struct timeval tv_now;
+	long long usecs;
+
+	if (gettimeofday(&tv_now, NULL) < 0)
+		i_fatal("gettimeofday(): %m");
+	usecs = timeval_diff_usecs(&tv_now, &ioloop_timeval);
+	if (usecs < 0)
+		usecs = 0;
+
+	stats->accepts++;
+	stats->accept_latency_usecs += usecs;
+	if (stats->accept_latency_max_usecs < usecs)
+		stats->accept_latency_max_usecs = usecs;
+}
+
+/* Returns 1 if connection was accepted and there may be more, 0 if there was
+   nothing to accept, -1 if we shouldn't try accepting more now. */
+static int master_service_accept(struct master_service_listener *l)
 {
 	struct master_service *service = l->service;
 	struct master_service_connection conn;
@@ -781,7 +835,7 @@ static void master_service_listen(struct master_service_listener *l)
 
 		if (service->master_status.available_count == 0) {
 			master_service_io_listeners_remove(service);
-			return;
+			return -1;
 		}
 	}
 
@@ -793,7 +847,7 @@ static void master_service_listen(struct master_service_listener *l)
 		int orig_errno = errno;
 
 		if (conn.fd == -1)
-			return;
+			return 0;
 
 		if (errno == ENOTSOCK) {
 			/* it's not a socket. should be a fifo. */
@@ -806,7 +860,7 @@ static void master_service_listen(struct master_service_listener *l)
 			/* try again later after one of the existing
 			   connections has died */
 			master_service_io_listeners_remove(service);
-			return;
+			return -1;
 		}
 		/* use the "listener" as the connection fd and stop the
 		   listener. */
@@ -816,6 +870,8 @@ static void master_service_listen(struct master_service_listener *l)
 
 		io_remove(&l->io);
 		l->fd = -1;
+	} else {
+		master_service_accept_stats_update(service);
 	}
 	conn.ssl = l->ssl;
 	conn.name = l->name;
@@ -834,6 +890,36 @@ static void master_service_listen(struct master_service_listener *l)
 		   as real clients */
 		master_service_client_connection_destroyed(service);
 	}
+	/* the callback may have stopped listening */
+	return l->io == NULL ? -1 : 1;
+}
+
+static void master_service_listen(struct master_service_listener *l)
+{
+	struct master_service *service = l->service;
+	unsigned int i;
+	int ret;
+
+	service->accept_stats.wakeups++;
+
+	/* accept multiple connections per wakeup. with exclusive wakeups
+	   the other processes won't see the pending connections, so this
+	   also keeps them from piling up in the listen queue. */
+	for (i = 0; i < MASTER_SERVICE_MAX_ACCEPTS_PER_WAKEUP; i++) {
+		T_BEGIN {
+			ret = master_service_accept(l);
+		} T_END;
+		if (ret == 0 && i == 0)
+			service->accept_stats.wasted_wakeups++;
+		if (ret <= 0)
+			break;
+		if (service->master_status.available_count == 0) {
+			/* we just became full. don't call the overflow
+			   callback unless another connection is actually
+			   waiting, which the next wakeup tells us. */
+			break;
+		}
+	}
 }
 
 static void io_listeners_init(struct master_service *service)
@@ -873,7 +959,8 @@ void master_service_io_listeners_add(struct master_service *service)
 		struct master_service_listener *l = &service->listeners[i];
 
 		if (l->io == NULL && l->fd != -1) {
-			l->io = io_add(MASTER_LISTEN_FD_FIRST + i, IO_READ,
+			l->io = io_add(MASTER_LISTEN_FD_FIRST + i,
+				       IO_READ | IO_EXCLUSIVE,
 				       master_service_listen, l);
 		}
 	}
@@ -31,7 +31,10 @@ enum master_service_flags {
 	   listeners (i.e. the service does STARTTLS). */
 	MASTER_SERVICE_FLAG_USE_SSL_SETTINGS	= 0x200,
 	/* Don't initialize SSL context automatically. */
-	MASTER_SERVICE_FLAG_NO_SSL_INIT		= 0x400
+	MASTER_SERVICE_FLAG_NO_SSL_INIT		= 0x400,
+	/* Create the ioloop with IO_LOOP_FLAG_TIMING_WHEEL. Useful for
+	   processes that handle a lot of clients with idle timeouts. */
+	MASTER_SERVICE_FLAG_TIMING_WHEEL	= 0x800
 };
 
 struct master_service_connection {
@@ -51,6 +54,19 @@ struct master_service_connection {
 typedef void
 master_service_connection_callback_t(struct master_service_connection *conn);
 
+struct master_service_accept_stats {
+	/* Number of times a listener has woken up the process */
+	unsigned int wakeups;
+	/* Wakeups where there was nothing to accept, because another process
+	   already accepted the connection */
+	unsigned int wasted_wakeups;
+	/* Number of accepted connections */
+	unsigned int accepts;
+	/* Time from the ioloop wakeup until accept() returned */
+	unsigned long long accept_latency_usecs;
+	unsigned int accept_latency_max_usecs;
+};
+
 extern struct master_service *master_service;
 
 const char *master_service_getopt_string(void);
@@ -147,6 +163,9 @@ bool master_service_is_killed(struct master_service *service);
 /* Returns TRUE if our master process is already stopped. This process may or
    may not be dying itself. */
 bool master_service_is_master_stopped(struct master_service *service);
+/* Returns statistics about accepting new connections. */
+const struct master_service_accept_stats *
+master_service_get_accept_stats(struct master_service *service);
 
 /* Send command to anvil process, if we have fd to it. */
 void master_service_anvil_send(struct master_service *service, const char *cmd);
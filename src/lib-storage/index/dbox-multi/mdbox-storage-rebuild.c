@@ -4,8 +4,10 @@
 #include "array.h"
 #include "ioloop.h"
 #include "istream.h"
+#include "ostream.h"
 #include "hash.h"
 #include "str.h"
+#include "safe-mkstemp.h"
 #include "mail-cache.h"
 #include "index-rebuild.h"
 #include "mail-namespace.h"
@@ -19,6 +21,7 @@
 #include <stdlib.h>
 #include <dirent.h>
 #include <unistd.h>
+#include <sys/wait.h>
 
 struct mdbox_rebuild_msg {
 	struct mdbox_rebuild_msg *guid_hash_next;
@@ -34,6 +37,34 @@ struct mdbox_rebuild_msg {
 	unsigned int seen_zero_ref_in_map:1;
 };
 
+enum rebuild_worker_rec_type {
+	REBUILD_WORKER_REC_MSG = 1,
+	REBUILD_WORKER_REC_FILE_END
+};
+
+/* Scan results written by rebuild worker processes. Each file's messages
+   are followed by a FILE_END record. MSG records are followed by the
+   message's GUID string. */
+struct rebuild_worker_rec {
+	uint8_t type;
+	/* FILE_END: POP3 metadata seen in the files scanned so far */
+	uint8_t have_pop3_uidls;
+	uint8_t have_pop3_orders;
+	uint8_t unused;
+
+	uint32_t offset;
+	uint32_t rec_size;
+	uint32_t guid_len;
+	uint64_t mail_size;
+	guid_128_t guid_128;
+};
+
+struct rebuild_worker {
+	pid_t pid;
+	int fd;
+	struct istream *input;
+};
+
 struct rebuild_msg_mailbox {
 	struct mailbox *box;
 	struct mail_index_sync_ctx *sync_ctx;
@@ -51,6 +82,11 @@ struct mdbox_storage_rebuild_context {
 	HASH_TABLE(uint8_t *, struct mdbox_rebuild_msg *) guid_hash;
 	ARRAY(struct mdbox_rebuild_msg *) msgs;
 	ARRAY_TYPE(seq_range) seen_file_ids;
+	/* with mail_rebuild_concurrency>1 the files are scanned only after
+	   all of them have been found */
+	ARRAY_TYPE(uint32_t) scan_file_ids;
+	/* set in worker processes */
+	struct ostream *worker_output;
 
 	uint32_t rebuild_count;
 	uint32_t highest_file_id;
@@ -79,6 +115,8 @@ mdbox_storage_rebuild_init(struct mdbox_storage *storage,
 			  guid_128_hash, guid_128_cmp);
 	i_array_init(&ctx->msgs, 512);
 	i_array_init(&ctx->seen_file_ids, 128);
+	if (storage->storage.storage.set->mail_rebuild_concurrency > 1)
+		i_array_init(&ctx->scan_file_ids, 128);
 
 	ctx->storage->rebuilding_storage = TRUE;
 	return ctx;
@@ -94,6 +132,8 @@ mdbox_storage_rebuild_deinit(struct mdbox_storage_rebuild_context *ctx)
 	hash_table_destroy(&ctx->guid_hash);
 	pool_unref(&ctx->pool);
 	array_free(&ctx->seen_file_ids);
+	if (array_is_created(&ctx->scan_file_ids))
+		array_free(&ctx->scan_file_ids);
 	array_free(&ctx->msgs);
 	i_free(ctx);
 }
@@ -138,12 +178,71 @@ static void rebuild_scan_metadata(struct mdbox_storage_rebuild_context *ctx,
 		ctx->have_pop3_orders = TRUE;
 }
 
+static void rebuild_worker_add_msg(struct mdbox_storage_rebuild_context *ctx,
+				   const struct mdbox_rebuild_msg *msg,
+				   const char *guid)
+{
+	struct rebuild_worker_rec wrec;
+
+	memset(&wrec, 0, sizeof(wrec));
+	wrec.type = REBUILD_WORKER_REC_MSG;
+	wrec.offset = msg->offset;
+	wrec.rec_size = msg->rec_size;
+	wrec.guid_len = strlen(guid);
+	wrec.mail_size = msg->mail_size;
+	memcpy(wrec.guid_128, msg->guid_128, sizeof(wrec.guid_128));
+	o_stream_nsend(ctx->worker_output, &wrec, sizeof(wrec));
+	o_stream_nsend(ctx->worker_output, guid, wrec.guid_len);
+}
+
+static void rebuild_add_msg(struct mdbox_storage_rebuild_context *ctx,
+			    const struct mdbox_rebuild_msg *msg,
+			    const char *guid)
+{
+	uint8_t *guid_p;
+	struct mdbox_rebuild_msg *rec, *old_rec;
+
+	if (ctx->worker_output != NULL) {
+		rebuild_worker_add_msg(ctx, msg, guid);
+		return;
+	}
+
+	rec = p_new(ctx->pool, struct mdbox_rebuild_msg, 1);
+	*rec = *msg;
+	array_append(&ctx->msgs, &rec, 1);
+
+	guid_p = rec->guid_128;
+	old_rec = hash_table_lookup(ctx->guid_hash, guid_p);
+	if (old_rec == NULL)
+		hash_table_insert(ctx->guid_hash, guid_p, rec);
+	else if (rec->mail_size == old_rec->mail_size) {
+		/* two mails' GUID and size are the same, which quite
+		   likely means that their contents are the same as
+		   well. we'll compare the mail sizes instead of the
+		   record sizes, because the records' metadata may
+		   differ.
+
+		   save this duplicate mail with refcount=0 to the map,
+		   so it will eventually be purged. */
+		rec->seen_zero_ref_in_map = TRUE;
+	} else {
+		/* duplicate GUID, but not a duplicate message. */
+		i_error("mdbox %s: Duplicate GUID %s in "
+			"m.%u:%u (size=%"PRIuUOFF_T") and m.%u:%u "
+			"(size=%"PRIuUOFF_T")",
+			ctx->storage->storage_dir, guid,
+			old_rec->file_id, old_rec->offset, old_rec->mail_size,
+			rec->file_id, rec->offset, rec->mail_size);
+		rec->guid_hash_next = old_rec->guid_hash_next;
+		old_rec->guid_hash_next = rec;
+	}
+}
+
 static int rebuild_file_mails(struct mdbox_storage_rebuild_context *ctx,
 			      struct dbox_file *file, uint32_t file_id)
 {
 	const char *guid;
-	uint8_t *guid_p;
-	struct mdbox_rebuild_msg *rec, *old_rec;
+	struct mdbox_rebuild_msg msg;
 	uoff_t offset, prev_offset;
 	bool last, first, fixed = FALSE;
 	int ret;
@@ -191,40 +290,14 @@ static int rebuild_file_mails(struct mdbox_storage_rebuild_context *ctx,
 		}
 		rebuild_scan_metadata(ctx, file);
 
-		rec = p_new(ctx->pool, struct mdbox_rebuild_msg, 1);
-		rec->file_id = file_id;
-		rec->offset = offset;
-		rec->rec_size = file->input->v_offset - offset;
-		rec->mail_size = dbox_file_get_plaintext_size(file);
-		mail_generate_guid_128_hash(guid, rec->guid_128);
-		i_assert(!guid_128_is_empty(rec->guid_128));
-		array_append(&ctx->msgs, &rec, 1);
-
-		guid_p = rec->guid_128;
-		old_rec = hash_table_lookup(ctx->guid_hash, guid_p);
-		if (old_rec == NULL)
-			hash_table_insert(ctx->guid_hash, guid_p, rec);
-		else if (rec->mail_size == old_rec->mail_size) {
-			/* two mails' GUID and size are the same, which quite
-			   likely means that their contents are the same as
-			   well. we'll compare the mail sizes instead of the
-			   record sizes, because the records' metadata may
-			   differ.
-
-			   save this duplicate mail with refcount=0 to the map,
-			   so it will eventually be purged. */
-			rec->seen_zero_ref_in_map = TRUE;
-		} else {
-			/* duplicate GUID, but not a duplicate message. */
-			i_error("mdbox %s: Duplicate GUID %s in "
-				"m.%u:%u (size=%"PRIuUOFF_T") and m.%u:%u "
-				"(size=%"PRIuUOFF_T")",
-				ctx->storage->storage_dir, guid,
-				old_rec->file_id, old_rec->offset, old_rec->mail_size,
-				rec->file_id, rec->offset, rec->mail_size);
-			rec->guid_hash_next = old_rec->guid_hash_next;
-			old_rec->guid_hash_next = rec;
-		}
+		memset(&msg, 0, sizeof(msg));
+		msg.file_id = file_id;
+		msg.offset = offset;
+		msg.rec_size = file->input->v_offset - offset;
+		msg.mail_size = dbox_file_get_plaintext_size(file);
+		mail_generate_guid_128_hash(guid, msg.guid_128);
+		i_assert(!guid_128_is_empty(msg.guid_128));
+		rebuild_add_msg(ctx, &msg, guid);
 	}
 	if (ret < 0)
 		return -1;
@@ -259,14 +332,38 @@ rebuild_rename_file(struct mdbox_storage_rebuild_context *ctx,
 	return -1;
 }
 
+static int rebuild_scan_file(struct mdbox_storage_rebuild_context *ctx,
+			     uint32_t file_id)
+{
+	struct rebuild_worker_rec wrec;
+	struct dbox_file *file;
+	bool deleted;
+	int ret;
+
+	file = mdbox_file_init(ctx->storage, file_id);
+	if ((ret = dbox_file_open(file, &deleted)) > 0 && !deleted)
+		ret = rebuild_file_mails(ctx, file, file_id);
+	if (ret == 0) {
+		i_error("mdbox rebuild: Failed to fix file %s",
+			file->cur_path);
+	}
+	dbox_file_unref(&file);
+
+	if (ctx->worker_output != NULL) {
+		memset(&wrec, 0, sizeof(wrec));
+		wrec.type = REBUILD_WORKER_REC_FILE_END;
+		wrec.have_pop3_uidls = ctx->have_pop3_uidls;
+		wrec.have_pop3_orders = ctx->have_pop3_orders;
+		o_stream_nsend(ctx->worker_output, &wrec, sizeof(wrec));
+	}
+	return ret < 0 ? -1 : 0;
+}
+
 static int rebuild_add_file(struct mdbox_storage_rebuild_context *ctx,
 			    const char *dir, const char *fname)
 {
-	struct dbox_file *file;
 	uint32_t file_id;
 	const char *id_str, *ext;
-	bool deleted;
-	int ret = 0;
 
 	id_str = fname + strlen(MDBOX_MAIL_FILE_PREFIX);
 	if (str_to_uint32(id_str, &file_id) < 0 || file_id == 0) {
@@ -294,13 +391,11 @@ static int rebuild_add_file(struct mdbox_storage_rebuild_context *ctx,
 	}
 	seq_range_array_add(&ctx->seen_file_ids, file_id);
 
-	file = mdbox_file_init(ctx->storage, file_id);
-	if ((ret = dbox_file_open(file, &deleted)) > 0 && !deleted)
-		ret = rebuild_file_mails(ctx, file, file_id);
-	if (ret == 0)
-		i_error("mdbox rebuild: Failed to fix file %s/%s", dir, fname);
-	dbox_file_unref(&file);
-	return ret < 0 ? -1 : 0;
+	if (array_is_created(&ctx->scan_file_ids)) {
+		array_append(&ctx->scan_file_ids, &file_id, 1);
+		return 0;
+	}
+	return rebuild_scan_file(ctx, file_id);
 }
 
 static void
@@ -880,6 +975,194 @@ mdbox_storage_rebuild_scan_dir(struct mdbox_storage_rebuild_context *ctx,
 	return ret;
 }
 
+static void ATTR_NORETURN
+rebuild_worker_run(struct mdbox_storage_rebuild_context *ctx, int fd,
+		   unsigned int first_idx, unsigned int step)
+{
+	const uint32_t *file_ids;
+	unsigned int i, count;
+	int ret = 0;
+
+	ctx->worker_output = o_stream_create_fd(fd, IO_BLOCK_SIZE, FALSE);
+	file_ids = array_get(&ctx->scan_file_ids, &count);
+	for (i = first_idx; i < count && ret == 0; i += step) T_BEGIN {
+		ret = rebuild_scan_file(ctx, file_ids[i]);
+	} T_END;
+	if (o_stream_nfinish(ctx->worker_output) < 0) {
+		i_error("mdbox rebuild: write() to worker temp file failed: %m");
+		ret = -1;
+	}
+	/* don't run any of the parent's deinitialization */
+	_exit(ret < 0 ? 1 : 0);
+}
+
+static int
+rebuild_worker_start(struct mdbox_storage_rebuild_context *ctx,
+		     struct rebuild_worker *worker,
+		     unsigned int first_idx, unsigned int step)
+{
+	struct mail_storage *storage = &ctx->storage->storage.storage;
+	string_t *path;
+
+	path = t_str_new(256);
+	mail_user_set_get_temp_prefix(path, storage->user->set);
+	worker->fd = safe_mkstemp_hostpid(path, 0600, (uid_t)-1, (gid_t)-1);
+	if (worker->fd == -1) {
+		mail_storage_set_critical(storage,
+			"safe_mkstemp(%s) failed: %m", str_c(path));
+		return -1;
+	}
+	/* we just want the fd, unlink it */
+	if (unlink(str_c(path)) < 0) {
+		mail_storage_set_critical(storage,
+			"unlink(%s) failed: %m", str_c(path));
+		return -1;
+	}
+
+	worker->pid = fork();
+	if (worker->pid < 0) {
+		mail_storage_set_critical(storage, "fork() failed: %m");
+		return -1;
+	}
+	if (worker->pid == 0)
+		rebuild_worker_run(ctx, worker->fd, first_idx, step);
+	return 0;
+}
+
+static int rebuild_worker_wait(struct mdbox_storage_rebuild_context *ctx,
+			       struct rebuild_worker *worker)
+{
+	struct mail_storage *storage = &ctx->storage->storage.storage;
+	int status;
+
+	while (waitpid(worker->pid, &status, 0) < 0) {
+		if (errno != EINTR) {
+			mail_storage_set_critical(storage,
+				"waitpid() failed: %m");
+			return -1;
+		}
+	}
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		mail_storage_set_critical(storage,
+			"mdbox rebuild: Worker process %s failed (status=%d)",
+			dec2str(worker->pid), status);
+		return -1;
+	}
+	return 0;
+}
+
+static int
+rebuild_worker_read_rec(struct rebuild_worker *worker,
+			struct rebuild_worker_rec *wrec_r, const char **guid_r)
+{
+	const unsigned char *data;
+	size_t size;
+
+	if (i_stream_read_data(worker->input, &data, &size,
+			       sizeof(*wrec_r)-1) <= 0)
+		return -1;
+	memcpy(wrec_r, data, sizeof(*wrec_r));
+	i_stream_skip(worker->input, sizeof(*wrec_r));
+	if (wrec_r->type != REBUILD_WORKER_REC_MSG)
+		return 0;
+
+	if (wrec_r->guid_len == 0 ||
+	    i_stream_read_data(worker->input, &data, &size,
+			       wrec_r->guid_len-1) <= 0)
+		return -1;
+	*guid_r = t_strndup(data, wrec_r->guid_len);
+	i_stream_skip(worker->input, wrec_r->guid_len);
+	return 0;
+}
+
+static int
+rebuild_worker_read_file(struct mdbox_storage_rebuild_context *ctx,
+			 struct rebuild_worker *worker, uint32_t file_id)
+{
+	struct rebuild_worker_rec wrec;
+	struct mdbox_rebuild_msg msg;
+	const char *guid = NULL;
+
+	for (;;) {
+		if (rebuild_worker_read_rec(worker, &wrec, &guid) < 0) {
+			mail_storage_set_critical(&ctx->storage->storage.storage,
+				"mdbox rebuild: Worker output for m.%u is "
+				"truncated", file_id);
+			return -1;
+		}
+		if (wrec.type != REBUILD_WORKER_REC_MSG)
+			break;
+
+		memset(&msg, 0, sizeof(msg));
+		msg.file_id = file_id;
+		msg.offset = wrec.offset;
+		msg.rec_size = wrec.rec_size;
+		msg.mail_size = wrec.mail_size;
+		memcpy(msg.guid_128, wrec.guid_128, sizeof(msg.guid_128));
+		rebuild_add_msg(ctx, &msg, guid);
+	}
+	if (wrec.have_pop3_uidls)
+		ctx->have_pop3_uidls = TRUE;
+	if (wrec.have_pop3_orders)
+		ctx->have_pop3_orders = TRUE;
+	return 0;
+}
+
+static int rebuild_scan_files(struct mdbox_storage_rebuild_context *ctx)
+{
+	struct rebuild_worker *workers;
+	const uint32_t *file_ids;
+	unsigned int i, count, worker_count;
+	int ret = 0;
+
+	file_ids = array_get(&ctx->scan_file_ids, &count);
+	if (count == 0)
+		return 0;
+	worker_count = I_MIN(count,
+		ctx->storage->storage.storage.set->mail_rebuild_concurrency);
+
+	/* each worker scans every worker_count'th file and writes the
+	   results to its own temp file. once they're all finished, the
+	   results are added in the same order as the files were found,
+	   so the outcome is the same as with a single process. a worker
+	   exits with failure if it couldn't scan all of its files. */
+	workers = i_new(struct rebuild_worker, worker_count);
+	for (i = 0; i < worker_count; i++)
+		workers[i].fd = -1;
+	for (i = 0; i < worker_count && ret == 0; i++) T_BEGIN {
+		ret = rebuild_worker_start(ctx, &workers[i], i, worker_count);
+	} T_END;
+	for (i = 0; i < worker_count; i++) {
+		if (workers[i].pid > 0 &&
+		    rebuild_worker_wait(ctx, &workers[i]) < 0)
+			ret = -1;
+	}
+
+	for (i = 0; i < worker_count && ret == 0; i++) {
+		if (lseek(workers[i].fd, 0, SEEK_SET) < 0) {
+			mail_storage_set_critical(&ctx->storage->storage.storage,
+				"lseek(worker temp file) failed: %m");
+			ret = -1;
+			break;
+		}
+		workers[i].input = i_stream_create_fd(workers[i].fd,
+						      IO_BLOCK_SIZE, FALSE);
+	}
+	for (i = 0; i < count && ret == 0; i++) T_BEGIN {
+		ret = rebuild_worker_read_file(ctx, &workers[i % worker_count],
+					       file_ids[i]);
+	} T_END;
+
+	for (i = 0; i < worker_count; i++) {
+		if (workers[i].input != NULL)
+			i_stream_unref(&workers[i].input);
+		if (workers[i].fd != -1)
+			i_close_fd(&workers[i].fd);
+	}
+	i_free(workers);
+	return ret;
+}
+
 static int mdbox_storage_rebuild_scan(struct mdbox_storage_rebuild_context *ctx)
 {
 	const void *data;
@@ -926,6 +1209,10 @@ static int mdbox_storage_rebuild_scan(struct mdbox_storage_rebuild_context *ctx)
 				ctx->storage->alt_storage_dir, TRUE) < 0)
 			return -1;
 	}
+	if (array_is_created(&ctx->scan_file_ids)) {
+		if (rebuild_scan_files(ctx) < 0)
+			return -1;
+	}
 
 	if (rebuild_apply_map(ctx) < 0 ||
 	    rebuild_mailboxes(ctx) < 0 ||
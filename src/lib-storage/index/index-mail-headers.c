@@ -458,7 +458,6 @@ int index_mail_headers_get_envelope(struct index_mail *mail)
 {
 	const unsigned int cache_field_envelope =
 		mail->ibox->cache_fields[MAIL_CACHE_IMAP_ENVELOPE].idx;
-	struct mailbox_header_lookup_ctx *header_ctx;
 	struct istream *stream;
 	uoff_t old_offset;
 	string_t *str;
@@ -475,13 +474,16 @@ int index_mail_headers_get_envelope(struct index_mail *mail)
 		mail->data.stream->v_offset;
 
 	mail->data.save_envelope = TRUE;
-	header_ctx = mailbox_header_lookup_init(mail->mail.mail.box,
-						imap_envelope_headers);
-	if (mail_get_header_stream(&mail->mail.mail, header_ctx, &stream) < 0) {
-		mailbox_header_lookup_unref(&header_ctx);
+	if (mail->envelope_headers == NULL) {
+		/* the same mail is typically used for fetching the envelope
+		   of many messages, so look up the header fields only once */
+		mail->envelope_headers =
+			mailbox_header_lookup_init(mail->mail.mail.box,
+						   imap_envelope_headers);
+	}
+	if (mail_get_header_stream(&mail->mail.mail, mail->envelope_headers,
+				   &stream) < 0)
 		return -1;
-	}
-	mailbox_header_lookup_unref(&header_ctx);
 
 	if (mail->data.envelope == NULL && stream != NULL) {
 		/* we got the headers from cache - parse them to get the
@@ -1530,7 +1530,7 @@ bool index_mail_prefetch(struct mail *_mail)
 	struct mail_storage *storage = _mail->box->storage;
 	struct istream *input;
 	off_t len;
-	int fd;
+	int fd, ret;
 
 	if ((storage->class_flags & MAIL_STORAGE_CLASS_FLAG_FILE_PER_MSG) == 0) {
 		/* we're handling only file-per-msg storages for now. */
@@ -1554,7 +1554,9 @@ bool index_mail_prefetch(struct mail *_mail)
 			len = 0;
 		else
 			len = MAIL_READ_HDR_BLOCK_SIZE;
-		if (posix_fadvise(fd, 0, len, POSIX_FADV_WILLNEED) < 0) {
+		ret = posix_fadvise(fd, 0, len, POSIX_FADV_WILLNEED);
+		if (ret != 0) {
+			errno = ret;
 			i_error("posix_fadvise(%s) failed: %m",
 				i_stream_get_name(mail->data.stream));
 		}
@@ -1641,6 +1643,8 @@ void index_mail_free(struct mail *_mail)
 		array_free(&mail->header_match);
 	if (array_is_created(&mail->header_match_lines))
 		array_free(&mail->header_match_lines);
+	if (mail->envelope_headers != NULL)
+		mailbox_header_lookup_unref(&mail->envelope_headers);
 
 	if (headers_ctx != NULL)
 		mailbox_header_lookup_unref(&headers_ctx);
@@ -144,6 +144,7 @@ struct index_mail {
 	ARRAY(uint8_t) header_match;
 	ARRAY(unsigned int) header_match_lines;
 	uint8_t header_match_value;
+	struct mailbox_header_lookup_ctx *envelope_headers;
 
 	unsigned int pop3_state_set:1;
 	/* mail created by mailbox_search_*() */
@@ -16,13 +16,23 @@ struct index_search_context {
 	struct mailbox_header_lookup_ctx *extra_wanted_headers;
 
 	uint32_t seq1, seq2;
+	/* sequences matching the root level flag/keyword args, looked up
+	   in bulk from the index */
+	ARRAY_TYPE(seq_range) index_seqs;
+	unsigned int index_seqs_idx;
+
 	struct mail *cur_mail;
 	struct index_mail *cur_imail;
 	struct mail_thread_context *thread_ctx;
 
 	ARRAY(struct mail *) mails;
 	unsigned int unused_mail_idx;
+	/* mail_prefetch_count+1 */
 	unsigned int max_mails;
+	/* how many mails are currently prefetched at most. this grows up to
+	   max_mails while reading the prefetched mails is still slow. */
+	unsigned int cur_max_mails;
+	unsigned int prefetch_fast_count;
 
 	struct timeval search_start_time, last_notify;
 	struct timeval last_nonblock_timeval;
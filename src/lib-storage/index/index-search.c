@@ -37,6 +37,11 @@
 #define SEARCH_INITIAL_MAX_COST 30000
 #define SEARCH_RECALC_MIN_USECS 50000
 
+/* If finishing the search for a prefetched mail takes longer than this, the
+   mail wasn't in memory yet and more mails should be prefetched. */
+#define SEARCH_PREFETCH_SLOW_USECS 1000
+#define SEARCH_PREFETCH_MIN_MAILS 2
+
 struct search_header_context {
         struct index_search_context *index_ctx;
         struct index_mail *imail;
@@ -53,6 +58,8 @@ struct search_body_context {
         struct index_search_context *index_ctx;
 	struct istream *input;
 	struct message_part *part;
+
+	ARRAY(struct mail_search_arg *) multi_args;
 };
 
 static void search_parse_msgset_args(unsigned int messages_count,
@@ -634,6 +641,59 @@ static void search_body(struct mail_search_arg *arg,
 	ARG_SET_RESULT(arg, ret);
 }
 
+static void search_body_multi_add(struct mail_search_arg *arg,
+				  struct search_body_context *ctx)
+{
+	switch (arg->type) {
+	case SEARCH_BODY:
+	case SEARCH_TEXT:
+		break;
+	default:
+		return;
+	}
+
+	if (msg_search_arg_context(ctx->index_ctx, arg) == NULL) {
+		ARG_SET_RESULT(arg, 0);
+		return;
+	}
+	array_append(&ctx->multi_args, &arg, 1);
+}
+
+static void search_body_multi(struct mail_search_arg *args,
+			      struct search_body_context *ctx)
+{
+	struct mail_search_arg *const *argp;
+	struct message_search_context **msg_search_ctxs;
+	unsigned int i, count;
+	bool *matched;
+	int ret;
+
+	t_array_init(&ctx->multi_args, 8);
+	(void)mail_search_args_foreach(args, search_body_multi_add, ctx);
+	argp = array_get(&ctx->multi_args, &count);
+	if (count < 2) {
+		/* nothing to gain, search_body() handles it */
+		return;
+	}
+
+	/* search all the BODY and TEXT keys while parsing the message only
+	   once. */
+	msg_search_ctxs = t_new(struct message_search_context *, count);
+	matched = t_new(bool, count);
+	for (i = 0; i < count; i++)
+		msg_search_ctxs[i] = argp[i]->context;
+
+	i_stream_seek(ctx->input, 0);
+	ret = message_search_msg_multi(msg_search_ctxs, count, ctx->input,
+				       ctx->part, matched);
+	if (ret < 0) {
+		/* let search_body() handle the errors one key at a time */
+		return;
+	}
+	for (i = 0; i < count; i++)
+		ARG_SET_RESULT(argp[i], matched[i] ? 1 : 0);
+}
+
 static int search_arg_match_text(struct mail_search_arg *args,
 				 struct index_search_context *ctx)
 {
@@ -738,6 +798,9 @@ static int search_arg_match_text(struct mail_search_arg *args,
 	body_ctx.input = input;
 	(void)mail_get_parts(ctx->cur_mail, &body_ctx.part);
 
+	T_BEGIN {
+		search_body_multi(args, &body_ctx);
+	} T_END;
 	return mail_search_args_foreach(args, search_body, &body_ctx);
 }
 
@@ -981,6 +1044,75 @@ static bool search_limit_by_hdr(struct index_search_context *ctx,
 	return *seq1 <= *seq2;
 }
 
+static bool search_arg_is_bulk_index(struct index_search_context *ctx,
+				     struct mail_search_arg *arg)
+{
+	if (arg->match_always || arg->nonmatch_always)
+		return FALSE;
+
+	switch (arg->type) {
+	case SEARCH_FLAGS:
+		/* recent flag isn't in the index and private flags are in
+		   a different index */
+		if ((arg->value.flags & MAIL_RECENT) != 0)
+			return FALSE;
+		return (arg->value.flags &
+			mailbox_get_private_flags_mask(ctx->box)) == 0;
+	case SEARCH_KEYWORDS:
+		return arg->value.keywords != NULL;
+	default:
+		return FALSE;
+	}
+}
+
+static void search_limit_by_index(struct index_search_context *ctx,
+				  struct mail_search_arg *args)
+{
+	ARRAY_TYPE(seq_range) seqs;
+	const struct seq_range *range;
+	unsigned int count;
+
+	/* Look up flags and keywords of all the messages at once. This is
+	   much faster with large mailboxes than checking them one message
+	   at a time. */
+	for (; args != NULL; args = args->next) {
+		if (!search_arg_is_bulk_index(ctx, args))
+			continue;
+
+		i_array_init(&seqs, 32);
+		if (args->type == SEARCH_FLAGS) {
+			mail_index_lookup_flags_seqs(ctx->view,
+				ctx->seq1, ctx->seq2, args->value.flags,
+				args->value.flags, &seqs);
+		} else {
+			mail_index_lookup_keywords_seqs(ctx->view,
+				ctx->seq1, ctx->seq2, args->value.keywords,
+				&seqs);
+		}
+		if (args->match_not)
+			seq_range_array_invert(&seqs, ctx->seq1, ctx->seq2);
+
+		if (!array_is_created(&ctx->index_seqs))
+			ctx->index_seqs = seqs;
+		else {
+			seq_range_array_intersect(&ctx->index_seqs, &seqs);
+			array_free(&seqs);
+		}
+	}
+	if (!array_is_created(&ctx->index_seqs))
+		return;
+
+	range = array_get(&ctx->index_seqs, &count);
+	if (count == 0) {
+		/* no matches */
+		ctx->seq1 = 1;
+		ctx->seq2 = 0;
+	} else {
+		ctx->seq1 = range[0].seq1;
+		ctx->seq2 = range[count-1].seq2;
+	}
+}
+
 static void search_get_seqset(struct index_search_context *ctx,
 			      unsigned int messages_count,
 			      struct mail_search_arg *args)
@@ -1014,7 +1146,9 @@ static void search_get_seqset(struct index_search_context *ctx,
 		/* no matches */
 		ctx->seq1 = 1;
 		ctx->seq2 = 0;
+		return;
 	}
+	search_limit_by_index(ctx, args);
 }
 
 static int search_build_subthread(struct mail_thread_iterate_context *iter,
@@ -1188,6 +1322,7 @@ index_storage_search_init(struct mailbox_transaction_context *t,
 	ctx->max_mails = t->box->storage->set->mail_prefetch_count + 1;
 	if (ctx->max_mails == 0)
 		ctx->max_mails = UINT_MAX;
+	ctx->cur_max_mails = I_MIN(ctx->max_mails, SEARCH_PREFETCH_MIN_MAILS);
 	ctx->next_time_check_cost = SEARCH_INITIAL_MAX_COST;
 	if (gettimeofday(&ctx->last_nonblock_timeval, NULL) < 0)
 		i_fatal("gettimeofday() failed: %m");
@@ -1258,6 +1393,8 @@ int index_storage_search_deinit(struct mail_search_context *_ctx)
 		mail_thread_deinit(&ctx->thread_ctx);
 	array_free(&ctx->mail_ctx.results);
 	array_free(&ctx->mail_ctx.module_contexts);
+	if (array_is_created(&ctx->index_seqs))
+		array_free(&ctx->index_seqs);
 
 	array_foreach_modifiable(&ctx->mails, mailp) {
 		struct index_mail *imail = (struct index_mail *)*mailp;
@@ -1546,7 +1683,7 @@ struct mail *index_search_get_mail(struct index_search_context *ctx)
 	struct mail *const *mails, *mail;
 	unsigned int count;
 
-	if (ctx->unused_mail_idx == ctx->max_mails)
+	if (ctx->unused_mail_idx >= ctx->cur_max_mails)
 		return NULL;
 
 	mails = array_get(&ctx->mails, &count);
@@ -1638,10 +1775,40 @@ static bool search_finish_prefetch(struct index_search_context *ctx,
 	return ret > 0;
 }
 
+static void
+search_prefetch_update_count(struct index_search_context *ctx,
+			     const struct timeval *start_time)
+{
+	struct timeval now;
+	long long usecs;
+
+	if (gettimeofday(&now, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	usecs = timeval_diff_usecs(&now, start_time);
+
+	if (usecs >= SEARCH_PREFETCH_SLOW_USECS) {
+		/* we had to wait for the mail to be read. prefetch further
+		   ahead, so the reads have more time to finish. */
+		ctx->prefetch_fast_count = 0;
+		if (ctx->cur_max_mails <= ctx->max_mails / 2)
+			ctx->cur_max_mails *= 2;
+		else
+			ctx->cur_max_mails = ctx->max_mails;
+	} else if (++ctx->prefetch_fast_count >= ctx->cur_max_mails &&
+		   ctx->cur_max_mails > SEARCH_PREFETCH_MIN_MAILS) {
+		/* the whole window was already in memory. try if we can do
+		   with less open mails. */
+		ctx->prefetch_fast_count = 0;
+		ctx->cur_max_mails--;
+	}
+}
+
 static int search_more(struct index_search_context *ctx,
 		       struct mail **mail_r)
 {
 	struct index_mail *imail;
+	struct timeval start_time;
+	bool match;
 	int ret;
 
 	while ((ret = search_more_with_prefetching(ctx, mail_r)) > 0) {
@@ -1650,7 +1817,12 @@ static int search_more(struct index_search_context *ctx,
 			break;
 
 		/* searching wasn't finished yet */
-		if (search_finish_prefetch(ctx, imail))
+		if (gettimeofday(&start_time, NULL) < 0)
+			i_fatal("gettimeofday() failed: %m");
+		match = search_finish_prefetch(ctx, imail);
+		if (imail->data.prefetch_sent)
+			search_prefetch_update_count(ctx, &start_time);
+		if (match)
 			break;
 		/* search finished as non-match */
 	}
@@ -1706,6 +1878,23 @@ bool index_storage_search_next_nonblock(struct mail_search_context *_ctx,
 	return TRUE;
 }
 
+static void search_skip_index_nonmatches(struct index_search_context *ctx)
+{
+	const struct seq_range *range;
+	unsigned int count;
+	uint32_t *seq = &ctx->mail_ctx.seq;
+
+	range = array_get(&ctx->index_seqs, &count);
+	while (ctx->index_seqs_idx < count &&
+	       range[ctx->index_seqs_idx].seq2 < *seq)
+		ctx->index_seqs_idx++;
+
+	if (ctx->index_seqs_idx == count)
+		*seq = ctx->seq2 + 1;
+	else if (*seq < range[ctx->index_seqs_idx].seq1)
+		*seq = range[ctx->index_seqs_idx].seq1;
+}
+
 bool index_storage_search_next_update_seq(struct mail_search_context *_ctx)
 {
         struct index_search_context *ctx = (struct index_search_context *)_ctx;
@@ -1726,7 +1915,12 @@ bool index_storage_search_next_update_seq(struct mail_search_context *_ctx)
 	}
 
 	ret = 0;
-	while (_ctx->seq <= ctx->seq2) {
+	for (;;) {
+		if (array_is_created(&ctx->index_seqs))
+			search_skip_index_nonmatches(ctx);
+		if (_ctx->seq > ctx->seq2)
+			break;
+
 		/* check if the sequence matches */
 		ret = mail_search_args_foreach(ctx->mail_ctx.args->args,
 					       search_seqset_arg, ctx);
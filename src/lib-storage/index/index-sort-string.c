@@ -16,6 +16,12 @@
 
 #include <stdlib.h>
 
+/* Number of bytes copied from the beginning of the sort strings to the keys
+   that are being sorted */
+#define SORT_STRING_KEY_PREFIX_LEN 8
+/* Sort this or fewer keys using insertion sort */
+#define SORT_STRING_INSERTION_SORT_MAX_COUNT 10
+
 struct mail_sort_node {
 	uint32_t seq:29;
 	uint32_t wanted:1;
@@ -25,6 +31,14 @@ struct mail_sort_node {
 };
 ARRAY_DEFINE_TYPE(mail_sort_node, struct mail_sort_node);
 
+struct sort_string_key {
+	/* the beginning of str, zero-padded. most of the comparisons can be
+	   done with this, without accessing the string itself. */
+	unsigned char prefix[SORT_STRING_KEY_PREFIX_LEN];
+	const char *str;
+	struct mail_sort_node node;
+};
+
 struct sort_string_context {
 	struct mail_search_sort_program *program;
 	const char *primary_sort_name;
@@ -238,19 +252,144 @@ void index_sort_list_add_string(struct mail_search_sort_program *program,
 	index_sort_node_add(ctx, &node);
 }
 
-static int sort_node_zero_string_cmp(const struct mail_sort_node *n1,
-				     const struct mail_sort_node *n2)
+static int sort_string_key_secondary_cmp(const struct sort_string_key *k1,
+					 const struct sort_string_key *k2)
 {
 	struct sort_string_context *ctx = static_zero_cmp_context;
+
+	return index_sort_node_cmp_type(ctx->program->temp_mail,
+					ctx->program->sort_program + 1,
+					k1->node.seq, k2->node.seq);
+}
+
+static int sort_string_key_cmp(const struct sort_string_key *k1,
+			       const struct sort_string_key *k2,
+			       unsigned int depth)
+{
 	int ret;
 
-	ret = strcmp(ctx->sort_strings[n1->seq], ctx->sort_strings[n2->seq]);
+	ret = strcmp(k1->str + depth, k2->str + depth);
 	if (ret != 0)
-		return !ctx->reverse ? ret : -ret;
+		return ret;
+	return sort_string_key_secondary_cmp(k1, k2);
+}
 
-	return index_sort_node_cmp_type(ctx->program->temp_mail,
-					ctx->program->sort_program + 1,
-					n1->seq, n2->seq);
+static inline unsigned char
+sort_string_key_char(const struct sort_string_key *key, unsigned int depth)
+{
+	return depth < SORT_STRING_KEY_PREFIX_LEN ? key->prefix[depth] :
+		(unsigned char)key->str[depth];
+}
+
+static inline void
+sort_string_keys_swap(struct sort_string_key *keys,
+		      unsigned int idx1, unsigned int idx2)
+{
+	struct sort_string_key tmp;
+
+	tmp = keys[idx1];
+	keys[idx1] = keys[idx2];
+	keys[idx2] = tmp;
+}
+
+static void
+sort_string_keys_insertion_sort(struct sort_string_key *keys,
+				unsigned int count, unsigned int depth)
+{
+	struct sort_string_key key;
+	unsigned int i, j;
+
+	for (i = 1; i < count; i++) {
+		key = keys[i];
+		for (j = i; j > 0; j--) {
+			if (sort_string_key_cmp(&keys[j-1], &key, depth) <= 0)
+				break;
+			keys[j] = keys[j-1];
+		}
+		keys[j] = key;
+	}
+}
+
+static unsigned char
+sort_string_keys_get_pivot(const struct sort_string_key *keys,
+			   unsigned int count, unsigned int depth)
+{
+	unsigned char c1, c2, c3;
+
+	/* median of the first, middle and last keys */
+	c1 = sort_string_key_char(&keys[0], depth);
+	c2 = sort_string_key_char(&keys[count/2], depth);
+	c3 = sort_string_key_char(&keys[count-1], depth);
+	if (c1 < c2)
+		return c2 < c3 ? c2 : (c1 < c3 ? c3 : c1);
+	else
+		return c1 < c3 ? c1 : (c2 < c3 ? c3 : c2);
+}
+
+/* Multikey quicksort: Partition the keys by their character at the given
+   depth into smaller, equal and larger ones. Only the equal keys need to be
+   compared further, and starting from the next character. The strings are
+   all identical up to depth. */
+static void
+sort_string_keys_sort(struct sort_string_key *keys, unsigned int count,
+		      unsigned int depth)
+{
+	unsigned int i, lt, gt;
+	unsigned char pivot, c;
+
+	while (count > SORT_STRING_INSERTION_SORT_MAX_COUNT) {
+		pivot = sort_string_keys_get_pivot(keys, count, depth);
+		lt = i = 0; gt = count;
+		while (i < gt) {
+			c = sort_string_key_char(&keys[i], depth);
+			if (c < pivot)
+				sort_string_keys_swap(keys, lt++, i++);
+			else if (c > pivot)
+				sort_string_keys_swap(keys, i, --gt);
+			else
+				i++;
+		}
+
+		sort_string_keys_sort(keys, lt, depth);
+		if (pivot == '\0') {
+			/* the strings in lt..gt are identical */
+			i_qsort(&keys[lt], gt - lt, sizeof(*keys),
+				sort_string_key_secondary_cmp);
+			keys += gt;
+			count -= gt;
+		} else {
+			sort_string_keys_sort(keys + gt, count - gt, depth);
+			keys += lt;
+			count = gt - lt;
+			depth++;
+		}
+	}
+	sort_string_keys_insertion_sort(keys, count, depth);
+}
+
+static void
+sort_string_keys_reverse_range(struct sort_string_key *keys,
+			       unsigned int start, unsigned int end)
+{
+	while (start + 1 < end)
+		sort_string_keys_swap(keys, start++, --end);
+}
+
+static void
+sort_string_keys_reverse(struct sort_string_key *keys, unsigned int count)
+{
+	unsigned int i, start;
+
+	/* reverse the strings' order, but the secondary sort conditions
+	   must not be reversed. so reverse back the ranges of identical
+	   strings afterwards. */
+	sort_string_keys_reverse_range(keys, 0, count);
+	for (i = start = 1; i <= count; i++) {
+		if (i == count || strcmp(keys[i].str, keys[start-1].str) != 0) {
+			sort_string_keys_reverse_range(keys, start-1, i);
+			start = i + 1;
+		}
+	}
 }
 
 static void index_sort_zeroes(struct sort_string_context *ctx)
@@ -260,7 +399,8 @@ static void index_sort_zeroes(struct sort_string_context *ctx)
 	string_t *str;
 	pool_t pool;
 	struct mail_sort_node *nodes;
-	unsigned int i, count;
+	struct sort_string_key *keys;
+	unsigned int i, j, count;
 
 	/* first get all the messages' sort strings. although this takes more
 	   memory, it makes error handling easier and probably also helps
@@ -270,6 +410,7 @@ static void index_sort_zeroes(struct sort_string_context *ctx)
 		pool_alloconly_create("sort strings", 1024*64);
 	str = str_new(default_pool, 512);
 	nodes = array_get_modifiable(&ctx->zero_nodes, &count);
+	keys = i_new(struct sort_string_key, count);
 	for (i = 0; i < count; i++) {
 		i_assert(nodes[i].seq <= ctx->last_seq);
 
@@ -280,12 +421,25 @@ static void index_sort_zeroes(struct sort_string_context *ctx)
 				str_len(str) == 0 ? "" :
 				p_strdup(pool, str_c(str));
 		} T_END;
+
+		keys[i].str = ctx->sort_strings[nodes[i].seq];
+		keys[i].node = nodes[i];
+		for (j = 0; j < SORT_STRING_KEY_PREFIX_LEN; j++) {
+			if (keys[i].str[j] == '\0')
+				break;
+			keys[i].prefix[j] = keys[i].str[j];
+		}
 	}
 	str_free(&str);
 
 	/* we have all strings, sort nodes based on them */
 	static_zero_cmp_context = ctx;
-	array_sort(&ctx->zero_nodes, sort_node_zero_string_cmp);
+	sort_string_keys_sort(keys, count, 0);
+	if (ctx->reverse)
+		sort_string_keys_reverse(keys, count);
+	for (i = 0; i < count; i++)
+		nodes[i] = keys[i].node;
+	i_free(keys);
 }
 
 static const char *
@@ -689,7 +843,8 @@ static void index_sort_write_changed_sort_ids(struct sort_string_context *ctx)
 	struct mail_index_transaction *itrans = ctx->program->t->itrans;
 	uint32_t ext_id = ctx->ext_id;
 	const struct mail_sort_node *nodes;
-	unsigned int i, count;
+	struct mail_sort_node *changed_nodes;
+	unsigned int i, count, changed_count = 0;
 
 	if (ctx->no_writing) {
 		/* our reset_id is already stale - don't even bother
@@ -700,16 +855,23 @@ static void index_sort_write_changed_sort_ids(struct sort_string_context *ctx)
 	mail_index_ext_reset_inc(itrans, ext_id,
 				 ctx->highest_reset_id, FALSE);
 
-	/* add the missing sort IDs to index */
-	nodes = array_get_modifiable(&ctx->sorted_nodes, &count);
+	/* add the missing sort IDs to index. the transaction keeps the
+	   updates sorted by sequence, so add them in that order to avoid
+	   moving the earlier updates around for each one. */
+	nodes = array_get(&ctx->sorted_nodes, &count);
+	changed_nodes = i_new(struct mail_sort_node, count);
 	for (i = 0; i < count; i++) {
 		i_assert(nodes[i].sort_id != 0);
-		if (!nodes[i].sort_id_changed || nodes[i].no_update)
-			continue;
-
-		mail_index_update_ext(itrans, nodes[i].seq, ext_id,
-				      &nodes[i].sort_id, NULL);
+		if (nodes[i].sort_id_changed && !nodes[i].no_update)
+			changed_nodes[changed_count++] = nodes[i];
+	}
+	i_qsort(changed_nodes, changed_count, sizeof(*changed_nodes),
+		sort_node_seq_cmp);
+	for (i = 0; i < changed_count; i++) {
+		mail_index_update_ext(itrans, changed_nodes[i].seq, ext_id,
+				      &changed_nodes[i].sort_id, NULL);
 	}
+	i_free(changed_nodes);
 }
 
 static int sort_node_cmp(const struct mail_sort_node *n1,
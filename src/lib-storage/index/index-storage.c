@@ -224,6 +224,8 @@ int index_storage_mailbox_alloc_index(struct mailbox *box)
 	mail_index_set_lock_method(box->index,
 		box->storage->set->parsed_lock_method,
 		mail_storage_get_lock_timeout(box->storage, UINT_MAX));
+	mail_index_set_shm_dir(box->index,
+			       box->storage->set->mail_index_shm_dir);
 	return 0;
 }
 
@@ -657,6 +659,20 @@ static int mailbox_expunge_all_data(struct mailbox *box)
 	return mailbox_transaction_commit(&t);
 }
 
+static void index_storage_mailbox_unlink_shm(struct mailbox *box)
+{
+	const char *shm_dir = box->storage->set->mail_index_shm_dir;
+	const char *index_dir;
+
+	if (*shm_dir == '\0' ||
+	    mailbox_get_path_to(box, MAILBOX_LIST_PATH_TYPE_INDEX,
+				&index_dir) <= 0)
+		return;
+	mail_index_unlink_shm_file(shm_dir, t_strconcat(index_dir, "/",
+							box->index_prefix,
+							NULL));
+}
+
 int index_storage_mailbox_delete(struct mailbox *box)
 {
 	struct mailbox_metadata metadata;
@@ -708,6 +724,7 @@ int index_storage_mailbox_delete(struct mailbox *box)
 	   directory that contains them. It can still fail with some NFS
 	   implementations if indexes are opened by another session, but
 	   that can't really be helped. */
+	index_storage_mailbox_unlink_shm(box);
 	mailbox_close(box);
 	mail_index_alloc_cache_destroy_unrefed();
 
@@ -734,6 +751,10 @@ int index_storage_mailbox_rename(struct mailbox *src, struct mailbox *dest)
 {
 	guid_128_t guid;
 
+	/* the snapshot is looked up by the index path, so it would be
+	   orphaned by the rename. children are left for expiring. */
+	index_storage_mailbox_unlink_shm(src);
+
 	if (src->list->v.rename_mailbox(src->list, src->name,
 					dest->list, dest->name) < 0) {
 		mail_storage_copy_list_error(src->storage, src->list);
@@ -43,6 +43,10 @@ struct index_mailbox_context {
 
 	time_t sync_last_check;
 	uint32_t list_index_sync_ext_id;
+
+	/* file_seq of the cache file whose compression has been requested
+	   from indexer */
+	uint32_t cache_compress_requested_file_seq;
 };
 
 #define INDEX_STORAGE_CONTEXT(obj) \
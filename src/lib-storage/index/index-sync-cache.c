@@ -0,0 +1,80 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "str.h"
+#include "strescape.h"
+#include "net.h"
+#include "write-full.h"
+#include "mail-user.h"
+#include "mail-cache.h"
+#include "index-sync-private.h"
+
+#define INDEXER_SOCKET_NAME "indexer"
+#define INDEXER_HANDSHAKE "VERSION\tindexer\t1\t0\n"
+
+static int index_mailbox_cache_compress_request(struct mailbox *box)
+{
+	struct mail_user *user = box->storage->user;
+	const char *path;
+	string_t *str;
+	int fd, ret;
+
+	path = t_strconcat(user->set->base_dir, "/"INDEXER_SOCKET_NAME, NULL);
+	fd = net_connect_unix(path);
+	if (fd == -1) {
+		/* indexer not running is a normal configuration, just
+		   fall back quietly */
+		if (errno != ENOENT && errno != ECONNREFUSED)
+			i_error("net_connect_unix(%s) failed: %m", path);
+		return -1;
+	}
+
+	/* we don't care about the reply */
+	str = t_str_new(128);
+	str_append(str, INDEXER_HANDSHAKE"OPTIMIZE\t0\t");
+	str_append_tabescaped(str, user->username);
+	str_append_c(str, '\t');
+	str_append_tabescaped(str, box->vname);
+	str_append_c(str, '\n');
+	if ((ret = write_full(fd, str_data(str), str_len(str))) < 0)
+		i_error("write(%s) failed: %m", path);
+	i_close_fd(&fd);
+	return ret;
+}
+
+void index_mailbox_sync_cache_compress(struct mailbox *box,
+				       enum mailbox_sync_flags flags)
+{
+	struct index_mailbox_context *ibox = INDEX_STORAGE_CONTEXT(box);
+	uint32_t file_seq;
+
+	if ((ibox->index_flags &
+	     MAIL_INDEX_OPEN_FLAG_CACHE_COMPRESS_BACKGROUND) == 0 ||
+	    box->cache == NULL)
+		return;
+
+	if ((flags & MAILBOX_SYNC_FLAG_OPTIMIZE) != 0) {
+		/* we're most likely the indexer-worker doing what was
+		   requested below. if this fails, the cache just stays as
+		   it is. */
+		(void)mail_cache_compress_if_needed(box->cache);
+		return;
+	}
+
+	if (!mail_cache_need_compress(box->cache))
+		return;
+	/* the cache stays marked for compression even after the indexer
+	   has compressed it, so request it only once per cache file. */
+	file_seq = mail_cache_get_need_compress_file_seq(box->cache);
+	if (file_seq == ibox->cache_compress_requested_file_seq)
+		return;
+	ibox->cache_compress_requested_file_seq = file_seq;
+	T_BEGIN {
+		if (index_mailbox_cache_compress_request(box) < 0) {
+			/* indexer isn't available, do it ourself. if that
+			   fails as well, try again on a later sync. */
+			ibox->cache_compress_requested_file_seq = 0;
+			(void)mail_cache_compress_external(box->cache);
+		}
+	} T_END;
+}
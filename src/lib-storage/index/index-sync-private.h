@@ -34,4 +34,10 @@ int index_mailbox_sync_pvt_view(struct index_mailbox_sync_pvt_context *ctx,
 				ARRAY_TYPE(seq_range) *hidden_updates);
 void index_mailbox_sync_pvt_deinit(struct index_mailbox_sync_pvt_context **ctx);
 
+/* Request cache compression from indexer if the cache needs it and the
+   background compression is enabled. If indexer can't be reached, compress
+   the cache directly. */
+void index_mailbox_sync_cache_compress(struct mailbox *box,
+				       enum mailbox_sync_flags flags);
+
 #endif
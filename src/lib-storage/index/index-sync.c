@@ -410,6 +410,8 @@ int index_mailbox_sync_deinit(struct mailbox_sync_context *_ctx,
 		/* mailbox syncing didn't necessarily update our recent state */
 		index_sync_update_recent_count(_ctx->box);
 	}
+	if (ret == 0 && _ctx->box->opened)
+		index_mailbox_sync_cache_compress(_ctx->box, _ctx->flags);
 
 	if (status_r != NULL)
 		status_r->sync_delayed_expunges = delayed_expunges;
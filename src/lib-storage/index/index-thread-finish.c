@@ -34,8 +34,6 @@ struct mail_thread_root_node {
 };
 
 struct thread_finish_context {
-	unsigned int refcount;
-
 	struct mail *tmp_mail;
 	struct mail_thread_cache *cache;
 
@@ -44,14 +42,17 @@ struct thread_finish_context {
 	unsigned int next_new_root_idx;
 
 	unsigned int use_sent_date:1;
-	unsigned int return_seqs:1;
 };
 
 struct mail_thread_iterate_context {
-	struct thread_finish_context *ctx;
+	struct mail_thread_tree *tree;
+	struct mailbox *box;
+
+	/* this level's nodes are between first_idx..end_idx-1 */
+	unsigned int first_idx, next_idx, end_idx;
+	struct mail_thread_child_node child;
 
-	ARRAY_TYPE(mail_thread_child_node) children;
-	unsigned int next_idx;
+	bool return_seqs;
 	bool failed;
 };
 
@@ -551,128 +552,180 @@ static void mail_thread_finish(struct thread_finish_context *ctx,
 }
 
 static void
-nodes_change_uids_to_seqs(struct mail_thread_iterate_context *iter, bool root)
+thread_tree_add_node(struct thread_finish_context *ctx,
+		     struct mail_thread_tree *tree, uint32_t uid, uint32_t idx)
 {
-	struct mail_thread_child_node *children;
-	struct mailbox *box = iter->ctx->tmp_mail->box;
-	unsigned int i, count;
-	uint32_t uid, seq;
+	ARRAY_TYPE(mail_thread_child_node) sorted_children;
+	const struct mail_thread_child_node *children;
+	const struct mail_thread_shadow_node *shadow;
+	struct mail_thread_tree_node *node;
+	unsigned int i, count, node_idx;
+
+	node_idx = array_count(&tree->nodes);
+	node = array_append_space(&tree->nodes);
+	node->uid = uid;
+
+	shadow = array_idx(&ctx->shadow_nodes, idx);
+	if (shadow->first_child_idx == 0)
+		return;
 
-	children = array_get_modifiable(&iter->children, &count);
+	t_array_init(&sorted_children, 8);
+	thread_sort_children(ctx, idx, &sorted_children);
+	children = array_get(&sorted_children, &count);
 	for (i = 0; i < count; i++) {
-		uid = children[i].uid;
-		if (uid == 0) {
-			/* dummy root */
-			if (root)
-				continue;
-			i_unreached();
-		} else {
-			mailbox_get_seq_range(box, uid, uid, &seq, &seq);
-			i_assert(seq != 0);
-		}
-		children[i].uid = seq;
+		thread_tree_add_node(ctx, tree, children[i].uid,
+				     children[i].idx);
 	}
+
+	node = array_idx_modifiable(&tree->nodes, node_idx);
+	node->descendant_count = array_count(&tree->nodes) - node_idx - 1;
 }
 
-static void
-mail_thread_iterate_fill_root(struct mail_thread_iterate_context *iter)
+struct mail_thread_tree *
+mail_thread_tree_build(struct mail_thread_cache *cache, struct mail *tmp_mail,
+		       enum mail_thread_type thread_type)
 {
-	struct mail_thread_root_node *roots;
+	struct thread_finish_context ctx;
+	struct mail_thread_tree *tree;
+	const struct mail_thread_root_node *roots;
+	const struct mail_thread_shadow_node *shadow;
 	unsigned int i, count;
 
-	roots = array_get_modifiable(&iter->ctx->roots, &count);
-	i_array_init(&iter->children, count);
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.cache = cache;
+	ctx.tmp_mail = tmp_mail;
+	mail_thread_finish(&ctx, thread_type);
+
+	tree = i_new(struct mail_thread_tree, 1);
+	tree->refcount = 1;
+	tree->thread_type = thread_type;
+	i_array_init(&tree->nodes, array_count(&cache->thread_nodes) + 1);
+
+	roots = array_get(&ctx.roots, &count);
 	for (i = 0; i < count; i++) {
-		if (!roots[i].ignore) {
-			if (roots[i].dummy)
-				roots[i].node.uid = 0;
-			array_append(&iter->children, &roots[i].node, 1);
+		if (roots[i].ignore)
+			continue;
+		shadow = array_idx(&ctx.shadow_nodes, roots[i].node.idx);
+		if (roots[i].dummy && shadow->first_child_idx == 0) {
+			/* this is a dummy node without children,
+			   there's no point in returning it */
+			continue;
 		}
+		T_BEGIN {
+			thread_tree_add_node(&ctx, tree, roots[i].dummy ? 0 :
+					     roots[i].node.uid,
+					     roots[i].node.idx);
+		} T_END;
 	}
+	array_free(&ctx.roots);
+	array_free(&ctx.shadow_nodes);
+	return tree;
 }
 
-static struct mail_thread_iterate_context *
-mail_thread_iterate_children(struct mail_thread_iterate_context *parent_iter,
-			     uint32_t parent_idx)
+void mail_thread_tree_unref(struct mail_thread_tree **_tree)
 {
-	struct mail_thread_iterate_context *child_iter;
+	struct mail_thread_tree *tree = *_tree;
 
-	child_iter = i_new(struct mail_thread_iterate_context, 1);
-	child_iter->ctx = parent_iter->ctx;
-	child_iter->ctx->refcount++;
+	i_assert(tree->refcount > 0);
 
-	i_array_init(&child_iter->children, 8);
-	thread_sort_children(child_iter->ctx, parent_idx,
-			     &child_iter->children);
-	if (child_iter->ctx->return_seqs)
-		nodes_change_uids_to_seqs(child_iter, FALSE);
-	return child_iter;
+	*_tree = NULL;
+	if (--tree->refcount > 0)
+		return;
+
+	array_free(&tree->nodes);
+	i_free(tree);
 }
 
 struct mail_thread_iterate_context *
-mail_thread_iterate_init_full(struct mail_thread_cache *cache,
-			      struct mail *tmp_mail,
-			      enum mail_thread_type thread_type,
-			      bool return_seqs)
+mail_thread_iterate_init_tree(struct mail_thread_tree *tree,
+			      struct mailbox *box, bool return_seqs)
+{
+	struct mail_thread_iterate_context *iter;
+
+	iter = i_new(struct mail_thread_iterate_context, 1);
+	iter->tree = tree;
+	iter->tree->refcount++;
+	iter->box = box;
+	iter->return_seqs = return_seqs;
+	iter->end_idx = array_count(&tree->nodes);
+	return iter;
+}
+
+struct mail_thread_iterate_context *mail_thread_iterate_init_failed(void)
 {
 	struct mail_thread_iterate_context *iter;
-	struct thread_finish_context *ctx;
 
 	iter = i_new(struct mail_thread_iterate_context, 1);
-	ctx = iter->ctx = i_new(struct thread_finish_context, 1);
-	ctx->refcount = 1;
-	ctx->cache = cache;
-	ctx->tmp_mail = tmp_mail;
-	ctx->return_seqs = return_seqs;
-	mail_thread_finish(ctx, thread_type);
-
-	mail_thread_iterate_fill_root(iter);
-	if (return_seqs)
-		nodes_change_uids_to_seqs(iter, TRUE);
+	iter->failed = TRUE;
 	return iter;
 }
 
+static struct mail_thread_iterate_context *
+mail_thread_iterate_children(struct mail_thread_iterate_context *parent_iter,
+			     unsigned int parent_idx,
+			     const struct mail_thread_tree_node *parent)
+{
+	struct mail_thread_iterate_context *child_iter;
+
+	child_iter = mail_thread_iterate_init_tree(parent_iter->tree,
+						   parent_iter->box,
+						   parent_iter->return_seqs);
+	child_iter->first_idx = child_iter->next_idx = parent_idx + 1;
+	child_iter->end_idx = child_iter->first_idx + parent->descendant_count;
+	return child_iter;
+}
+
 const struct mail_thread_child_node *
 mail_thread_iterate_next(struct mail_thread_iterate_context *iter,
 			 struct mail_thread_iterate_context **child_iter_r)
 {
-	const struct mail_thread_child_node *children, *child;
-	const struct mail_thread_shadow_node *shadow;
-	unsigned int count;
+	const struct mail_thread_tree_node *node;
+	uint32_t seq;
 
-	children = array_get(&iter->children, &count);
-	if (iter->next_idx >= count)
+	if (iter->next_idx >= iter->end_idx)
 		return NULL;
 
-	child = &children[iter->next_idx++];
-	shadow = array_idx(&iter->ctx->shadow_nodes, child->idx);
-	*child_iter_r = shadow->first_child_idx == 0 ? NULL :
-		mail_thread_iterate_children(iter, child->idx);
-	if (child->uid == 0 && *child_iter_r == NULL) {
-		/* this is a dummy node without children,
-		   there's no point in returning it */
-		return mail_thread_iterate_next(iter, child_iter_r);
+	node = array_idx(&iter->tree->nodes, iter->next_idx);
+	*child_iter_r = node->descendant_count == 0 ? NULL :
+		mail_thread_iterate_children(iter, iter->next_idx, node);
+
+	iter->child.idx = iter->next_idx;
+	iter->child.uid = node->uid;
+	if (iter->return_seqs && node->uid != 0) {
+		mailbox_get_seq_range(iter->box, node->uid, node->uid,
+				      &seq, &seq);
+		i_assert(seq != 0);
+		iter->child.uid = seq;
 	}
-	return child;
+	iter->next_idx += 1 + node->descendant_count;
+	return &iter->child;
 }
 
 unsigned int mail_thread_iterate_count(struct mail_thread_iterate_context *iter)
 {
-	return array_count(&iter->children);
+	const struct mail_thread_tree_node *nodes;
+	unsigned int idx, nodes_count, count = 0;
+
+	if (iter->tree == NULL)
+		return 0;
+
+	nodes = array_get(&iter->tree->nodes, &nodes_count);
+	i_assert(iter->end_idx <= nodes_count);
+	for (idx = iter->first_idx; idx < iter->end_idx;
+	     idx += nodes[idx].descendant_count + 1)
+		count++;
+	return count;
 }
 
 int mail_thread_iterate_deinit(struct mail_thread_iterate_context **_iter)
 {
 	struct mail_thread_iterate_context *iter = *_iter;
+	int ret = iter->failed ? -1 : 0;
 
 	*_iter = NULL;
 
-	if (--iter->ctx->refcount == 0) {
-		array_free(&iter->ctx->roots);
-		array_free(&iter->ctx->shadow_nodes);
-		i_free(iter->ctx);
-	}
-	array_free(&iter->children);
+	if (iter->tree != NULL)
+		mail_thread_tree_unref(&iter->tree);
 	i_free(iter);
-	return 0;
+	return ret;
 }
@@ -6,6 +6,7 @@
 #include "mail-index-strmap.h"
 
 #define MAIL_THREAD_INDEX_SUFFIX ".thread"
+#define MAIL_THREAD_TREE_INDEX_SUFFIX ".thread.tree"
 
 /* After initially building the index, assign first_invalid_msgid_idx to
    the next unused index + SKIP_COUNT. When more messages are added and
@@ -44,6 +45,43 @@ ARRAY_DEFINE_TYPE(mail_thread_node, struct mail_thread_node);
 #define MAIL_THREAD_NODE_EXISTS(node) \
 	((node)->uid != 0)
 
+struct mail_thread_tree_node {
+	/* UID of the message, or 0 for dummy root nodes */
+	uint32_t uid;
+	/* Number of nodes under this node. The child nodes follow this node
+	   directly, each one followed by its own descendants. */
+	uint32_t descendant_count;
+};
+ARRAY_DEFINE_TYPE(mail_thread_tree_node, struct mail_thread_tree_node);
+
+/* Finished thread tree, with the nodes in the order they're returned. */
+struct mail_thread_tree {
+	int refcount;
+	enum mail_thread_type thread_type;
+
+	/* If the tree was built from all messages in the mailbox, these
+	   identify the messages. They're the same only as long as no messages
+	   have been added or expunged. Otherwise uid_validity=0. */
+	uint32_t uid_validity;
+	uint32_t next_uid;
+	uint32_t messages_count;
+
+	ARRAY_TYPE(mail_thread_tree_node) nodes;
+};
+
+struct mail_thread_tree_header {
+#define MAIL_THREAD_TREE_VERSION 1
+	uint8_t version;
+	uint8_t thread_type;
+	uint8_t unused[2];
+
+	uint32_t uid_validity;
+	uint32_t next_uid;
+	uint32_t messages_count;
+	/* number of struct mail_thread_tree_nodes following the header */
+	uint32_t nodes_count;
+};
+
 struct mail_thread_cache {
 	uint32_t last_uid;
 	/* indexes used for invalid Message-IDs. that means no other messages
@@ -56,6 +94,10 @@ struct mail_thread_cache {
 
 	/* indexed by mail_index_strmap_rec.str_idx */
 	ARRAY_TYPE(mail_thread_node) thread_nodes;
+
+	/* the last finished thread tree, or NULL if thread_nodes have
+	   changed since */
+	struct mail_thread_tree *tree;
 };
 
 static inline uint32_t crc32_str_nonzero(const char *str)
@@ -71,11 +113,16 @@ bool mail_thread_remove(struct mail_thread_cache *cache,
 			const struct mail_index_strmap_rec *msgid_map,
 			unsigned int *msgid_map_idx);
 
+struct mail_thread_tree *
+mail_thread_tree_build(struct mail_thread_cache *cache, struct mail *tmp_mail,
+		       enum mail_thread_type thread_type);
+void mail_thread_tree_unref(struct mail_thread_tree **tree);
+
 struct mail_thread_iterate_context *
-mail_thread_iterate_init_full(struct mail_thread_cache *cache,
-			      struct mail *tmp_mail,
-			      enum mail_thread_type thread_type,
-			      bool return_seqs);
+mail_thread_iterate_init_tree(struct mail_thread_tree *tree,
+			      struct mailbox *box, bool return_seqs);
+/* Returns an iterator that doesn't return anything and fails at deinit. */
+struct mail_thread_iterate_context *mail_thread_iterate_init_failed(void);
 
 void index_thread_mailbox_opened(struct mailbox *box);
 
@@ -6,6 +6,11 @@
 #include "array.h"
 #include "bsearch-insert-pos.h"
 #include "hash2.h"
+#include "str.h"
+#include "read-full.h"
+#include "ostream.h"
+#include "safe-mkstemp.h"
+#include "seq-range-array.h"
 #include "message-id.h"
 #include "mail-search.h"
 #include "mail-search-build.h"
@@ -13,7 +18,11 @@
 #include "index-storage.h"
 #include "index-thread-private.h"
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 
 #define MAIL_THREAD_CONTEXT(obj) \
 	MODULE_CONTEXT(obj, mail_thread_storage_module)
@@ -28,6 +37,11 @@ struct mail_thread_context {
 	ARRAY_TYPE(seq_range) added_uids;
 
 	unsigned int failed:1;
+	/* search_args match all messages */
+	unsigned int all_mails:1;
+	/* thread nodes haven't been updated, because the cached thread tree
+	   was still usable. they're updated if another tree is needed. */
+	unsigned int build_delayed:1;
 };
 
 struct mail_thread_mailbox {
@@ -372,6 +386,9 @@ static bool mail_thread_cache_update_removes(struct mail_thread_mailbox *tbox,
 	t_array_init(&removed_uids, 64);
 	mailbox_search_result_sync(cache->search_result,
 				   &removed_uids, added_uids);
+	if (cache->tree != NULL &&
+	    (array_count(&removed_uids) > 0 || array_count(added_uids) > 0))
+		mail_thread_tree_unref(&cache->tree);
 
 	/* first check that we're not inserting any messages in the middle */
 	uids = array_get(added_uids, &uid_count);
@@ -514,6 +531,8 @@ static void mail_thread_cache_sync_add(struct mail_thread_mailbox *tbox,
 		mail_index_strmap_view_get_highest_idx(tbox->strmap_view) + 1 +
 		THREAD_INVALID_MSGID_STR_IDX_SKIP_COUNT;
 	array_clear(&cache->thread_nodes);
+	if (cache->tree != NULL)
+		mail_thread_tree_unref(&cache->tree);
 
 	cache->search_result =
 		mailbox_search_result_save(search_ctx,
@@ -533,19 +552,313 @@ static void mail_thread_cache_sync_add(struct mail_thread_mailbox *tbox,
 	}
 }
 
+static int mail_thread_build(struct mail_thread_context *ctx,
+			     struct mail_search_context *search_ctx)
+{
+	struct mail_thread_mailbox *tbox = MAIL_THREAD_CONTEXT(ctx->box);
+	int ret;
+
+	mail_thread_cache_sync_remove(tbox, ctx);
+	ret = mail_thread_index_map_build(ctx);
+	if (ret == 0)
+		mail_thread_cache_sync_add(tbox, ctx, search_ctx);
+	if (mailbox_search_deinit(&search_ctx) < 0)
+		ret = -1;
+	memset(&ctx->added_uids, 0, sizeof(ctx->added_uids));
+	return ret;
+}
+
+static bool mail_thread_search_args_all(const struct mail_search_args *args)
+{
+	const struct mail_search_arg *arg = args->args;
+
+	return arg != NULL && arg->next == NULL &&
+		arg->type == SEARCH_ALL && !arg->match_not;
+}
+
+static const char *mail_thread_tree_get_path(struct mailbox *box)
+{
+	return t_strconcat(box->index->filepath,
+			   MAIL_THREAD_TREE_INDEX_SUFFIX, NULL);
+}
+
+static bool
+mail_thread_tree_is_current(const struct mail_thread_tree *tree,
+			    const struct mail_index_header *hdr)
+{
+	return tree->uid_validity != 0 &&
+		tree->uid_validity == hdr->uid_validity &&
+		tree->next_uid == hdr->next_uid &&
+		tree->messages_count == hdr->messages_count;
+}
+
+static void
+mail_thread_tree_set_corrupted(struct mailbox *box, const char *path,
+			       const char *reason)
+{
+	mail_storage_set_critical(box->storage,
+		"Corrupted thread tree file %s: %s", path, reason);
+	if (unlink(path) < 0 && errno != ENOENT) {
+		mail_storage_set_critical(box->storage,
+			"unlink(%s) failed: %m", path);
+	}
+}
+
+static bool
+mail_thread_tree_nodes_verify(struct mailbox *box,
+			      const struct mail_thread_tree *tree,
+			      const char **error_r)
+{
+	const struct mail_thread_tree_node *nodes;
+	ARRAY(unsigned int) parent_ends;
+	ARRAY_TYPE(seq_range) uids;
+	const unsigned int *ends;
+	unsigned int i, end, parent_end, count, ends_count, msgs_count = 0;
+	uint32_t seq;
+
+	nodes = array_get(&tree->nodes, &count);
+	t_array_init(&parent_ends, 16);
+	t_array_init(&uids, 64);
+	for (i = 0; i < count; i++) {
+		/* drop the parents whose descendants all have been seen */
+		ends = array_get(&parent_ends, &ends_count);
+		while (ends_count > 0 && ends[ends_count-1] <= i)
+			ends_count--;
+		array_delete(&parent_ends, ends_count,
+			     array_count(&parent_ends) - ends_count);
+		parent_end = ends_count == 0 ? count : ends[ends_count-1];
+
+		if (nodes[i].descendant_count > parent_end - i - 1) {
+			*error_r = ends_count == 0 ?
+				"descendant_count points outside file" :
+				"descendant_count points outside parent";
+			return FALSE;
+		}
+		if (nodes[i].descendant_count > 0) {
+			end = i + 1 + nodes[i].descendant_count;
+			array_append(&parent_ends, &end, 1);
+		}
+		if (nodes[i].uid == 0) {
+			if (nodes[i].descendant_count == 0) {
+				*error_r = "Dummy node without children";
+				return FALSE;
+			}
+			continue;
+		}
+		if (!mail_index_lookup_seq(box->view, nodes[i].uid, &seq)) {
+			*error_r = t_strdup_printf("UID %u doesn't exist",
+						   nodes[i].uid);
+			return FALSE;
+		}
+		if (seq_range_array_add(&uids, nodes[i].uid)) {
+			*error_r = t_strdup_printf("Duplicate UID %u",
+						   nodes[i].uid);
+			return FALSE;
+		}
+		msgs_count++;
+	}
+	if (msgs_count != tree->messages_count) {
+		*error_r = t_strdup_printf(
+			"Messages count mismatch (%u vs %u)",
+			msgs_count, tree->messages_count);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+static struct mail_thread_tree *
+mail_thread_tree_read(struct mailbox *box, const struct mail_index_header *hdr)
+{
+	struct mail_thread_tree_header tree_hdr;
+	struct mail_thread_tree *tree;
+	struct mail_thread_tree_node *nodes;
+	struct stat st;
+	const char *path, *error;
+	int fd, ret;
+
+	if (MAIL_INDEX_IS_IN_MEMORY(box->index))
+		return NULL;
+
+	path = mail_thread_tree_get_path(box);
+	fd = open(path, O_RDONLY);
+	if (fd == -1) {
+		if (errno != ENOENT) {
+			mail_storage_set_critical(box->storage,
+				"open(%s) failed: %m", path);
+		}
+		return NULL;
+	}
+
+	ret = read_full(fd, &tree_hdr, sizeof(tree_hdr));
+	if (ret <= 0) {
+		if (ret < 0) {
+			mail_storage_set_critical(box->storage,
+				"read(%s) failed: %m", path);
+		} else {
+			mail_thread_tree_set_corrupted(box, path,
+						       "File too small");
+		}
+		i_close_fd(&fd);
+		return NULL;
+	}
+	if (tree_hdr.version != MAIL_THREAD_TREE_VERSION ||
+	    tree_hdr.uid_validity != hdr->uid_validity ||
+	    tree_hdr.next_uid != hdr->next_uid ||
+	    tree_hdr.messages_count != hdr->messages_count) {
+		/* written for some other mailbox state */
+		i_close_fd(&fd);
+		return NULL;
+	}
+	if (tree_hdr.thread_type != MAIL_THREAD_REFERENCES &&
+	    tree_hdr.thread_type != MAIL_THREAD_REFS) {
+		mail_thread_tree_set_corrupted(box, path,
+					       "Invalid thread type");
+		i_close_fd(&fd);
+		return NULL;
+	}
+	if (fstat(fd, &st) < 0) {
+		mail_storage_set_critical(box->storage,
+					  "fstat(%s) failed: %m", path);
+		i_close_fd(&fd);
+		return NULL;
+	}
+	if ((uoff_t)st.st_size != sizeof(tree_hdr) +
+	    (uoff_t)tree_hdr.nodes_count * sizeof(*nodes)) {
+		mail_thread_tree_set_corrupted(box, path,
+			"File size doesn't match nodes_count");
+		i_close_fd(&fd);
+		return NULL;
+	}
+
+	tree = i_new(struct mail_thread_tree, 1);
+	tree->refcount = 1;
+	tree->thread_type = tree_hdr.thread_type;
+	tree->uid_validity = tree_hdr.uid_validity;
+	tree->next_uid = tree_hdr.next_uid;
+	tree->messages_count = tree_hdr.messages_count;
+	i_array_init(&tree->nodes, tree_hdr.nodes_count + 1);
+	if (tree_hdr.nodes_count == 0)
+		ret = 1;
+	else {
+		/* allocate all nodes and read them directly to the array */
+		(void)array_idx_modifiable(&tree->nodes,
+					   tree_hdr.nodes_count - 1);
+		nodes = array_idx_modifiable(&tree->nodes, 0);
+		ret = read_full(fd, nodes,
+				sizeof(*nodes) * tree_hdr.nodes_count);
+	}
+	if (ret < 0) {
+		mail_storage_set_critical(box->storage,
+					  "read(%s) failed: %m", path);
+	} else if (ret == 0) {
+		mail_thread_tree_set_corrupted(box, path, "File too small");
+		ret = -1;
+	} else if (!mail_thread_tree_nodes_verify(box, tree, &error)) {
+		mail_thread_tree_set_corrupted(box, path, error);
+		ret = -1;
+	}
+	i_close_fd(&fd);
+
+	if (ret < 0)
+		mail_thread_tree_unref(&tree);
+	return tree;
+}
+
+static void
+mail_thread_tree_write(struct mailbox *box, const struct mail_thread_tree *tree)
+{
+	struct mail_index *index = box->index;
+	struct mail_thread_tree_header hdr;
+	struct ostream *output;
+	const struct mail_thread_tree_node *nodes;
+	const char *path, *temp_path;
+	string_t *str;
+	unsigned int count;
+	int fd, ret = 0;
+
+	if (MAIL_INDEX_IS_IN_MEMORY(index))
+		return;
+
+	path = mail_thread_tree_get_path(box);
+	str = t_str_new(256);
+	str_append(str, path);
+	fd = safe_mkstemp_hostpid_group(str, index->mode, index->gid,
+					index->gid_origin);
+	temp_path = str_c(str);
+	if (fd == -1) {
+		mail_storage_set_critical(box->storage,
+			"safe_mkstemp_hostpid(%s) failed: %m", temp_path);
+		return;
+	}
+
+	nodes = array_get(&tree->nodes, &count);
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.version = MAIL_THREAD_TREE_VERSION;
+	hdr.thread_type = tree->thread_type;
+	hdr.uid_validity = tree->uid_validity;
+	hdr.next_uid = tree->next_uid;
+	hdr.messages_count = tree->messages_count;
+	hdr.nodes_count = count;
+
+	output = o_stream_create_fd(fd, 0, FALSE);
+	o_stream_cork(output);
+	o_stream_nsend(output, &hdr, sizeof(hdr));
+	o_stream_nsend(output, nodes, sizeof(*nodes) * count);
+	if (o_stream_nfinish(output) < 0) {
+		mail_storage_set_critical(box->storage,
+			"write(%s) failed: %m", temp_path);
+		ret = -1;
+	}
+	o_stream_destroy(&output);
+	if (close(fd) < 0) {
+		mail_storage_set_critical(box->storage,
+			"close(%s) failed: %m", temp_path);
+		ret = -1;
+	} else if (ret == 0 && rename(temp_path, path) < 0) {
+		mail_storage_set_critical(box->storage,
+			"rename(%s, %s) failed: %m", temp_path, path);
+		ret = -1;
+	}
+	if (ret < 0)
+		(void)unlink(temp_path);
+}
+
+static bool mail_thread_tree_refresh(struct mail_thread_mailbox *tbox,
+				     struct mail_thread_context *ctx)
+{
+	struct mail_thread_cache *cache = tbox->cache;
+	const struct mail_index_header *hdr;
+	struct mail_thread_tree *tree;
+
+	hdr = mail_index_get_header(ctx->box->view);
+	if (cache->tree != NULL && mail_thread_tree_is_current(cache->tree, hdr))
+		return TRUE;
+
+	/* another process may have already written a tree for this state */
+	tree = mail_thread_tree_read(ctx->box, hdr);
+	if (tree == NULL)
+		return FALSE;
+	if (cache->tree != NULL)
+		mail_thread_tree_unref(&cache->tree);
+	cache->tree = tree;
+	return TRUE;
+}
+
 int mail_thread_init(struct mailbox *box, struct mail_search_args *args,
 		     struct mail_thread_context **ctx_r)
 {
 	struct mail_thread_mailbox *tbox = MAIL_THREAD_CONTEXT(box);
 	struct mail_thread_context *ctx;
 	struct mail_search_context *search_ctx;
-	int ret;
+	bool all_mails;
 
 	i_assert(tbox->ctx == NULL);
 
-	if (args != NULL)
+	if (args != NULL) {
+		all_mails = mail_thread_search_args_all(args);
 		mail_search_args_ref(args);
-	else {
+	} else {
+		all_mails = TRUE;
 		args = mail_search_build_init();
 		mail_search_build_add_all(args);
 		mail_search_args_init(args, box, FALSE, NULL);
@@ -554,24 +867,28 @@ int mail_thread_init(struct mailbox *box, struct mail_search_args *args,
 	ctx = i_new(struct mail_thread_context, 1);
 	ctx->box = box;
 	ctx->search_args = args;
+	ctx->all_mails = all_mails;
 	ctx->t = mailbox_transaction_begin(ctx->box, 0);
+
+	if (all_mails && tbox->cache->search_result == NULL &&
+	    mail_thread_tree_refresh(tbox, ctx)) {
+		/* the thread tree is still the same as when it was last
+		   built. no need to look at the messages. */
+		tbox->ctx = ctx;
+		ctx->build_delayed = TRUE;
+		*ctx_r = ctx;
+		return 0;
+	}
+
 	/* perform search first, so we don't break if there are INTHREAD keys */
 	search_ctx = mailbox_search_init(ctx->t, args, NULL, 0, NULL);
 
 	tbox->ctx = ctx;
 
-	mail_thread_cache_sync_remove(tbox, ctx);
-	ret = mail_thread_index_map_build(ctx);
-	if (ret == 0)
-		mail_thread_cache_sync_add(tbox, ctx, search_ctx);
-	if (mailbox_search_deinit(&search_ctx) < 0)
-		ret = -1;
-
-	if (ret < 0) {
+	if (mail_thread_build(ctx, search_ctx) < 0) {
 		mail_thread_deinit(&ctx);
 		return -1;
 	} else {
-		memset(&ctx->added_uids, 0, sizeof(ctx->added_uids));
 		*ctx_r = ctx;
 		return 0;
 	}
@@ -579,7 +896,8 @@ int mail_thread_init(struct mailbox *box, struct mail_search_args *args,
 
 static void mail_thread_clear(struct mail_thread_context *ctx)
 {
-	mail_free(&ctx->tmp_mail);
+	if (ctx->tmp_mail != NULL)
+		mail_free(&ctx->tmp_mail);
 	(void)mailbox_transaction_commit(&ctx->t);
 }
 
@@ -601,9 +919,37 @@ mail_thread_iterate_init(struct mail_thread_context *ctx,
 			 enum mail_thread_type thread_type, bool write_seqs)
 {
 	struct mail_thread_mailbox *tbox = MAIL_THREAD_CONTEXT(ctx->box);
+	struct mail_thread_cache *cache = tbox->cache;
+	struct mail_search_context *search_ctx;
+	const struct mail_index_header *hdr;
+
+	if (cache->tree != NULL && cache->tree->thread_type == thread_type) {
+		/* thread nodes haven't changed since the tree was built */
+		return mail_thread_iterate_init_tree(cache->tree, ctx->box,
+						     write_seqs);
+	}
 
-	return mail_thread_iterate_init_full(tbox->cache, ctx->tmp_mail,
-					     thread_type, write_seqs);
+	if (ctx->build_delayed) {
+		/* the cached tree was for another thread type */
+		ctx->build_delayed = FALSE;
+		search_ctx = mailbox_search_init(ctx->t, ctx->search_args,
+						 NULL, 0, NULL);
+		if (mail_thread_build(ctx, search_ctx) < 0)
+			return mail_thread_iterate_init_failed();
+	}
+
+	if (cache->tree != NULL)
+		mail_thread_tree_unref(&cache->tree);
+	cache->tree = mail_thread_tree_build(cache, ctx->tmp_mail,
+					     thread_type);
+	if (ctx->all_mails) {
+		hdr = mail_index_get_header(ctx->box->view);
+		cache->tree->uid_validity = hdr->uid_validity;
+		cache->tree->next_uid = hdr->next_uid;
+		cache->tree->messages_count = hdr->messages_count;
+		mail_thread_tree_write(ctx->box, cache->tree);
+	}
+	return mail_thread_iterate_init_tree(cache->tree, ctx->box, write_seqs);
 }
 
 static void mail_thread_mailbox_close(struct mailbox *box)
@@ -626,6 +972,8 @@ static void mail_thread_mailbox_free(struct mailbox *box)
 	mail_index_strmap_deinit(&tbox->strmap);
 	tbox->module_ctx.super.free(box);
 
+	if (tbox->cache->tree != NULL)
+		mail_thread_tree_unref(&tbox->cache->tree);
 	array_free(&tbox->cache->thread_nodes);
 	i_free(tbox->cache);
 	i_free(tbox);
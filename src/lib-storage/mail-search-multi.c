@@ -0,0 +1,357 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "array.h"
+#include "fd-close-on-exec.h"
+#include "istream.h"
+#include "ostream.h"
+#include "strescape.h"
+#include "strnum.h"
+#include "mail-namespace.h"
+#include "mail-search.h"
+#include "mail-storage-settings.h"
+#include "mail-search-multi.h"
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+/* The search process writes to the pipe:
+
+   G<mailbox GUID>
+   <uid> for each match
+   + if the search finished successfully, or
+   -<enum mail_error>\t<error string> if it failed
+
+   The GUID line is missing if the mailbox doesn't exist. */
+
+struct mail_search_multi_box {
+	struct mail_namespace *ns;
+	const char *vname;
+
+	pid_t pid;
+	int fd;
+	struct istream *input;
+	unsigned int finished:1;
+};
+
+struct mail_search_multi_context {
+	pool_t pool;
+	struct mail_user *user;
+	struct mail_search_args *args;
+	enum mailbox_flags flags;
+	unsigned int max_processes;
+
+	ARRAY(struct mail_search_multi_box) boxes;
+	/* boxes before this have been fully read */
+	unsigned int read_idx;
+	/* boxes before this have had their search processes started */
+	unsigned int start_idx;
+
+	struct mail_search_multi_match match;
+	enum mail_error error;
+	unsigned int failed:1;
+};
+
+struct mail_search_multi_context *
+mail_search_multi_init(struct mail_user *user, struct mail_search_args *args,
+		       enum mailbox_flags flags)
+{
+	struct mail_search_multi_context *ctx;
+	pool_t pool;
+
+	pool = pool_alloconly_create("mail search multi", 1024);
+	ctx = p_new(pool, struct mail_search_multi_context, 1);
+	ctx->pool = pool;
+	ctx->user = user;
+	ctx->args = args;
+	ctx->flags = flags | MAILBOX_FLAG_READONLY;
+	ctx->max_processes =
+		mail_user_set_get_storage_set(user)->mail_search_concurrency;
+	if (ctx->max_processes == 0)
+		ctx->max_processes = 1;
+	p_array_init(&ctx->boxes, pool, 16);
+	return ctx;
+}
+
+void mail_search_multi_add(struct mail_search_multi_context *ctx,
+			   struct mail_namespace *ns, const char *vname)
+{
+	struct mail_search_multi_box *box;
+
+	box = array_append_space(&ctx->boxes);
+	box->ns = ns;
+	box->vname = p_strdup(ctx->pool, vname);
+	box->fd = -1;
+}
+
+static void
+mail_search_multi_set_error(struct mail_search_multi_context *ctx,
+			    enum mail_error error)
+{
+	ctx->failed = TRUE;
+	ctx->error = error;
+}
+
+static int
+search_process_search(struct mail_search_multi_context *ctx,
+		      struct mailbox *box, struct ostream *output)
+{
+	struct mailbox_transaction_context *t;
+	struct mail_search_context *search_ctx;
+	struct mail *mail;
+	int ret = 0;
+
+	mail_search_args_init(ctx->args, box, FALSE, NULL);
+	t = mailbox_transaction_begin(box, 0);
+	search_ctx = mailbox_search_init(t, ctx->args, NULL, 0, NULL);
+	/* stop early if the parent is no longer reading */
+	while (output->stream_errno == 0 &&
+	       mailbox_search_next(search_ctx, &mail)) T_BEGIN {
+		o_stream_nsend_str(output, t_strdup_printf("%u\n", mail->uid));
+	} T_END;
+	if (mailbox_search_deinit(&search_ctx) < 0)
+		ret = -1;
+	(void)mailbox_transaction_commit(&t);
+	return ret;
+}
+
+static void ATTR_NORETURN
+search_process_run(struct mail_search_multi_context *ctx,
+		   const struct mail_search_multi_box *sbox, int fd)
+{
+	const struct mail_search_multi_box *other;
+	struct mailbox *box;
+	struct mailbox_metadata metadata;
+	struct ostream *output;
+	const char *errstr;
+	enum mail_error error;
+	int ret = 0;
+
+	/* don't keep the other search processes' pipes open */
+	array_foreach(&ctx->boxes, other) {
+		if (other->fd != -1)
+			(void)close(other->fd);
+	}
+
+	output = o_stream_create_fd(fd, IO_BLOCK_SIZE, FALSE);
+	o_stream_cork(output);
+
+	box = mailbox_alloc(sbox->ns->list, sbox->vname, ctx->flags);
+	if (mailbox_sync(box, MAILBOX_SYNC_FLAG_FULL_READ) < 0 ||
+	    mailbox_get_metadata(box, MAILBOX_METADATA_GUID, &metadata) < 0)
+		ret = -1;
+	else {
+		o_stream_nsend_str(output, t_strdup_printf("G%s\n",
+			guid_128_to_string(metadata.guid)));
+		ret = search_process_search(ctx, box, output);
+	}
+	if (ret == 0)
+		o_stream_nsend_str(output, "+\n");
+	else {
+		errstr = mailbox_get_last_error(box, &error);
+		if (error == MAIL_ERROR_NOTFOUND)
+			o_stream_nsend_str(output, "+\n");
+		else {
+			o_stream_nsend_str(output, t_strdup_printf("-%d\t%s\n",
+				error, str_tabescape(errstr)));
+		}
+	}
+	mailbox_free(&box);
+
+	ret = o_stream_nfinish(output);
+	/* don't run any of the parent's deinitialization */
+	_exit(ret < 0 ? 1 : 0);
+}
+
+static int
+search_process_start(struct mail_search_multi_context *ctx,
+		     struct mail_search_multi_box *sbox)
+{
+	int fd[2];
+
+	if (pipe(fd) < 0) {
+		i_error("pipe() failed: %m");
+		return -1;
+	}
+	sbox->pid = fork();
+	if (sbox->pid < 0) {
+		i_error("fork() failed: %m");
+		i_close_fd(&fd[0]);
+		i_close_fd(&fd[1]);
+		return -1;
+	}
+	if (sbox->pid == 0) {
+		i_close_fd(&fd[0]);
+		search_process_run(ctx, sbox, fd[1]);
+	}
+	i_close_fd(&fd[1]);
+	fd_close_on_exec(fd[0], TRUE);
+	sbox->fd = fd[0];
+	sbox->input = i_stream_create_fd(sbox->fd, (size_t)-1, FALSE);
+	return 0;
+}
+
+static void search_processes_start(struct mail_search_multi_context *ctx)
+{
+	struct mail_search_multi_box *sbox;
+	unsigned int count = array_count(&ctx->boxes);
+
+	/* the processes before read_idx have already finished */
+	while (ctx->start_idx < count &&
+	       ctx->start_idx < ctx->read_idx + ctx->max_processes) {
+		sbox = array_idx_modifiable(&ctx->boxes, ctx->start_idx++);
+		if (search_process_start(ctx, sbox) < 0) {
+			i_error("Searching mailbox %s failed: "
+				"Couldn't start search process", sbox->vname);
+			mail_search_multi_set_error(ctx, MAIL_ERROR_TEMP);
+			sbox->finished = TRUE;
+		}
+	}
+}
+
+static void
+search_process_finish(struct mail_search_multi_context *ctx,
+		      struct mail_search_multi_box *sbox)
+{
+	int status;
+
+	if (sbox->input != NULL)
+		i_stream_unref(&sbox->input);
+	if (sbox->fd != -1)
+		i_close_fd(&sbox->fd);
+	if (sbox->pid <= 0)
+		return;
+
+	while (waitpid(sbox->pid, &status, 0) < 0) {
+		if (errno != EINTR) {
+			i_error("waitpid() failed: %m");
+			return;
+		}
+	}
+	sbox->pid = 0;
+	if (sbox->finished &&
+	    (!WIFEXITED(status) || WEXITSTATUS(status) != 0)) {
+		i_error("Searching mailbox %s failed: "
+			"Search process failed (status=%d)",
+			sbox->vname, status);
+		mail_search_multi_set_error(ctx, MAIL_ERROR_TEMP);
+	}
+}
+
+static void
+search_process_failed(struct mail_search_multi_context *ctx,
+		      struct mail_search_multi_box *sbox, const char *line)
+{
+	const char *p;
+	unsigned int error;
+
+	p = strchr(line, '\t');
+	if (p == NULL ||
+	    str_to_uint(t_strdup_until(line, p), &error) < 0) {
+		i_error("Searching mailbox %s failed: "
+			"Invalid input from search process: %s",
+			sbox->vname, line);
+		error = MAIL_ERROR_TEMP;
+	} else {
+		i_error("Searching mailbox %s failed: %s", sbox->vname,
+			str_tabunescape(t_strdup_noconst(p + 1)));
+	}
+	mail_search_multi_set_error(ctx, error);
+}
+
+static bool
+search_process_read_line(struct mail_search_multi_context *ctx,
+			 struct mail_search_multi_box *sbox)
+{
+	const char *line;
+
+	line = i_stream_read_next_line(sbox->input);
+	if (line == NULL) {
+		/* the process died before finishing */
+		sbox->finished = TRUE;
+		if (sbox->input->stream_errno != 0) {
+			errno = sbox->input->stream_errno;
+			i_error("Searching mailbox %s failed: "
+				"read(search process) failed: %m",
+				sbox->vname);
+		} else {
+			i_error("Searching mailbox %s failed: "
+				"Search process disconnected", sbox->vname);
+		}
+		mail_search_multi_set_error(ctx, MAIL_ERROR_TEMP);
+		return FALSE;
+	}
+
+	switch (line[0]) {
+	case 'G':
+		if (guid_128_from_string(line + 1, ctx->match.guid) < 0)
+			break;
+		return FALSE;
+	case '+':
+		sbox->finished = TRUE;
+		return FALSE;
+	case '-':
+		sbox->finished = TRUE;
+		search_process_failed(ctx, sbox, line + 1);
+		return FALSE;
+	default:
+		if (str_to_uint32(line, &ctx->match.uid) < 0)
+			break;
+		return TRUE;
+	}
+	i_error("Searching mailbox %s failed: "
+		"Invalid input from search process: %s", sbox->vname, line);
+	mail_search_multi_set_error(ctx, MAIL_ERROR_TEMP);
+	sbox->finished = TRUE;
+	return FALSE;
+}
+
+bool mail_search_multi_next(struct mail_search_multi_context *ctx,
+			    const struct mail_search_multi_match **match_r)
+{
+	struct mail_search_multi_box *sbox;
+
+	while (ctx->read_idx < array_count(&ctx->boxes)) {
+		search_processes_start(ctx);
+
+		sbox = array_idx_modifiable(&ctx->boxes, ctx->read_idx);
+		ctx->match.ns = sbox->ns;
+		ctx->match.vname = sbox->vname;
+		if (!sbox->finished) {
+			if (search_process_read_line(ctx, sbox)) {
+				*match_r = &ctx->match;
+				return TRUE;
+			}
+			if (!sbox->finished)
+				continue;
+		}
+		search_process_finish(ctx, sbox);
+		ctx->read_idx++;
+	}
+	return FALSE;
+}
+
+int mail_search_multi_deinit(struct mail_search_multi_context **_ctx,
+			     enum mail_error *error_r)
+{
+	struct mail_search_multi_context *ctx = *_ctx;
+	struct mail_search_multi_box *sbox;
+	int ret;
+
+	*_ctx = NULL;
+
+	/* closing the pipes makes the unfinished processes stop */
+	array_foreach_modifiable(&ctx->boxes, sbox) {
+		if (sbox->input != NULL)
+			i_stream_unref(&sbox->input);
+		if (sbox->fd != -1)
+			i_close_fd(&sbox->fd);
+	}
+	array_foreach_modifiable(&ctx->boxes, sbox)
+		search_process_finish(ctx, sbox);
+
+	ret = ctx->failed ? -1 : 0;
+	*error_r = ctx->error;
+	pool_unref(&ctx->pool);
+	return ret;
+}
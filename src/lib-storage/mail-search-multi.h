@@ -0,0 +1,40 @@
+#ifndef MAIL_SEARCH_MULTI_H
+#define MAIL_SEARCH_MULTI_H
+
+#include "guid.h"
+#include "mail-error.h"
+#include "mail-storage.h"
+
+struct mail_namespace;
+struct mail_search_args;
+struct mail_user;
+
+struct mail_search_multi_match {
+	struct mail_namespace *ns;
+	const char *vname;
+	guid_128_t guid;
+	uint32_t uid;
+};
+
+/* Search multiple mailboxes with the same search arguments. Each mailbox is
+   opened and searched by a separate forked process, with at most
+   mail_search_concurrency of them running at the same time. The matches are
+   returned in the same order as the mailboxes were added. */
+struct mail_search_multi_context *
+mail_search_multi_init(struct mail_user *user, struct mail_search_args *args,
+		       enum mailbox_flags flags);
+/* Add a mailbox to be searched. This can be called also while iterating
+   the matches. */
+void mail_search_multi_add(struct mail_search_multi_context *ctx,
+			   struct mail_namespace *ns, const char *vname);
+/* Returns TRUE if a match was returned, FALSE if all mailboxes have been
+   searched. Mailboxes that couldn't be searched are logged and skipped.
+   Nonexistent mailboxes are silently skipped. */
+bool mail_search_multi_next(struct mail_search_multi_context *ctx,
+			    const struct mail_search_multi_match **match_r);
+/* Returns 0 if all mailboxes were searched successfully, -1 if not.
+   error_r is set to the last error. */
+int mail_search_multi_deinit(struct mail_search_multi_context **ctx,
+			     enum mail_error *error_r);
+
+#endif
@@ -16,7 +16,10 @@ struct mail_storage_settings {
 	const char *mail_attachment_hash;
 	uoff_t mail_attachment_min_size;
 	const char *mail_attribute_dict;
+	const char *mail_index_shm_dir;
 	unsigned int mail_prefetch_count;
+	unsigned int mail_rebuild_concurrency;
+	unsigned int mail_search_concurrency;
 	const char *mail_cache_fields;
 	const char *mail_always_cache_fields;
 	const char *mail_never_cache_fields;
@@ -27,10 +30,14 @@ struct mail_storage_settings {
 	unsigned int mail_temp_scan_interval;
 	bool mail_save_crlf;
 	const char *mail_fsync;
+	bool mail_fsync_group_commit;
 	bool mmap_disable;
 	bool dotlock_use_excl;
 	bool mail_nfs_storage;
 	bool mail_nfs_index;
+	bool mail_index_inplace_write;
+	bool mail_cache_compress_background;
+	bool mail_index_log_packed;
 	bool mailbox_list_index;
 	bool mail_debug;
 	bool mail_full_filesystem_access;
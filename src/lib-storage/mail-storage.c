@@ -2360,5 +2360,13 @@ mail_storage_settings_to_index_flags(const struct mail_storage_settings *set)
 		index_flags |= MAIL_INDEX_OPEN_FLAG_DOTLOCK_USE_EXCL;
 	if (set->mail_nfs_index)
 		index_flags |= MAIL_INDEX_OPEN_FLAG_NFS_FLUSH;
+	if (set->mail_index_inplace_write)
+		index_flags |= MAIL_INDEX_OPEN_FLAG_INPLACE_WRITE;
+	if (set->mail_fsync_group_commit)
+		index_flags |= MAIL_INDEX_OPEN_FLAG_FSYNC_GROUP_COMMIT;
+	if (set->mail_cache_compress_background)
+		index_flags |= MAIL_INDEX_OPEN_FLAG_CACHE_COMPRESS_BACKGROUND;
+	if (set->mail_index_log_packed)
+		index_flags |= MAIL_INDEX_OPEN_FLAG_LOG_PACKED;
 	return index_flags;
 }
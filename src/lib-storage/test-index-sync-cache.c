@@ -0,0 +1,239 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "str.h"
+#include "net.h"
+#include "hostpid.h"
+#include "unlink-directory.h"
+#include "test-common.h"
+#include "mail-user.h"
+#include "mail-storage-settings.h"
+#include "mail-cache.h"
+#include "index/index-sync-private.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#define TEST_INDEXER_REQUEST \
+	"VERSION\tindexer\t1\t0\nOPTIMIZE\t0\ttestuser\tfoo\001tbar\n"
+
+struct mail_storage_module_register mail_storage_module_register = { 0 };
+struct index_storage_module index_storage_module =
+	MODULE_CONTEXT_INIT(&mail_storage_module_register);
+
+static uint32_t test_need_compress_file_seq;
+static unsigned int test_compress_count, test_compress_if_needed_count;
+
+bool mail_cache_need_compress(struct mail_cache *cache ATTR_UNUSED)
+{
+	return test_need_compress_file_seq != 0;
+}
+
+uint32_t
+mail_cache_get_need_compress_file_seq(struct mail_cache *cache ATTR_UNUSED)
+{
+	return test_need_compress_file_seq;
+}
+
+int mail_cache_compress_external(struct mail_cache *cache ATTR_UNUSED)
+{
+	test_compress_count++;
+	return 0;
+}
+
+int mail_cache_compress_if_needed(struct mail_cache *cache ATTR_UNUSED)
+{
+	test_compress_if_needed_count++;
+	return 1;
+}
+
+struct test_ctx {
+	char *dir;
+	const char *socket_path;
+	int listen_fd;
+
+	struct mail_user_settings user_set;
+	struct mail_user user;
+	struct mail_storage storage;
+	struct mailbox box;
+	struct index_mailbox_context ibox;
+};
+
+static void test_ctx_init(struct test_ctx *ctx)
+{
+	static int cache_dummy;
+
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->dir = i_strdup_printf("/tmp/test-index-sync-cache.%s.XXXXXX",
+				   my_pid);
+	if (mkdtemp(ctx->dir) == NULL)
+		i_fatal("mkdtemp(%s) failed: %m", ctx->dir);
+	ctx->socket_path = t_strconcat(ctx->dir, "/indexer", NULL);
+	ctx->listen_fd = -1;
+
+	ctx->user_set.base_dir = ctx->dir;
+	ctx->user.set = &ctx->user_set;
+	ctx->user.username = "testuser";
+	ctx->storage.user = &ctx->user;
+	ctx->box.storage = &ctx->storage;
+	ctx->box.vname = "foo\tbar";
+	ctx->box.cache = (void *)&cache_dummy;
+	i_array_init(&ctx->box.module_contexts, 4);
+	ctx->ibox.index_flags = MAIL_INDEX_OPEN_FLAG_CACHE_COMPRESS_BACKGROUND;
+	MODULE_CONTEXT_SET(&ctx->box, index_storage_module, &ctx->ibox);
+
+	test_need_compress_file_seq = 0;
+	test_compress_count = test_compress_if_needed_count = 0;
+}
+
+static void test_ctx_deinit(struct test_ctx *ctx)
+{
+	if (ctx->listen_fd != -1)
+		i_close_fd(&ctx->listen_fd);
+	array_free(&ctx->box.module_contexts);
+	if (unlink_directory(ctx->dir, UNLINK_DIRECTORY_FLAG_RMDIR) < 0)
+		i_error("unlink_directory(%s) failed: %m", ctx->dir);
+	i_free(ctx->dir);
+}
+
+static void test_indexer_listen(struct test_ctx *ctx)
+{
+	ctx->listen_fd = net_listen_unix(ctx->socket_path, 16);
+	if (ctx->listen_fd == -1)
+		i_fatal("net_listen_unix(%s) failed: %m", ctx->socket_path);
+	net_set_nonblock(ctx->listen_fd, TRUE);
+}
+
+static void test_indexer_stop(struct test_ctx *ctx)
+{
+	i_close_fd(&ctx->listen_fd);
+	if (unlink(ctx->socket_path) < 0)
+		i_fatal("unlink(%s) failed: %m", ctx->socket_path);
+}
+
+/* Returns the number of requests the indexer received. Each of them must
+   be the expected OPTIMIZE request. */
+static unsigned int test_indexer_requests(struct test_ctx *ctx)
+{
+	string_t *str = t_str_new(128);
+	unsigned char buf[128];
+	unsigned int count = 0;
+	ssize_t ret;
+	int fd;
+
+	while ((fd = net_accept(ctx->listen_fd, NULL, NULL)) >= 0) {
+		str_truncate(str, 0);
+		while ((ret = read(fd, buf, sizeof(buf))) > 0)
+			str_append_n(str, buf, ret);
+		test_assert(ret == 0);
+		test_assert(strcmp(str_c(str), TEST_INDEXER_REQUEST) == 0);
+		i_close_fd(&fd);
+		count++;
+	}
+	return count;
+}
+
+static void test_index_sync_cache_compress_request(void)
+{
+	struct test_ctx ctx;
+
+	test_begin("index sync cache compress request");
+	test_ctx_init(&ctx);
+	test_indexer_listen(&ctx);
+
+	/* nothing to do */
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_indexer_requests(&ctx) == 0);
+
+	/* compression is requested once for the cache file */
+	test_need_compress_file_seq = 5;
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_indexer_requests(&ctx) == 1);
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_indexer_requests(&ctx) == 0);
+
+	/* the indexer compressed the file and the new one needs
+	   compression as well */
+	test_need_compress_file_seq = 6;
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_indexer_requests(&ctx) == 1);
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_indexer_requests(&ctx) == 0);
+
+	test_assert(test_compress_count == 0);
+	test_assert(test_compress_if_needed_count == 0);
+
+	/* without background compression the index sync does it */
+	test_need_compress_file_seq = 7;
+	ctx.ibox.index_flags = 0;
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_indexer_requests(&ctx) == 0);
+	test_assert(test_compress_count == 0);
+
+	test_ctx_deinit(&ctx);
+	test_end();
+}
+
+static void test_index_sync_cache_compress_fallback(void)
+{
+	struct test_ctx ctx;
+
+	test_begin("index sync cache compress fallback");
+	test_ctx_init(&ctx);
+
+	/* indexer isn't running, compress directly */
+	test_need_compress_file_seq = 5;
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_compress_count == 1);
+
+	/* the compression failed or another process marked the cache for
+	   compression again. retry on the next sync. */
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_compress_count == 2);
+
+	/* the indexer is back */
+	test_indexer_listen(&ctx);
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_indexer_requests(&ctx) == 1);
+	test_assert(test_compress_count == 2);
+
+	/* the indexer went away after accepting the request. it's not
+	   requested again for the same file. */
+	test_indexer_stop(&ctx);
+	index_mailbox_sync_cache_compress(&ctx.box, 0);
+	test_assert(test_compress_count == 2);
+
+	test_ctx_deinit(&ctx);
+	test_end();
+}
+
+static void test_index_sync_cache_compress_optimize(void)
+{
+	struct test_ctx ctx;
+
+	test_begin("index sync cache compress optimize");
+	test_ctx_init(&ctx);
+	test_indexer_listen(&ctx);
+
+	/* indexer-worker handling the request compresses the cache itself */
+	test_need_compress_file_seq = 5;
+	index_mailbox_sync_cache_compress(&ctx.box, MAILBOX_SYNC_FLAG_OPTIMIZE);
+	test_assert(test_compress_if_needed_count == 1);
+	test_assert(test_compress_count == 0);
+	test_assert(test_indexer_requests(&ctx) == 0);
+
+	test_ctx_deinit(&ctx);
+	test_end();
+}
+
+int main(void)
+{
+	static void (*test_functions[])(void) = {
+		test_index_sync_cache_compress_request,
+		test_index_sync_cache_compress_fallback,
+		test_index_sync_cache_compress_optimize,
+		NULL
+	};
+	return test_run(test_functions);
+}
@@ -1,9 +1,17 @@
 /* Copyright (c) 2007-2013 Dovecot authors, see the included COPYING file */
 
 #include "lib.h"
+#include "cpu-features.h"
 #include "base64.h"
 #include "buffer.h"
 
+#ifdef HAVE_CPU_X86_SIMD
+#  include <immintrin.h>
+#endif
+
+/* Number of 16 byte blocks the SIMD code processes between buffer appends */
+#define BASE64_SIMD_BATCH_BLOCKS 32
+
 static const char b64enc[] =
 	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
@@ -43,13 +51,126 @@ static const unsigned char b64dec[256] = {
 	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
 };
 
+#ifdef HAVE_CPU_X86_SIMD
+/* The SIMD code is based on Wojciech Muła's base64 algorithms. Each block
+   converts 12 bytes into 16 base64 characters or back. */
+static size_t ATTR_TARGET("ssse3")
+base64_encode_ssse3(const unsigned char *src, size_t src_size, buffer_t *dest)
+{
+	const __m128i shuf = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+					  4, 5, 3, 4, 1, 2, 0, 1);
+	const __m128i shift_lut = _mm_setr_epi8(
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+		'/' - 63, 'A', 0, 0);
+	unsigned char tmp[BASE64_SIMD_BATCH_BLOCKS * 16];
+	__m128i in, t0, t1, t2, t3, indices, result, less;
+	size_t src_pos = 0;
+	unsigned int i;
+
+	/* the 16 byte loads read 4 bytes past the 12 bytes that are used */
+	while (src_pos + 16 <= src_size) {
+		for (i = 0; i < BASE64_SIMD_BATCH_BLOCKS &&
+			    src_pos + 16 <= src_size; i++, src_pos += 12) {
+			in = _mm_loadu_si128((const void *)(src + src_pos));
+			in = _mm_shuffle_epi8(in, shuf);
+			/* split the 3 byte groups into 6 bit indices */
+			t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+			t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+			t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+			t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+			indices = _mm_or_si128(t1, t3);
+
+			/* map the indices to characters: find the offset to
+			   add for each index range */
+			result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+			less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+			result = _mm_or_si128(result,
+				_mm_and_si128(less, _mm_set1_epi8(13)));
+			result = _mm_shuffle_epi8(shift_lut, result);
+			result = _mm_add_epi8(result, indices);
+			_mm_storeu_si128((void *)(tmp + i * 16), result);
+		}
+		buffer_append(dest, tmp, i * 16);
+	}
+	return src_pos;
+}
+
+static inline __m128i ATTR_TARGET("ssse3")
+base64_range_mask(__m128i in, char first, char last)
+{
+	return _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8(first - 1)),
+			     _mm_cmpgt_epi8(_mm_set1_epi8(last + 1), in));
+}
+
+/* Decode 16 byte blocks as long as they contain only base64 characters.
+   Returns the number of bytes decoded from src. */
+static size_t ATTR_TARGET("ssse3")
+base64_decode_ssse3(const unsigned char *src, size_t src_size, buffer_t *dest)
+{
+	const __m128i pack_shuf = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+						14, 13, 12, -1, -1, -1, -1);
+	unsigned char tmp[BASE64_SIMD_BATCH_BLOCKS * 12 + 4];
+	__m128i in, upper, lower, digit, plus, slash, shift, valid, values;
+	size_t src_pos = 0;
+	unsigned int i;
+	bool invalid = FALSE;
+
+	while (src_pos + 16 <= src_size && !invalid) {
+		for (i = 0; i < BASE64_SIMD_BATCH_BLOCKS &&
+			    src_pos + 16 <= src_size; i++, src_pos += 16) {
+			in = _mm_loadu_si128((const void *)(src + src_pos));
+			/* bytes >= 0x80 are negative, so they don't match
+			   any of the ranges */
+			upper = base64_range_mask(in, 'A', 'Z');
+			lower = base64_range_mask(in, 'a', 'z');
+			digit = base64_range_mask(in, '0', '9');
+			plus = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+			slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+			valid = _mm_or_si128(_mm_or_si128(upper, lower),
+				_mm_or_si128(digit, _mm_or_si128(plus, slash)));
+			if (_mm_movemask_epi8(valid) != 0xffff) {
+				/* whitespace, padding or garbage */
+				invalid = TRUE;
+				break;
+			}
+			shift = _mm_or_si128(
+				_mm_or_si128(
+					_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+					_mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+				_mm_or_si128(
+					_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+					_mm_or_si128(
+						_mm_and_si128(plus, _mm_set1_epi8(62 - '+')),
+						_mm_and_si128(slash, _mm_set1_epi8(63 - '/')))));
+			values = _mm_add_epi8(in, shift);
+
+			/* pack the 6 bit values into 12 bytes */
+			values = _mm_maddubs_epi16(values,
+						   _mm_set1_epi32(0x01400140));
+			values = _mm_madd_epi16(values,
+						_mm_set1_epi32(0x00011000));
+			values = _mm_shuffle_epi8(values, pack_shuf);
+			_mm_storeu_si128((void *)(tmp + i * 12), values);
+		}
+		buffer_append(dest, tmp, i * 12);
+	}
+	return src_pos;
+}
+#endif
+
 void base64_encode(const void *src, size_t src_size, buffer_t *dest)
 {
 	const unsigned char *src_c = src;
 	unsigned char tmp[4];
-	size_t src_pos;
+	size_t src_pos = 0;
 
-	for (src_pos = 0; src_pos < src_size; ) {
+#ifdef HAVE_CPU_X86_SIMD
+	if (src_size >= 16 &&
+	    (cpu_features_get() & CPU_FEATURE_SSSE3) != 0)
+		src_pos = base64_encode_ssse3(src_c, src_size, dest);
+#endif
+	for (; src_pos < src_size; ) {
 		tmp[0] = b64enc[src_c[src_pos] >> 2];
 		switch (src_size - src_pos) {
 		case 1:
@@ -88,8 +209,26 @@ int base64_decode(const void *src, size_t src_size,
 	size_t src_pos;
 	unsigned char input[4], output[3];
 	int ret = 1;
+#ifdef HAVE_CPU_X86_SIMD
+	size_t simd_pos = 0;
+	bool simd = src_size >= 16 &&
+		(cpu_features_get() & CPU_FEATURE_SSSE3) != 0;
+#endif
 
 	for (src_pos = 0; src_pos+3 < src_size; ) {
+#ifdef HAVE_CPU_X86_SIMD
+		if (simd && src_pos >= simd_pos && src_pos + 16 <= src_size) {
+			/* decode as much as possible with SIMD. the scalar
+			   code handles the block that contained whitespace,
+			   padding or invalid characters before we try
+			   again. */
+			src_pos += base64_decode_ssse3(src_c + src_pos,
+						       src_size - src_pos, dest);
+			simd_pos = src_pos + 16;
+			if (src_pos+3 >= src_size)
+				break;
+		}
+#endif
 		input[0] = b64dec[src_c[src_pos]];
 		if (input[0] == 0xff) {
 			if (unlikely(!IS_EMPTY(src_c[src_pos]))) {
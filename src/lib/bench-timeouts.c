@@ -0,0 +1,82 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "ioloop.h"
+#include "strnum.h"
+#include "time-util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Compare the timeout backends by adding a lot of timeouts, resetting them
+   randomly (like idle timeouts of busy clients) and removing them. */
+
+#define BENCH_RESET_MULTIPLIER 10
+
+static void bench_timeout_callback(void *context ATTR_UNUSED)
+{
+}
+
+static void
+bench_timeouts(const char *name, enum io_loop_flags flags, unsigned int count)
+{
+	struct ioloop *ioloop;
+	struct timeout **timeouts;
+	struct timeval tv_start, tv_add, tv_reset, tv_end;
+	unsigned int i, reset_count = count * BENCH_RESET_MULTIPLIER;
+
+	timeouts = i_new(struct timeout *, count);
+	ioloop = io_loop_create_flags(flags);
+
+	if (gettimeofday(&tv_start, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	for (i = 0; i < count; i++) {
+		timeouts[i] = timeout_add(1000 * (60 + rand() % (30*60)),
+					  bench_timeout_callback, NULL);
+	}
+	if (gettimeofday(&tv_add, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	for (i = 0; i < reset_count; i++)
+		timeout_reset(timeouts[rand() % count]);
+	if (gettimeofday(&tv_reset, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	for (i = 0; i < count; i++)
+		timeout_remove(&timeouts[i]);
+	if (gettimeofday(&tv_end, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+
+	io_loop_destroy(&ioloop);
+	i_free(timeouts);
+
+	printf("%-12s %8u timeouts: add %7lld us, %u resets %7lld us, "
+	       "remove %7lld us\n", name, count,
+	       timeval_diff_usecs(&tv_add, &tv_start), reset_count,
+	       timeval_diff_usecs(&tv_reset, &tv_add),
+	       timeval_diff_usecs(&tv_end, &tv_reset));
+}
+
+static void bench_timeouts_count(unsigned int count)
+{
+	srand(count);
+	bench_timeouts("priorityq", 0, count);
+	srand(count);
+	bench_timeouts("timing-wheel", IO_LOOP_FLAG_TIMING_WHEEL, count);
+}
+
+int main(int argc, char *argv[])
+{
+	static const unsigned int counts[] = { 1000, 10000, 100000 };
+	unsigned int i, count;
+
+	lib_init();
+	if (argc > 1) {
+		if (str_to_uint(argv[1], &count) < 0 || count == 0)
+			i_fatal("Usage: bench-timeouts [<count>]");
+		bench_timeouts_count(count);
+	} else {
+		for (i = 0; i < N_ELEMENTS(counts); i++)
+			bench_timeouts_count(counts[i]);
+	}
+	lib_deinit();
+	return 0;
+}
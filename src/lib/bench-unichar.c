@@ -0,0 +1,151 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "buffer.h"
+#include "cpu-features.h"
+#include "strnum.h"
+#include "time-util.h"
+#include "unichar.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Measure the UTF-8 validation and titlecasing throughput with a corpus
+   resembling a mailbox with mixed language mails: mostly ASCII headers and
+   English text, with European, Cyrillic, Greek and CJK text mixed in. */
+
+#define BENCH_DEFAULT_CORPUS_SIZE (8*1024*1024)
+#define BENCH_ROUNDS 5
+
+static const char *const bench_paragraphs[] = {
+	/* headers */
+	"Received: from mail.example.com (mail.example.com [192.0.2.1])\r\n"
+	"\tby mx.example.org with ESMTP id 1234567890; Mon, 1 Jul 2013 12:00:00 +0300\r\n"
+	"From: Example User <user@example.com>\r\nTo: list@example.org\r\n"
+	"Subject: Re: [list] weekly meeting notes\r\n"
+	"Content-Type: text/plain; charset=utf-8\r\n\r\n",
+	/* English */
+	"Hi all, here are the notes from this week's meeting. We discussed the "
+	"upcoming release schedule and agreed to freeze the features by Friday. "
+	"Please review the attached document and send your comments before the "
+	"next meeting.\r\n\r\n",
+	/* German */
+	"Sehr geehrte Damen und Herren, vielen Dank f\xc3\xbcr Ihre Anfrage. "
+	"Die gew\xc3\xbcnschten Unterlagen schicken wir Ihnen gr\xc3\xb6\xc3\x9ftenteils "
+	"bis zum n\xc3\xa4" "chsten Montag zu. Mit freundlichen Gr\xc3\xbc\xc3\x9f" "en\r\n\r\n",
+	/* French */
+	"Bonjour \xc3\xa0 tous, la r\xc3\xa9union de d\xc3\xa9" "cembre aura lieu "
+	"\xc3\xa0 l'h\xc3\xb4tel de ville. N'h\xc3\xa9sitez pas \xc3\xa0 "
+	"r\xc3\xa9pondre avant vendredi.\r\n\r\n",
+	/* Finnish */
+	"Hyv\xc3\xa4\xc3\xa4 p\xc3\xa4iv\xc3\xa4\xc3\xa4! Kokous pidet\xc3\xa4\xc3\xa4n "
+	"ensi viikon tiistaina. T\xc3\xa4ll\xc3\xa4 kertaa aiheena on "
+	"yll\xc3\xa4pito.\r\n\r\n",
+	/* Russian */
+	"\xd0\x97\xd0\xb4\xd1\x80\xd0\xb0\xd0\xb2\xd1\x81\xd1\x82\xd0\xb2\xd1\x83"
+	"\xd0\xb9\xd1\x82\xd0\xb5, \xd0\xba\xd0\xbe\xd0\xbb\xd0\xbb\xd0\xb5\xd0\xb3"
+	"\xd0\xb8! \xd0\x9f\xd1\x80\xd0\xb8\xd1\x81\xd1\x8b\xd0\xbb\xd0\xb0\xd1\x8e "
+	"\xd0\xbe\xd1\x82\xd1\x87\xd1\x91\xd1\x82 \xd0\xb7\xd0\xb0 \xd0\xbd\xd0\xb5"
+	"\xd0\xb4\xd0\xb5\xd0\xbb\xd1\x8e.\r\n\r\n",
+	/* Greek */
+	"\xce\x93\xce\xb5\xce\xb9\xce\xb1 \xcf\x83\xce\xb1\xcf\x82, \xcf\x84\xce\xbf "
+	"\xcf\x83\xcf\x85\xce\xbc\xce\xb2\xce\xbf\xcf\x8d\xce\xbb\xce\xb9\xce\xbf "
+	"\xce\xb8\xce\xb1 \xce\xb3\xce\xaf\xce\xbd\xce\xb5\xce\xb9 \xce\xb1\xcf\x8d"
+	"\xcf\x81\xce\xb9\xce\xbf.\r\n\r\n",
+	/* Chinese */
+	"\xe5\x90\x84\xe4\xbd\x8d\xe5\xa5\xbd\xef\xbc\x8c\xe6\x9c\xac\xe5\x91\xa8"
+	"\xe7\x9a\x84\xe4\xbc\x9a\xe8\xae\xae\xe8\xae\xb0\xe5\xbd\x95\xe5\xb7\xb2"
+	"\xe7\xbb\x8f\xe5\x8f\x91\xe9\x80\x81\xe3\x80\x82\xe8\xaf\xb7\xe5\x9c\xa8"
+	"\xe5\x91\xa8\xe4\xba\x94\xe4\xb9\x8b\xe5\x89\x8d\xe5\x9b\x9e\xe5\xa4\x8d"
+	"\xe3\x80\x82\r\n\r\n",
+	/* Japanese */
+	"\xe7\x9a\x86\xe3\x81\x95\xe3\x82\x93\xe3\x80\x81\xe3\x81\x8a\xe7\x96\xb2"
+	"\xe3\x82\x8c\xe6\xa7\x98\xe3\x81\xa7\xe3\x81\x99\xe3\x80\x82\xe6\x9d\xa5"
+	"\xe9\x80\xb1\xe3\x81\xae\xe4\xbc\x9a\xe8\xad\xb0\xe3\x81\xab\xe3\x81\xa4"
+	"\xe3\x81\x84\xe3\x81\xa6\xe3\x81\x94\xe9\x80\xa3\xe7\xb5\xa1\xe3\x81\x97"
+	"\xe3\x81\xbe\xe3\x81\x99\xe3\x80\x82\r\n\r\n",
+	/* Korean */
+	"\xec\x95\x88\xeb\x85\x95\xed\x95\x98\xec\x84\xb8\xec\x9a\x94, \xeb\x8b\xa4"
+	"\xec\x9d\x8c \xed\x9a\x8c\xec\x9d\x98\xeb\x8a\x94 \xea\xb8\x88\xec\x9a\x94"
+	"\xec\x9d\xbc\xec\x9e\x85\xeb\x8b\x88\xeb\x8b\xa4.\r\n\r\n",
+	/* quoted reply */
+	"> On Mon, Jul 1, 2013 at 10:00 AM, Example User wrote:\r\n"
+	"> > Does anyone have the numbers from the last quarter?\r\n"
+	"> Yes, see the spreadsheet in the shared folder.\r\n\r\n"
+};
+
+static buffer_t *bench_create_corpus(size_t size)
+{
+	buffer_t *corpus;
+	const char *paragraph;
+
+	corpus = buffer_create_dynamic(default_pool, size + 1024);
+	while (corpus->used < size) {
+		/* about half of the text is English or headers */
+		if (rand() % 2 == 0)
+			paragraph = bench_paragraphs[rand() % 2];
+		else
+			paragraph = bench_paragraphs[rand() % N_ELEMENTS(bench_paragraphs)];
+		buffer_append(corpus, paragraph, strlen(paragraph));
+	}
+	return corpus;
+}
+
+static void
+bench_unichar_run(const char *name, const buffer_t *corpus,
+		  enum cpu_feature features)
+{
+	buffer_t *output;
+	struct timeval tv_start, tv_valid, tv_end;
+	unsigned int i;
+	long long valid_usecs, titlecase_usecs;
+
+	cpu_features_set_mask(features);
+	output = buffer_create_dynamic(default_pool, corpus->used * 2);
+
+	if (gettimeofday(&tv_start, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		if (!uni_utf8_get_valid_data(corpus->data, corpus->used, output))
+			i_unreached();
+	}
+	if (gettimeofday(&tv_valid, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		buffer_set_used_size(output, 0);
+		if (uni_utf8_to_decomposed_titlecase(corpus->data, corpus->used,
+						     output) < 0)
+			i_unreached();
+	}
+	if (gettimeofday(&tv_end, NULL) < 0)
+		i_fatal("gettimeofday() failed: %m");
+	buffer_free(&output);
+
+	valid_usecs = timeval_diff_usecs(&tv_valid, &tv_start);
+	titlecase_usecs = timeval_diff_usecs(&tv_end, &tv_valid);
+	printf("%-8s validate %7.1f MB/s, titlecase %7.1f MB/s\n", name,
+	       (double)corpus->used * BENCH_ROUNDS / I_MAX(valid_usecs, 1),
+	       (double)corpus->used * BENCH_ROUNDS / I_MAX(titlecase_usecs, 1));
+}
+
+int main(int argc, char *argv[])
+{
+	buffer_t *corpus;
+	unsigned int size = BENCH_DEFAULT_CORPUS_SIZE;
+
+	lib_init();
+	if (argc > 1) {
+		if (str_to_uint(argv[1], &size) < 0 || size == 0)
+			i_fatal("Usage: bench-unichar [<corpus size>]");
+	}
+	srand(size);
+	corpus = bench_create_corpus(size);
+	printf("corpus size %"PRIuSIZE_T" bytes\n", corpus->used);
+
+	bench_unichar_run("scalar", corpus, 0);
+	bench_unichar_run("simd", corpus, (enum cpu_feature)-1);
+
+	buffer_free(&corpus);
+	lib_deinit();
+	return 0;
+}
@@ -0,0 +1,68 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "cpu-features.h"
+
+#ifdef HAVE_CPU_X86_SIMD
+#  include <cpuid.h>
+#endif
+
+static bool cpu_features_initialized = FALSE;
+static enum cpu_feature cpu_features, cpu_features_mask = (enum cpu_feature)-1;
+
+#ifdef HAVE_CPU_X86_SIMD
+static bool cpu_os_saves_ymm(void)
+{
+	uint32_t eax, edx;
+
+	/* XCR0 must have both XMM and YMM state enabled */
+	__asm__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+	return (eax & 0x06) == 0x06;
+}
+
+static enum cpu_feature cpu_features_detect(void)
+{
+	enum cpu_feature features = 0;
+	unsigned int eax, ebx, ecx, edx;
+
+	if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+		return 0;
+
+	if ((edx & (1 << 26)) != 0)
+		features |= CPU_FEATURE_SSE2;
+	if ((ecx & (1 << 9)) != 0)
+		features |= CPU_FEATURE_SSSE3;
+	if ((ecx & (1 << 20)) != 0)
+		features |= CPU_FEATURE_SSE42;
+	if ((ecx & (1 << 1)) != 0)
+		features |= CPU_FEATURE_PCLMUL;
+
+	/* AVX2 needs also OS support for saving the YMM registers */
+	if ((ecx & (1 << 27)) != 0 && cpu_os_saves_ymm() &&
+	    __get_cpuid_max(0, NULL) >= 7) {
+		__cpuid_count(7, 0, eax, ebx, ecx, edx);
+		if ((ebx & (1 << 5)) != 0)
+			features |= CPU_FEATURE_AVX2;
+	}
+	return features;
+}
+#else
+static enum cpu_feature cpu_features_detect(void)
+{
+	return 0;
+}
+#endif
+
+enum cpu_feature cpu_features_get(void)
+{
+	if (!cpu_features_initialized) {
+		cpu_features = cpu_features_detect();
+		cpu_features_initialized = TRUE;
+	}
+	return cpu_features & cpu_features_mask;
+}
+
+void cpu_features_set_mask(enum cpu_feature mask)
+{
+	cpu_features_mask = mask;
+}
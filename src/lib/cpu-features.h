@@ -0,0 +1,30 @@
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+/* HAVE_CPU_X86_SIMD is defined when the compiler can build x86 SIMD code
+   paths with target attributes. They must be called only after checking
+   from cpu_features_get() that the CPU supports them. */
+#if (defined(__x86_64__) || defined(__i386__)) && \
+	((defined(__GNUC__) && __GNUC__ * 100 + __GNUC_MINOR__ >= 409) || \
+	 defined(__clang__))
+#  define HAVE_CPU_X86_SIMD
+#  define ATTR_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+enum cpu_feature {
+	CPU_FEATURE_SSE2	= 0x01,
+	CPU_FEATURE_SSSE3	= 0x02,
+	CPU_FEATURE_SSE42	= 0x04,
+	CPU_FEATURE_AVX2	= 0x08,
+	CPU_FEATURE_PCLMUL	= 0x10
+};
+
+/* Returns the SIMD features usable with this CPU and OS. Always returns 0
+   if the code wasn't compiled with HAVE_CPU_X86_SIMD. */
+enum cpu_feature cpu_features_get(void);
+/* Limit the returned features to the given mask. This is mainly useful for
+   testing the fallback code paths. The setting is global, so it should be
+   done before creating any contexts that cache the feature lookup. */
+void cpu_features_set_mask(enum cpu_feature mask);
+
+#endif
@@ -1,9 +1,14 @@
 /* Copyright (c) 2006-2013 Dovecot authors, see the included COPYING file */
 
 #include "lib.h"
+#include "cpu-features.h"
 #include "crc32.h"
 
-static uint32_t crc32tab[256] = {
+#ifdef HAVE_CPU_X86_SIMD
+#  include <immintrin.h>
+#endif
+
+static const uint32_t crc32tab[256] = {
 	0x00000000,
 	0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F,
 	0xE963A535, 0x9E6495A3, 0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E,
@@ -58,6 +63,143 @@ static uint32_t crc32tab[256] = {
 	0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
 };
 
+#ifndef WORDS_BIGENDIAN
+/* crc32tab8[n][i] is the CRC of byte i followed by n zero bytes. This allows
+   processing 8 bytes at a time with independent table lookups. */
+static uint32_t crc32tab8[8][256];
+static bool crc32tab8_initialized = FALSE;
+
+static void crc32tab8_init(void)
+{
+	unsigned int i, n;
+	uint32_t crc;
+
+	for (i = 0; i < 256; i++) {
+		crc = crc32tab[i];
+		crc32tab8[0][i] = crc;
+		for (n = 1; n < 8; n++) {
+			crc = (crc >> 8) ^ crc32tab[crc & 0xff];
+			crc32tab8[n][i] = crc;
+		}
+	}
+	crc32tab8_initialized = TRUE;
+}
+#endif
+
+static uint32_t
+crc32_slice8(uint32_t crc, const uint8_t *p, size_t size)
+{
+	const uint8_t *end = p + size;
+#ifndef WORDS_BIGENDIAN
+	uint32_t one, two;
+
+	if (size >= 16) {
+		if (!crc32tab8_initialized)
+			crc32tab8_init();
+		for (; size >= 8; size -= 8, p += 8) {
+			memcpy(&one, p, sizeof(one));
+			memcpy(&two, p + 4, sizeof(two));
+			one ^= crc;
+			crc = crc32tab8[7][one & 0xff] ^
+				crc32tab8[6][(one >> 8) & 0xff] ^
+				crc32tab8[5][(one >> 16) & 0xff] ^
+				crc32tab8[4][one >> 24] ^
+				crc32tab8[3][two & 0xff] ^
+				crc32tab8[2][(two >> 8) & 0xff] ^
+				crc32tab8[1][(two >> 16) & 0xff] ^
+				crc32tab8[0][two >> 24];
+		}
+	}
+#endif
+	for (; p != end; p++)
+		crc = (crc >> 8) ^ crc32tab[((crc ^ *p) & 0xff)];
+	return crc;
+}
+
+#ifdef HAVE_CPU_X86_SIMD
+/* Don't bother setting up the folding for less than this many bytes */
+#define CRC32_PCLMUL_MIN_SIZE 64
+
+/* CRC folding with carry-less multiplication, as described in Intel's
+   "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+   Instruction" paper. The constants are for the bit-reflected CRC-32
+   polynomial. size must be at least 64 and a multiple of 16. */
+static uint32_t ATTR_TARGET("pclmul,sse2")
+crc32_pclmul(uint32_t crc, const uint8_t *p, size_t size)
+{
+	const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+	const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+	const __m128i k5 = _mm_set_epi64x(0, 0x0163cd6124LL);
+	const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+	const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+	__m128i x1, x2, x3, x4, x5, x6, x7, x8;
+
+	i_assert(size >= CRC32_PCLMUL_MIN_SIZE && size % 16 == 0);
+
+	x1 = _mm_loadu_si128((const void *)(p + 0x00));
+	x2 = _mm_loadu_si128((const void *)(p + 0x10));
+	x3 = _mm_loadu_si128((const void *)(p + 0x20));
+	x4 = _mm_loadu_si128((const void *)(p + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+	p += 64; size -= 64;
+
+	/* fold 64 bytes at a time into the four accumulators */
+	for (; size >= 64; p += 64, size -= 64) {
+		x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+			_mm_loadu_si128((const void *)(p + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+			_mm_loadu_si128((const void *)(p + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+			_mm_loadu_si128((const void *)(p + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+			_mm_loadu_si128((const void *)(p + 0x30)));
+	}
+
+	/* fold the accumulators into one */
+	x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+	x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+	x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+	/* fold the remaining 16 byte blocks */
+	for (; size >= 16; p += 16, size -= 16) {
+		x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+			_mm_loadu_si128((const void *)p));
+	}
+
+	/* 128 bits -> 64 bits */
+	x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, mask32);
+	x1 = _mm_clmulepi64_si128(x1, k5, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	/* Barrett reduction to 32 bits */
+	x2 = _mm_and_si128(x1, mask32);
+	x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+	x2 = _mm_and_si128(x2, mask32);
+	x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	return (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+#endif
+
 uint32_t crc32_data(const void *data, size_t size)
 {
 	return crc32_data_more(0, data, size);
@@ -65,11 +207,22 @@ uint32_t crc32_data(const void *data, size_t size)
 
 uint32_t crc32_data_more(uint32_t crc, const void *data, size_t size)
 {
-	const uint8_t *p = data, *end = p + size;
+	const uint8_t *p = data;
+#ifdef HAVE_CPU_X86_SIMD
+	size_t block_size;
+#endif
 
 	crc ^= 0xffffffff;
-	for (; p != end; p++)
-		crc = (crc >> 8) ^ crc32tab[((crc ^ *p) & 0xff)];
+#ifdef HAVE_CPU_X86_SIMD
+	if (size >= CRC32_PCLMUL_MIN_SIZE &&
+	    (cpu_features_get() & CPU_FEATURE_PCLMUL) != 0) {
+		block_size = size & ~(size_t)15;
+		crc = crc32_pclmul(crc, p, block_size);
+		p += block_size;
+		size -= block_size;
+	}
+#endif
+	crc = crc32_slice8(crc, p, size);
 	crc ^= 0xffffffff;
 	return crc;
 }
@@ -89,3 +242,38 @@ uint32_t crc32_str_more(uint32_t crc, const char *str)
 	crc ^= 0xffffffff;
 	return crc;
 }
+
+static void hash_method_init_crc32(void *context)
+{
+	uint32_t *crc = context;
+
+	*crc = 0;
+}
+
+static void
+hash_method_loop_crc32(void *context, const void *data, size_t size)
+{
+	uint32_t *crc = context;
+
+	*crc = crc32_data_more(*crc, data, size);
+}
+
+static void hash_method_result_crc32(void *context, unsigned char *result_r)
+{
+	uint32_t *crc = context;
+
+	result_r[0] = (*crc & 0xff000000) >> 24;
+	result_r[1] = (*crc & 0x00ff0000) >> 16;
+	result_r[2] = (*crc & 0x0000ff00) >> 8;
+	result_r[3] = (*crc & 0x000000ff);
+}
+
+const struct hash_method hash_method_crc32 = {
+	"crc32",
+	sizeof(uint32_t),
+	sizeof(uint32_t),
+
+	hash_method_init_crc32,
+	hash_method_loop_crc32,
+	hash_method_result_crc32
+};
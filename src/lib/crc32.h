@@ -1,10 +1,19 @@
 #ifndef CRC32_H
 #define CRC32_H
 
+#include "hash-method.h"
+
+/* The data functions use slicing-by-8 tables or PCLMUL folding when the CPU
+   supports it. The result is the same regardless of the implementation. */
 uint32_t crc32_data(const void *data, size_t size) ATTR_PURE;
 uint32_t crc32_str(const char *str) ATTR_PURE;
 
+/* Continue calculating CRC from the previously returned value. This allows
+   checksumming the data in blocks as it passes through streams. */
 uint32_t crc32_data_more(uint32_t crc, const void *data, size_t size) ATTR_PURE;
 uint32_t crc32_str_more(uint32_t crc, const char *str) ATTR_PURE;
 
+/* The digest is the CRC in big endian. */
+extern const struct hash_method hash_method_crc32;
+
 #endif
@@ -4,6 +4,7 @@
 
 #include "lib.h"
 #include "data-stack.h"
+#include "mem-profile.h"
 
 #include <stdlib.h>
 
@@ -51,6 +52,16 @@ struct stack_frame_block {
 	struct stack_block *block[BLOCK_FRAME_COUNT];
         size_t block_space_used[BLOCK_FRAME_COUNT];
 	size_t last_alloc_size[BLOCK_FRAME_COUNT];
+
+	/* allocation profiling: t_push() caller, or NULL if the frame was
+	   pushed while profiling was disabled */
+	const char *profile_file[BLOCK_FRAME_COUNT];
+	unsigned int profile_line[BLOCK_FRAME_COUNT];
+	/* profile_* counters' values when the frame was pushed */
+	size_t profile_start_used[BLOCK_FRAME_COUNT];
+	size_t profile_start_peak[BLOCK_FRAME_COUNT];
+	uint64_t profile_start_alloc[BLOCK_FRAME_COUNT];
+	unsigned int profile_start_grows[BLOCK_FRAME_COUNT];
 };
 
 unsigned int data_stack_frame = 0;
@@ -71,6 +82,13 @@ static bool clean_after_pop = FALSE;
 #endif
 static bool outofmem = FALSE;
 
+/* allocation profiling: bytes currently allocated from data stack, the
+   highest value of it within the current frame, bytes allocated in total and
+   the number of times the data stack has been grown. */
+static size_t profile_used, profile_peak;
+static uint64_t profile_alloc;
+static unsigned int profile_grows;
+
 static union {
 	struct stack_block block;
 	unsigned char data[512];
@@ -109,7 +127,7 @@ static void data_stack_last_buffer_reset(bool preserve_data ATTR_UNUSED)
 	}
 }
 
-unsigned int t_push(void)
+unsigned int t_push_at(const char *file, unsigned int line)
 {
         struct stack_frame_block *frame_block;
 
@@ -120,7 +138,7 @@ unsigned int t_push(void)
 			/* kludgy, but allow this before initialization */
 			frame_pos = 0;
 			data_stack_init();
-			return t_push();
+			return t_push_at(file, line);
 		}
 
 		frame_pos = 0;
@@ -151,6 +169,21 @@ unsigned int t_push(void)
 	current_frame_block->block_space_used[frame_pos] = current_block->left;
         current_frame_block->last_alloc_size[frame_pos] = 0;
 
+	if (unlikely(mem_profile_enabled)) {
+		current_frame_block->profile_file[frame_pos] = file;
+		current_frame_block->profile_line[frame_pos] = line;
+		current_frame_block->profile_start_used[frame_pos] =
+			profile_used;
+		current_frame_block->profile_start_peak[frame_pos] =
+			profile_peak;
+		current_frame_block->profile_start_alloc[frame_pos] =
+			profile_alloc;
+		current_frame_block->profile_start_grows[frame_pos] =
+			profile_grows;
+		profile_peak = profile_used;
+	} else {
+		current_frame_block->profile_file[frame_pos] = NULL;
+	}
         return data_stack_frame++;
 }
 
@@ -217,6 +250,27 @@ static void t_pop_verify(void)
 }
 #endif
 
+static void t_pop_profile(void)
+{
+	size_t start_used =
+		current_frame_block->profile_start_used[frame_pos];
+	size_t start_peak =
+		current_frame_block->profile_start_peak[frame_pos];
+
+	mem_profile_data_stack_frame(
+		current_frame_block->profile_file[frame_pos],
+		current_frame_block->profile_line[frame_pos],
+		profile_alloc -
+		current_frame_block->profile_start_alloc[frame_pos],
+		profile_peak - start_used, profile_grows -
+		current_frame_block->profile_start_grows[frame_pos]);
+
+	/* the parent frame's peak includes this frame's peak */
+	profile_used = start_used;
+	if (profile_peak < start_peak)
+		profile_peak = start_peak;
+}
+
 unsigned int t_pop(void)
 {
 	struct stack_frame_block *frame_block;
@@ -229,6 +283,10 @@ unsigned int t_pop(void)
 	t_pop_verify();
 #endif
 
+	if (unlikely(current_frame_block->profile_file[frame_pos] != NULL) &&
+	    mem_profile_enabled)
+		t_pop_profile();
+
 	/* update the current block */
 	current_block = current_frame_block->block[frame_pos];
 	if (clean_after_pop) {
@@ -335,6 +393,16 @@ static void *t_malloc_real(size_t size, bool permanent)
 	/* used for t_try_realloc() */
 	current_frame_block->last_alloc_size[frame_pos] = alloc_size;
 
+	if (unlikely(mem_profile_enabled)) {
+		/* t_buffer_get() reservations count towards the peak */
+		if (profile_peak < profile_used + alloc_size)
+			profile_peak = profile_used + alloc_size;
+		if (permanent) {
+			profile_used += alloc_size;
+			profile_alloc += alloc_size;
+		}
+	}
+
 	if (current_block->left >= alloc_size) {
 		/* enough space in current block, use it */
 		ret = STACK_BLOCK_DATA(current_block) +
@@ -354,6 +422,7 @@ static void *t_malloc_real(size_t size, bool permanent)
 			unused_block = NULL;
 		} else {
 			block = mem_block_alloc(alloc_size);
+			profile_grows++;
 #ifdef DEBUG
 			warn = TRUE;
 #endif
@@ -422,6 +491,12 @@ bool t_try_realloc(void *mem, size_t size)
 		if (current_block->left >= size - last_alloc_size) {
 			/* just shrink the available size */
 			current_block->left -= size - last_alloc_size;
+			if (unlikely(mem_profile_enabled)) {
+				profile_used += size - last_alloc_size;
+				profile_alloc += size - last_alloc_size;
+				if (profile_peak < profile_used)
+					profile_peak = profile_used;
+			}
 			current_frame_block->last_alloc_size[frame_pos] = size;
 			return TRUE;
 		}
@@ -38,8 +38,12 @@ extern unsigned int data_stack_frame;
    to detect missing t_pop() calls:
 
    x = t_push(); .. if (t_pop() != x) abort();
+
+   The caller's file and line are remembered for allocation profiling
+   (see mem-profile.h).
 */
-unsigned int t_push(void) ATTR_HOT;
+unsigned int t_push_at(const char *file, unsigned int line) ATTR_HOT;
+#define t_push() t_push_at(__FILE__, __LINE__)
 unsigned int t_pop(void) ATTR_HOT;
 /* Simplifies the if (t_pop() != x) check by comparing it internally and
    panicking if it doesn't match. */
@@ -1,6 +1,7 @@
 /* Copyright (c) 2010-2013 Dovecot authors, see the included COPYING file */
 
 #include "lib.h"
+#include "crc32.h"
 #include "md4.h"
 #include "md5.h"
 #include "sha1.h"
@@ -58,6 +59,7 @@ const struct hash_method hash_method_size = {
 };
 
 const struct hash_method *hash_methods[] = {
+	&hash_method_crc32,
 	&hash_method_md4,
 	&hash_method_md5,
 	&hash_method_sha1,
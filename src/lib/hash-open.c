@@ -0,0 +1,322 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+/* @UNSAFE: whole file */
+
+#include "lib.h"
+#include "hash-open.h"
+
+#define HASH_OPEN_MIN_INDEX_BITS 4
+#define HASH_OPEN_MIN_ENTRIES 8
+/* Grow the index when it's more than 7/8 full */
+#define HASH_OPEN_INDEX_MAX_LOAD(size) ((size) - (size) / 8)
+/* Compact the entries array only when at least 1/4 of it is holes. This
+   way a steady flow of inserts and removes costs amortized O(1), since the
+   entries array simply grows until there are enough holes to compact. */
+#define HASH_OPEN_COMPACT_MIN_REMOVED(count) ((count) / 4)
+/* Knuth's multiplicative hashing constant (2^32 / golden ratio). This mixes
+   the high bits of the hash into the index position, so that e.g. aligned
+   pointers don't all end up in the same few slots. */
+#define HASH_OPEN_MULTIPLIER 2654435769U
+
+struct hash_open_index {
+	/* the entry's full hash */
+	unsigned int hash;
+	/* position in entries array + 1, 0 = unused slot */
+	unsigned int entry_idx;
+};
+
+struct hash_open_entry {
+	/* NULL = removed */
+	void *key;
+	void *value;
+};
+
+struct hash_open_table {
+	hash_callback_t *hash_cb;
+	hash_cmp_callback_t *key_compare_cb;
+
+	struct hash_open_index *index;
+	unsigned int index_bits;
+
+	struct hash_open_entry *entries;
+	unsigned int entries_count, entries_alloc;
+	unsigned int removed_count, initial_size;
+};
+
+#define INDEX_SIZE(table) (1U << (table)->index_bits)
+#define INDEX_MASK(table) (INDEX_SIZE(table) - 1)
+
+static inline unsigned int
+hash_open_home(const struct hash_open_table *table, unsigned int hash)
+{
+	return (unsigned int)(hash * HASH_OPEN_MULTIPLIER) >>
+		(32 - table->index_bits);
+}
+
+static inline unsigned int
+hash_open_dist(const struct hash_open_table *table, unsigned int pos,
+	       unsigned int hash)
+{
+	return (pos - hash_open_home(table, hash)) & INDEX_MASK(table);
+}
+
+static unsigned int hash_open_bits_for(unsigned int count)
+{
+	unsigned int bits = HASH_OPEN_MIN_INDEX_BITS;
+
+	while (bits < 31 && HASH_OPEN_INDEX_MAX_LOAD(1U << bits) <= count)
+		bits++;
+	return bits;
+}
+
+struct hash_open_table *
+hash_open_create(unsigned int initial_size, hash_callback_t *hash_cb,
+		 hash_cmp_callback_t *key_compare_cb)
+{
+	struct hash_open_table *table;
+
+	table = i_new(struct hash_open_table, 1);
+	table->hash_cb = hash_cb;
+	table->key_compare_cb = key_compare_cb;
+	table->initial_size = I_MAX(initial_size, HASH_OPEN_MIN_ENTRIES);
+
+	table->index_bits = hash_open_bits_for(table->initial_size);
+	table->index = i_new(struct hash_open_index, INDEX_SIZE(table));
+	table->entries_alloc = table->initial_size;
+	table->entries = i_new(struct hash_open_entry, table->entries_alloc);
+	return table;
+}
+
+void hash_open_destroy(struct hash_open_table **_table)
+{
+	struct hash_open_table *table = *_table;
+
+	*_table = NULL;
+	i_free(table->index);
+	i_free(table->entries);
+	i_free(table);
+}
+
+void hash_open_clear(struct hash_open_table *table)
+{
+	memset(table->index, 0,
+	       sizeof(struct hash_open_index) * INDEX_SIZE(table));
+	table->entries_count = 0;
+	table->removed_count = 0;
+}
+
+static void
+hash_open_index_insert(struct hash_open_table *table,
+		       struct hash_open_index cur)
+{
+	struct hash_open_index *slot, tmp;
+	unsigned int mask = INDEX_MASK(table);
+	unsigned int pos, dist, slot_dist;
+
+	pos = hash_open_home(table, cur.hash);
+	for (dist = 0;; dist++, pos = (pos + 1) & mask) {
+		slot = &table->index[pos];
+		if (slot->entry_idx == 0) {
+			*slot = cur;
+			return;
+		}
+		/* Robin Hood: take the slot from an entry that is closer to
+		   its home position than we are, and continue inserting it */
+		slot_dist = hash_open_dist(table, pos, slot->hash);
+		if (slot_dist < dist) {
+			tmp = *slot;
+			*slot = cur;
+			cur = tmp;
+			dist = slot_dist;
+		}
+	}
+}
+
+static bool
+hash_open_index_find(const struct hash_open_table *table, const void *key,
+		     unsigned int hash, unsigned int *pos_r)
+{
+	const struct hash_open_index *slot;
+	unsigned int mask = INDEX_MASK(table);
+	unsigned int pos, dist;
+
+	pos = hash_open_home(table, hash);
+	for (dist = 0;; dist++, pos = (pos + 1) & mask) {
+		slot = &table->index[pos];
+		if (slot->entry_idx == 0)
+			return FALSE;
+		/* an entry with this hash would have replaced this slot */
+		if (hash_open_dist(table, pos, slot->hash) < dist)
+			return FALSE;
+		if (slot->hash == hash &&
+		    table->key_compare_cb(table->entries[slot->entry_idx-1].key,
+					  key) == 0) {
+			*pos_r = pos;
+			return TRUE;
+		}
+	}
+}
+
+static void
+hash_open_index_delete(struct hash_open_table *table, unsigned int pos)
+{
+	unsigned int mask = INDEX_MASK(table);
+	unsigned int next;
+
+	/* shift the following entries backwards until we find one that is
+	   already in its home position, so no tombstones are needed */
+	for (;;) {
+		next = (pos + 1) & mask;
+		if (table->index[next].entry_idx == 0 ||
+		    hash_open_dist(table, next, table->index[next].hash) == 0)
+			break;
+		table->index[pos] = table->index[next];
+		pos = next;
+	}
+	table->index[pos].entry_idx = 0;
+}
+
+static void
+hash_open_index_resize(struct hash_open_table *table, unsigned int new_bits)
+{
+	struct hash_open_index *old_index = table->index;
+	unsigned int i, old_size = INDEX_SIZE(table);
+
+	table->index_bits = new_bits;
+	table->index = i_new(struct hash_open_index, INDEX_SIZE(table));
+	for (i = 0; i < old_size; i++) {
+		if (old_index[i].entry_idx != 0)
+			hash_open_index_insert(table, old_index[i]);
+	}
+	i_free(old_index);
+}
+
+bool hash_open_lookup(const struct hash_open_table *table, const void *key,
+		      void **orig_key_r, void **value_r)
+{
+	const struct hash_open_entry *entry;
+	unsigned int pos;
+
+	if (!hash_open_index_find(table, key, table->hash_cb(key), &pos))
+		return FALSE;
+
+	entry = &table->entries[table->index[pos].entry_idx - 1];
+	*orig_key_r = entry->key;
+	*value_r = entry->value;
+	return TRUE;
+}
+
+void hash_open_insert(struct hash_open_table *table, void *key, void *value,
+		      bool replace_key)
+{
+	struct hash_open_entry *entry;
+	struct hash_open_index slot;
+	unsigned int pos, hash, live_count;
+
+	i_assert(key != NULL);
+
+	hash = table->hash_cb(key);
+	if (hash_open_index_find(table, key, hash, &pos)) {
+		entry = &table->entries[table->index[pos].entry_idx - 1];
+		if (replace_key)
+			entry->key = key;
+		entry->value = value;
+		return;
+	}
+
+	live_count = table->entries_count - table->removed_count;
+	if (live_count + 1 > HASH_OPEN_INDEX_MAX_LOAD(INDEX_SIZE(table)))
+		hash_open_index_resize(table, table->index_bits + 1);
+
+	if (table->entries_count == table->entries_alloc) {
+		table->entries = i_realloc(table->entries,
+			sizeof(struct hash_open_entry) * table->entries_alloc,
+			sizeof(struct hash_open_entry) * table->entries_alloc * 2);
+		table->entries_alloc *= 2;
+	}
+	entry = &table->entries[table->entries_count++];
+	entry->key = key;
+	entry->value = value;
+
+	slot.hash = hash;
+	slot.entry_idx = table->entries_count;
+	hash_open_index_insert(table, slot);
+}
+
+bool hash_open_remove(struct hash_open_table *table, const void *key)
+{
+	unsigned int pos;
+
+	if (!hash_open_index_find(table, key, table->hash_cb(key), &pos))
+		return FALSE;
+
+	/* the entry itself is left as a hole, so iteration positions stay
+	   valid. hash_open_compact() removes the holes later. */
+	table->entries[table->index[pos].entry_idx - 1].key = NULL;
+	table->removed_count++;
+	hash_open_index_delete(table, pos);
+	return TRUE;
+}
+
+unsigned int hash_open_count(const struct hash_open_table *table)
+{
+	return table->entries_count - table->removed_count;
+}
+
+void hash_open_compact(struct hash_open_table *table)
+{
+	unsigned int *new_idx, i, j, live_count, new_alloc, bits;
+
+	if (table->removed_count == 0 ||
+	    table->removed_count <
+	    HASH_OPEN_COMPACT_MIN_REMOVED(table->entries_count))
+		return;
+
+	/* move the entries over the holes and remember their new positions */
+	new_idx = i_new(unsigned int, table->entries_count);
+	for (i = j = 0; i < table->entries_count; i++) {
+		if (table->entries[i].key == NULL)
+			continue;
+		table->entries[j] = table->entries[i];
+		new_idx[i] = ++j;
+	}
+	for (i = 0; i < INDEX_SIZE(table); i++) {
+		if (table->index[i].entry_idx != 0) {
+			table->index[i].entry_idx =
+				new_idx[table->index[i].entry_idx - 1];
+		}
+	}
+	i_free(new_idx);
+
+	live_count = j;
+	table->entries_count = live_count;
+	table->removed_count = 0;
+
+	/* shrink the arrays if they've become mostly unused */
+	new_alloc = I_MAX(live_count * 2, table->initial_size);
+	if (new_alloc < table->entries_alloc / 2) {
+		table->entries = i_realloc(table->entries,
+			sizeof(struct hash_open_entry) * table->entries_alloc,
+			sizeof(struct hash_open_entry) * new_alloc);
+		table->entries_alloc = new_alloc;
+	}
+	bits = hash_open_bits_for(I_MAX(live_count * 2, table->initial_size));
+	if (bits + 1 < table->index_bits)
+		hash_open_index_resize(table, bits);
+}
+
+bool hash_open_iterate(const struct hash_open_table *table, unsigned int *pos,
+		       void **key_r, void **value_r)
+{
+	const struct hash_open_entry *entry;
+
+	while (*pos < table->entries_count) {
+		entry = &table->entries[(*pos)++];
+		if (entry->key != NULL) {
+			*key_r = entry->key;
+			*value_r = entry->value;
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
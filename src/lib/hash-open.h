@@ -0,0 +1,41 @@
+#ifndef HASH_OPEN_H
+#define HASH_OPEN_H
+
+#include "hash.h"
+
+/* Open addressing hash table used internally by hash.c for tables created
+   with hash_table_create_open(). Use the hash_table_*() API instead of
+   these functions.
+
+   The key/value pairs are stored in a dense array in insertion order, and
+   a separate Robin Hood hashed index contains the entries' hashes and
+   positions in the array. Lookups walk through the small index entries
+   and compare the keys only when the full hash matches. */
+
+struct hash_open_table *
+hash_open_create(unsigned int initial_size, hash_callback_t *hash_cb,
+		 hash_cmp_callback_t *key_compare_cb);
+void hash_open_destroy(struct hash_open_table **table);
+void hash_open_clear(struct hash_open_table *table);
+
+bool hash_open_lookup(const struct hash_open_table *table, const void *key,
+		      void **orig_key_r, void **value_r);
+/* Insert or update the key. If replace_key is TRUE, an existing key is
+   replaced with the given one. */
+void hash_open_insert(struct hash_open_table *table, void *key, void *value,
+		      bool replace_key);
+/* Returns FALSE if key wasn't found. The removed entry's space isn't
+   reused until hash_open_compact() is called. */
+bool hash_open_remove(struct hash_open_table *table, const void *key);
+unsigned int hash_open_count(const struct hash_open_table *table) ATTR_PURE;
+/* Free the space used by removed entries, if there's enough of it. This
+   changes the positions used by hash_open_iterate(). */
+void hash_open_compact(struct hash_open_table *table);
+
+/* Return the next entry at or after *pos and update *pos to point after it.
+   The positions stay valid until hash_open_compact() is called. Returns
+   FALSE when there are no more entries. */
+bool hash_open_iterate(const struct hash_open_table *table, unsigned int *pos,
+		       void **key_r, void **value_r);
+
+#endif
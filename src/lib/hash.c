@@ -4,6 +4,7 @@
 
 #include "lib.h"
 #include "hash.h"
+#include "hash-open.h"
 #include "primes.h"
 
 #include <ctype.h>
@@ -12,6 +13,8 @@
 
 #undef hash_table_create
 #undef hash_table_create_direct
+#undef hash_table_create_open
+#undef hash_table_create_direct_open
 #undef hash_table_destroy
 #undef hash_table_clear
 #undef hash_table_lookup
@@ -44,6 +47,9 @@ struct hash_table {
 
 	hash_callback_t *hash_cb;
 	hash_cmp_callback_t *key_compare_cb;
+
+	/* non-NULL if created with hash_table_create_open() */
+	struct hash_open_table *open;
 };
 
 struct hash_iterate_context {
@@ -92,6 +98,29 @@ void hash_table_create_direct(struct hash_table **table_r, pool_t node_pool,
 			  direct_hash, direct_cmp);
 }
 
+void hash_table_create_open(struct hash_table **table_r, pool_t node_pool,
+			    unsigned int initial_size,
+			    hash_callback_t *hash_cb,
+			    hash_cmp_callback_t *key_compare_cb)
+{
+	struct hash_table *table;
+
+	pool_ref(node_pool);
+	table = i_new(struct hash_table, 1);
+	table->node_pool = node_pool;
+	table->hash_cb = hash_cb;
+	table->key_compare_cb = key_compare_cb;
+	table->open = hash_open_create(initial_size, hash_cb, key_compare_cb);
+	*table_r = table;
+}
+
+void hash_table_create_direct_open(struct hash_table **table_r,
+				   pool_t node_pool, unsigned int initial_size)
+{
+	hash_table_create_open(table_r, node_pool, initial_size,
+			       direct_hash, direct_cmp);
+}
+
 static void free_node(struct hash_table *table, struct hash_node *node)
 {
 	if (!table->node_pool->alloconly_pool)
@@ -129,7 +158,9 @@ void hash_table_destroy(struct hash_table **_table)
 
 	*_table = NULL;
 
-	if (!table->node_pool->alloconly_pool) {
+	if (table->open != NULL)
+		hash_open_destroy(&table->open);
+	else if (!table->node_pool->alloconly_pool) {
 		hash_table_destroy_nodes(table);
 		destroy_node_list(table, table->free_nodes);
 	}
@@ -141,6 +172,11 @@ void hash_table_destroy(struct hash_table **_table)
 
 void hash_table_clear(struct hash_table *table, bool free_nodes)
 {
+	if (table->open != NULL) {
+		hash_open_clear(table->open);
+		return;
+	}
+
 	if (!table->node_pool->alloconly_pool)
 		hash_table_destroy_nodes(table);
 
@@ -178,6 +214,12 @@ hash_table_lookup_node(const struct hash_table *table,
 void *hash_table_lookup(const struct hash_table *table, const void *key)
 {
 	struct hash_node *node;
+	void *orig_key, *value;
+
+	if (table->open != NULL) {
+		return hash_open_lookup(table->open, key, &orig_key, &value) ?
+			value : NULL;
+	}
 
 	node = hash_table_lookup_node(table, key, table->hash_cb(key));
 	return node != NULL ? node->value : NULL;
@@ -189,6 +231,9 @@ bool hash_table_lookup_full(const struct hash_table *table,
 {
 	struct hash_node *node;
 
+	if (table->open != NULL)
+		return hash_open_lookup(table->open, lookup_key, orig_key, value);
+
 	node = hash_table_lookup_node(table, lookup_key,
 				      table->hash_cb(lookup_key));
 	if (node == NULL)
@@ -282,12 +327,22 @@ void hash_table_insert(struct hash_table *table, void *key, void *value)
 {
 	struct hash_node *node;
 
+	if (table->open != NULL) {
+		hash_open_insert(table->open, key, value, TRUE);
+		return;
+	}
+
 	node = hash_table_insert_node(table, key, value, TRUE);
 	node->key = key;
 }
 
 void hash_table_update(struct hash_table *table, void *key, void *value)
 {
+	if (table->open != NULL) {
+		hash_open_insert(table->open, key, value, FALSE);
+		return;
+	}
+
 	hash_table_insert_node(table, key, value, TRUE);
 }
 
@@ -331,6 +386,14 @@ void hash_table_remove(struct hash_table *table, const void *key)
 	struct hash_node *node;
 	unsigned int hash;
 
+	if (table->open != NULL) {
+		if (unlikely(!hash_open_remove(table->open, key)))
+			i_panic("key not found from hash");
+		if (table->frozen == 0)
+			hash_open_compact(table->open);
+		return;
+	}
+
 	hash = table->hash_cb(key);
 
 	node = hash_table_lookup_node(table, key, hash);
@@ -348,6 +411,8 @@ void hash_table_remove(struct hash_table *table, const void *key)
 
 unsigned int hash_table_count(const struct hash_table *table)
 {
+	if (table->open != NULL)
+		return hash_open_count(table->open);
 	return table->nodes_count;
 }
 
@@ -359,7 +424,8 @@ struct hash_iterate_context *hash_table_iterate_init(struct hash_table *table)
 
 	ctx = i_new(struct hash_iterate_context, 1);
 	ctx->table = table;
-	ctx->next = &table->nodes[0];
+	if (table->open == NULL)
+		ctx->next = &table->nodes[0];
 	return ctx;
 }
 
@@ -386,6 +452,15 @@ bool hash_table_iterate(struct hash_iterate_context *ctx,
 {
 	struct hash_node *node;
 
+	if (ctx->table->open != NULL) {
+		if (!hash_open_iterate(ctx->table->open, &ctx->pos,
+				       key_r, value_r)) {
+			*key_r = *value_r = NULL;
+			return FALSE;
+		}
+		return TRUE;
+	}
+
 	node = ctx->next;
 	if (node != NULL && node->key == NULL)
 		node = hash_table_iterate_next(ctx, node);
@@ -421,6 +496,10 @@ void hash_table_thaw(struct hash_table *table)
 	if (--table->frozen > 0)
 		return;
 
+	if (table->open != NULL) {
+		hash_open_compact(table->open);
+		return;
+	}
 	if (table->removed_count > 0) {
 		if (!hash_table_resize(table, FALSE))
 			hash_table_compress_removed(table);
@@ -16,15 +16,17 @@ typedef int hash_cmp_callback_t(const void *p1, const void *p2);
 
 /* Create a new hash table. If initial_size is 0, the default value is used.
    table_pool is used to allocate/free large hash tables, node_pool is used
-   for smaller allocations and can also be alloconly pool. The pools must not
+   for smaller allocations and can also be alloconly pool. A slab pool
+   (pool_slab_create()) is a good choice for node_pool in long running
+   processes where nodes are constantly added and removed. The pools must not
    be free'd before hash_table_destroy() is called. */
 void hash_table_create(struct hash_table **table_r, pool_t node_pool,
 		       unsigned int initial_size,
 		       hash_callback_t *hash_cb,
 		       hash_cmp_callback_t *key_compare_cb);
 #if defined (__GNUC__) && !defined(__cplusplus)
-#  define hash_table_create(table, pool, size, hash_cb, key_cmp_cb) \
-	({(void)COMPILE_ERROR_IF_TRUE( \
+#  define HASH_TABLE_CREATE_TYPECHECK(table, hash_cb, key_cmp_cb) \
+	(void)COMPILE_ERROR_IF_TRUE( \
 		sizeof((*table)._key) != sizeof(void *) || \
 		sizeof((*table)._value) != sizeof(void *)); \
 	(void)COMPILE_ERROR_IF_TRUE( \
@@ -36,7 +38,9 @@ void hash_table_create(struct hash_table **table_r, pool_t node_pool,
 		!__builtin_types_compatible_p(typeof(&hash_cb), \
 			unsigned int (*)(typeof((*table)._key))) && \
 		!__builtin_types_compatible_p(typeof(&hash_cb), \
-			unsigned int (*)(typeof((*table)._const_key)))); \
+			unsigned int (*)(typeof((*table)._const_key))))
+#  define hash_table_create(table, pool, size, hash_cb, key_cmp_cb) \
+	({HASH_TABLE_CREATE_TYPECHECK(table, hash_cb, key_cmp_cb); \
 	hash_table_create(&(*table)._table, pool, size, \
 		(hash_callback_t *)hash_cb, \
 		(hash_cmp_callback_t *)key_cmp_cb);})
@@ -61,6 +65,36 @@ void hash_table_create_direct(struct hash_table **table_r, pool_t node_pool,
 	hash_table_create_direct(&(*table)._table, pool, size)
 #endif
 
+/* Same as hash_table_create*(), but use an open addressing hash table
+   instead of chained nodes. This uses less memory per node and has better
+   cache locality for lookups, especially with large tables. node_pool isn't
+   used for anything. The hash_table_*() API works the same way for both. */
+void hash_table_create_open(struct hash_table **table_r, pool_t node_pool,
+			    unsigned int initial_size,
+			    hash_callback_t *hash_cb,
+			    hash_cmp_callback_t *key_compare_cb);
+void hash_table_create_direct_open(struct hash_table **table_r,
+				   pool_t node_pool, unsigned int initial_size);
+#if defined (__GNUC__) && !defined(__cplusplus)
+#  define hash_table_create_open(table, pool, size, hash_cb, key_cmp_cb) \
+	({HASH_TABLE_CREATE_TYPECHECK(table, hash_cb, key_cmp_cb); \
+	hash_table_create_open(&(*table)._table, pool, size, \
+		(hash_callback_t *)hash_cb, \
+		(hash_cmp_callback_t *)key_cmp_cb);})
+#  define hash_table_create_direct_open(table, pool, size) \
+	({(void)COMPILE_ERROR_IF_TRUE( \
+		sizeof((*table)._key) != sizeof(void *) || \
+		sizeof((*table)._value) != sizeof(void *)); \
+	hash_table_create_direct_open(&(*table)._table, pool, size);})
+#else
+#  define hash_table_create_open(table, pool, size, hash_cb, key_cmp_cb) \
+	hash_table_create_open(&(*table)._table, pool, size, \
+		(hash_callback_t *)hash_cb, \
+		(hash_cmp_callback_t *)key_cmp_cb)
+#  define hash_table_create_direct_open(table, pool, size) \
+	hash_table_create_direct_open(&(*table)._table, pool, size)
+#endif
+
 #define hash_table_is_created(table) \
 	((table)._table != NULL)
 
@@ -11,6 +11,15 @@
 #include <sys/epoll.h>
 #include <unistd.h>
 
+#ifdef IOLOOP_URING
+/* ioloop-uring.c falls back to us */
+#  define io_loop_handle_add io_loop_handle_add_epoll
+#  define io_loop_handle_remove io_loop_handle_remove_epoll
+#  define io_loop_handler_init io_loop_handler_init_epoll
+#  define io_loop_handler_deinit io_loop_handler_deinit_epoll
+#  define io_loop_handler_run io_loop_handler_run_epoll
+#endif
+
 struct ioloop_handler_context {
 	int epfd;
 
@@ -60,6 +69,11 @@ void io_loop_handler_deinit(struct ioloop *ioloop)
 #define IO_EPOLL_ERROR (EPOLLERR | EPOLLHUP)
 #define IO_EPOLL_INPUT (EPOLLIN | EPOLLPRI | IO_EPOLL_ERROR)
 #define IO_EPOLL_OUTPUT	(EPOLLOUT | IO_EPOLL_ERROR)
+#ifdef EPOLLEXCLUSIVE
+#  define IO_EPOLL_EXCLUSIVE EPOLLEXCLUSIVE
+#else
+#  define IO_EPOLL_EXCLUSIVE 0
+#endif
 
 static int epoll_event_mask(struct io_list *list)
 {
@@ -78,23 +92,43 @@ static int epoll_event_mask(struct io_list *list)
 			events |= IO_EPOLL_OUTPUT;
 		if (io->io.condition & IO_ERROR)
 			events |= IO_EPOLL_ERROR;
+		if (io->io.condition & IO_EXCLUSIVE)
+			events |= IO_EPOLL_EXCLUSIVE;
+	}
+	if ((events & IO_EPOLL_EXCLUSIVE) != 0) {
+		/* EPOLLPRI can't be used with EPOLLEXCLUSIVE */
+		events &= ~EPOLLPRI;
 	}
 
 	return events;
 }
 
+static int
+epoll_ctl_mod(struct ioloop_handler_context *ctx, int fd,
+	      struct epoll_event *event, bool old_exclusive)
+{
+	if (!old_exclusive && (event->events & IO_EPOLL_EXCLUSIVE) == 0)
+		return epoll_ctl(ctx->epfd, EPOLL_CTL_MOD, fd, event);
+
+	/* EPOLLEXCLUSIVE can be given only with EPOLL_CTL_ADD */
+	if (epoll_ctl(ctx->epfd, EPOLL_CTL_DEL, fd, event) < 0)
+		return -1;
+	return epoll_ctl(ctx->epfd, EPOLL_CTL_ADD, fd, event);
+}
+
 void io_loop_handle_add(struct io_file *io)
 {
 	struct ioloop_handler_context *ctx = io->io.ioloop->handler_context;
 	struct io_list **list;
 	struct epoll_event event;
-	int op;
-	bool first;
+	int op, ret;
+	bool first, old_exclusive;
 
 	list = array_idx_modifiable(&ctx->fd_index, io->fd);
 	if (*list == NULL)
 		*list = i_new(struct io_list, 1);
 
+	old_exclusive = (epoll_event_mask(*list) & IO_EPOLL_EXCLUSIVE) != 0;
 	first = ioloop_iolist_add(*list, io);
 
 	memset(&event, 0, sizeof(event));
@@ -103,7 +137,11 @@ void io_loop_handle_add(struct io_file *io)
 
 	op = first ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
 
-	if (epoll_ctl(ctx->epfd, op, io->fd, &event) < 0) {
+	if (first)
+		ret = epoll_ctl(ctx->epfd, op, io->fd, &event);
+	else
+		ret = epoll_ctl_mod(ctx, io->fd, &event, old_exclusive);
+	if (ret < 0) {
 		if (errno == EPERM && op == EPOLL_CTL_ADD) {
 			i_fatal("epoll_ctl(add, %d) failed: %m "
 				"(fd doesn't support epoll%s)", io->fd,
@@ -129,10 +167,11 @@ void io_loop_handle_remove(struct io_file *io, bool closed)
 	struct ioloop_handler_context *ctx = io->io.ioloop->handler_context;
 	struct io_list **list;
 	struct epoll_event event;
-	int op;
-	bool last;
+	int op, ret;
+	bool last, old_exclusive;
 
 	list = array_idx_modifiable(&ctx->fd_index, io->fd);
+	old_exclusive = (epoll_event_mask(*list) & IO_EPOLL_EXCLUSIVE) != 0;
 	last = ioloop_iolist_del(*list, io);
 
 	if (!closed) {
@@ -142,7 +181,11 @@ void io_loop_handle_remove(struct io_file *io, bool closed)
 
 		op = last ? EPOLL_CTL_DEL : EPOLL_CTL_MOD;
 
-		if (epoll_ctl(ctx->epfd, op, io->fd, &event) < 0) {
+		if (last)
+			ret = epoll_ctl(ctx->epfd, op, io->fd, &event);
+		else
+			ret = epoll_ctl_mod(ctx, io->fd, &event, old_exclusive);
+		if (ret < 0) {
 			i_error("epoll_ctl(%s, %d) failed: %m",
 				op == EPOLL_CTL_DEL ? "del" : "mod", io->fd);
 		}
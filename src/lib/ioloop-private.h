@@ -2,6 +2,7 @@
 #define IOLOOP_PRIVATE_H
 
 #include "priorityq.h"
+#include "timing-wheel.h"
 #include "ioloop.h"
 
 #ifndef IOLOOP_INITIAL_FD_COUNT
@@ -15,7 +16,10 @@ struct ioloop {
 
 	struct io_file *io_files;
 	struct io_file *next_io_file;
+	/* Timeouts are kept either in a priority queue or, with
+	   IO_LOOP_FLAG_TIMING_WHEEL, in a timing wheel. */
 	struct priorityq *timeouts;
+	struct timing_wheel *timeout_wheel;
 
         struct ioloop_handler_context *handler_context;
         struct ioloop_notify_handler_context *notify_handler_context;
@@ -49,7 +53,11 @@ struct io_file {
 };
 
 struct timeout {
-	struct priorityq_item item;
+	/* must be first */
+	union {
+		struct priorityq_item pq;
+		struct timing_wheel_item wheel;
+	} item;
 	unsigned int source_linenum;
 
         unsigned int msecs;
@@ -85,6 +93,16 @@ void io_loop_handle_remove(struct io_file *io, bool closed);
 void io_loop_handler_init(struct ioloop *ioloop, unsigned int initial_fd_count);
 void io_loop_handler_deinit(struct ioloop *ioloop);
 
+#ifdef IOLOOP_URING
+/* epoll handler is used when the kernel doesn't support io_uring */
+void io_loop_handle_add_epoll(struct io_file *io);
+void io_loop_handle_remove_epoll(struct io_file *io, bool closed);
+void io_loop_handler_init_epoll(struct ioloop *ioloop,
+				unsigned int initial_fd_count);
+void io_loop_handler_deinit_epoll(struct ioloop *ioloop);
+void io_loop_handler_run_epoll(struct ioloop *ioloop);
+#endif
+
 void io_loop_notify_remove(struct io *io);
 void io_loop_notify_handler_deinit(struct ioloop *ioloop);
 
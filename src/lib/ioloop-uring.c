@@ -0,0 +1,574 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "array.h"
+#include "fd-close-on-exec.h"
+#include "ioloop-private.h"
+#include "ioloop-iolist.h"
+
+#ifdef IOLOOP_URING
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/epoll.h>
+#include <signal.h>
+#include <poll.h>
+#include <unistd.h>
+
+/* Readiness is polled with one-shot IORING_OP_POLL_ADD requests. They're
+   re-armed after the callbacks have been called, which gives the same
+   level-triggered behavior as the other handlers. */
+#define URING_ENTRIES 256
+
+/* user_data of POLL_REMOVE requests. Their completions are ignored. */
+#define URING_USER_DATA_REMOVE 0
+#define URING_USER_DATA(fd, seq) (((uint64_t)(fd) << 32) | (seq))
+#define URING_USER_DATA_FD(data) ((int)((data) >> 32))
+#define URING_USER_DATA_SEQ(data) ((uint32_t)(data))
+
+#define IO_URING_ERROR (POLLERR | POLLHUP)
+#define IO_URING_INPUT (POLLIN | POLLPRI | IO_URING_ERROR)
+#define IO_URING_OUTPUT (POLLOUT | IO_URING_ERROR)
+/* POLL_ADD accepts EPOLLEXCLUSIVE since Linux v5.13. Older kernels
+   silently ignore it, so the listeners are just woken up as with poll(). */
+#ifdef EPOLLEXCLUSIVE
+#  define IO_URING_EXCLUSIVE EPOLLEXCLUSIVE
+#else
+#  define IO_URING_EXCLUSIVE 0
+#endif
+
+struct uring_fd {
+	struct io_list list;
+
+	/* events of the currently armed poll request, 0 if none */
+	unsigned int armed_events;
+	/* sequence of the currently armed poll request. Completions with
+	   other sequences are stale. */
+	uint32_t seq;
+};
+
+ARRAY_DEFINE_TYPE(uring_cqe, struct io_uring_cqe);
+
+struct ioloop_handler_context {
+	int ring_fd;
+	/* process that created the ring. A forked child shares the ring's
+	   memory with its parent, so it needs to create its own ring. */
+	pid_t pid;
+
+	void *sq_ring, *cq_ring;
+	size_t sq_ring_size, cq_ring_size;
+	struct io_uring_sqe *sqes;
+	size_t sqes_size;
+
+	unsigned int *sq_head, *sq_tail, *sq_array;
+	unsigned int sq_mask, sq_entries;
+	/* number of SQEs added after the last io_uring_enter() */
+	unsigned int sq_unsubmitted;
+
+	unsigned int *cq_head, *cq_tail;
+	unsigned int cq_mask;
+	struct io_uring_cqe *cqes;
+
+	ARRAY(struct uring_fd *) fd_index;
+	/* completions copied out of the CQ ring */
+	ARRAY_TYPE(uring_cqe) events;
+	/* completions copied out of the CQ ring while adding requests to a
+	   full SQ ring. They're handled by the next io_loop_handler_run(). */
+	ARRAY_TYPE(uring_cqe) pending_events;
+};
+
+enum uring_state {
+	URING_STATE_UNKNOWN = 0,
+	URING_STATE_USED,
+	URING_STATE_UNSUPPORTED
+};
+
+/* The decision is made once per process, since io_file handlers can't tell
+   which ioloop's handler they belong to. */
+static enum uring_state uring_state = URING_STATE_UNKNOWN;
+
+static int uring_setup(struct ioloop_handler_context *ctx)
+{
+	struct io_uring_params params;
+	unsigned char *sq_ring, *cq_ring;
+
+	memset(&params, 0, sizeof(params));
+	ctx->ring_fd = syscall(__NR_io_uring_setup, URING_ENTRIES, &params);
+	if (ctx->ring_fd < 0)
+		return -1;
+	fd_close_on_exec(ctx->ring_fd, TRUE);
+
+	if ((params.features & IORING_FEAT_NODROP) == 0 ||
+	    (params.features & IORING_FEAT_EXT_ARG) == 0) {
+		/* too old kernel - we can't wait with a timeout and we'd
+		   lose completions when the CQ ring overflows */
+		i_close_fd(&ctx->ring_fd);
+		errno = ENOSYS;
+		return -1;
+	}
+
+	ctx->sq_ring_size = params.sq_off.array +
+		params.sq_entries * sizeof(unsigned int);
+	ctx->cq_ring_size = params.cq_off.cqes +
+		params.cq_entries * sizeof(struct io_uring_cqe);
+	if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+		if (ctx->cq_ring_size > ctx->sq_ring_size)
+			ctx->sq_ring_size = ctx->cq_ring_size;
+		ctx->cq_ring_size = ctx->sq_ring_size;
+	}
+
+	ctx->sq_ring = mmap(NULL, ctx->sq_ring_size, PROT_READ | PROT_WRITE,
+			    MAP_SHARED | MAP_POPULATE, ctx->ring_fd,
+			    IORING_OFF_SQ_RING);
+	if (ctx->sq_ring == MAP_FAILED) {
+		i_error("mmap(io_uring sq ring) failed: %m");
+		i_close_fd(&ctx->ring_fd);
+		return -1;
+	}
+	if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+		ctx->cq_ring = ctx->sq_ring;
+	else {
+		ctx->cq_ring = mmap(NULL, ctx->cq_ring_size,
+				    PROT_READ | PROT_WRITE,
+				    MAP_SHARED | MAP_POPULATE, ctx->ring_fd,
+				    IORING_OFF_CQ_RING);
+		if (ctx->cq_ring == MAP_FAILED) {
+			i_error("mmap(io_uring cq ring) failed: %m");
+			(void)munmap(ctx->sq_ring, ctx->sq_ring_size);
+			i_close_fd(&ctx->ring_fd);
+			return -1;
+		}
+	}
+	ctx->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+	ctx->sqes = mmap(NULL, ctx->sqes_size, PROT_READ | PROT_WRITE,
+			 MAP_SHARED | MAP_POPULATE, ctx->ring_fd,
+			 IORING_OFF_SQES);
+	if (ctx->sqes == MAP_FAILED) {
+		i_error("mmap(io_uring sqes) failed: %m");
+		if (ctx->cq_ring != ctx->sq_ring)
+			(void)munmap(ctx->cq_ring, ctx->cq_ring_size);
+		(void)munmap(ctx->sq_ring, ctx->sq_ring_size);
+		i_close_fd(&ctx->ring_fd);
+		return -1;
+	}
+
+	sq_ring = ctx->sq_ring;
+	ctx->sq_head = (void *)(sq_ring + params.sq_off.head);
+	ctx->sq_tail = (void *)(sq_ring + params.sq_off.tail);
+	ctx->sq_mask = *(unsigned int *)(sq_ring + params.sq_off.ring_mask);
+	ctx->sq_entries = params.sq_entries;
+	ctx->sq_array = (void *)(sq_ring + params.sq_off.array);
+
+	cq_ring = ctx->cq_ring;
+	ctx->cq_head = (void *)(cq_ring + params.cq_off.head);
+	ctx->cq_tail = (void *)(cq_ring + params.cq_off.tail);
+	ctx->cq_mask = *(unsigned int *)(cq_ring + params.cq_off.ring_mask);
+	ctx->cqes = (void *)(cq_ring + params.cq_off.cqes);
+	ctx->sq_unsubmitted = 0;
+	ctx->pid = getpid();
+	return 0;
+}
+
+static void uring_unmap(struct ioloop_handler_context *ctx)
+{
+	(void)munmap(ctx->sqes, ctx->sqes_size);
+	if (ctx->cq_ring != ctx->sq_ring)
+		(void)munmap(ctx->cq_ring, ctx->cq_ring_size);
+	(void)munmap(ctx->sq_ring, ctx->sq_ring_size);
+	if (close(ctx->ring_fd) < 0)
+		i_error("close(io_uring) failed: %m");
+}
+
+static int
+uring_enter(struct ioloop_handler_context *ctx, int msecs)
+{
+	struct io_uring_getevents_arg arg;
+	struct __kernel_timespec ts;
+	unsigned int to_submit = ctx->sq_unsubmitted;
+	unsigned int flags = 0, min_complete = 0;
+	int ret;
+
+	memset(&arg, 0, sizeof(arg));
+	if (msecs != 0) {
+		flags |= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+		min_complete = 1;
+		arg.sigmask_sz = _NSIG / 8;
+		if (msecs > 0) {
+			ts.tv_sec = msecs / 1000;
+			ts.tv_nsec = (msecs % 1000) * 1000000LL;
+			arg.ts = (uintptr_t)&ts;
+		}
+	}
+	ret = syscall(__NR_io_uring_enter, ctx->ring_fd, to_submit,
+		      min_complete, flags,
+		      (flags & IORING_ENTER_EXT_ARG) == 0 ? NULL : &arg,
+		      sizeof(arg));
+	if (ret > 0) {
+		i_assert((unsigned int)ret <= ctx->sq_unsubmitted);
+		ctx->sq_unsubmitted -= ret;
+	}
+	return ret;
+}
+
+static struct uring_fd *
+uring_event_get_fd(struct ioloop_handler_context *ctx,
+		   const struct io_uring_cqe *cqe)
+{
+	struct uring_fd *const *ufdp;
+	int fd = URING_USER_DATA_FD(cqe->user_data);
+
+	if (cqe->user_data == URING_USER_DATA_REMOVE ||
+	    (unsigned int)fd >= array_count(&ctx->fd_index))
+		return NULL;
+	ufdp = array_idx(&ctx->fd_index, fd);
+	if (*ufdp == NULL || (*ufdp)->seq != URING_USER_DATA_SEQ(cqe->user_data))
+		return NULL;
+	return *ufdp;
+}
+
+static void
+uring_reap_events(struct ioloop_handler_context *ctx,
+		  ARRAY_TYPE(uring_cqe) *events)
+{
+	const struct io_uring_cqe *cqe;
+	struct uring_fd *ufd;
+	unsigned int head, tail;
+
+	head = *ctx->cq_head;
+	tail = __atomic_load_n(ctx->cq_tail, __ATOMIC_ACQUIRE);
+	for (; head != tail; head++) {
+		cqe = &ctx->cqes[head & ctx->cq_mask];
+		ufd = uring_event_get_fd(ctx, cqe);
+		if (ufd == NULL)
+			continue;
+		/* the one-shot poll request is finished */
+		ufd->armed_events = 0;
+		array_append(events, cqe, 1);
+	}
+	__atomic_store_n(ctx->cq_head, head, __ATOMIC_RELEASE);
+}
+
+static struct io_uring_sqe *uring_get_sqe(struct ioloop_handler_context *ctx)
+{
+	struct io_uring_sqe *sqe;
+	unsigned int head, tail, idx;
+
+	tail = *ctx->sq_tail;
+	head = __atomic_load_n(ctx->sq_head, __ATOMIC_ACQUIRE);
+	while (tail - head >= ctx->sq_entries) {
+		/* SQ ring is full, submit what we have. The kernel refuses
+		   to take more requests while the completions don't fit to
+		   the CQ ring, so move them out of the way first. */
+		uring_reap_events(ctx, &ctx->pending_events);
+		if (uring_enter(ctx, 0) < 0 && errno != EINTR &&
+		    errno != EBUSY && errno != EAGAIN)
+			i_fatal("io_uring_enter() failed: %m");
+		head = __atomic_load_n(ctx->sq_head, __ATOMIC_ACQUIRE);
+	}
+	idx = tail & ctx->sq_mask;
+	sqe = &ctx->sqes[idx];
+	memset(sqe, 0, sizeof(*sqe));
+	ctx->sq_array[idx] = idx;
+	return sqe;
+}
+
+static void
+uring_sqe_commit(struct ioloop_handler_context *ctx)
+{
+	/* the SQE must be fully written before the kernel sees the tail */
+	__atomic_store_n(ctx->sq_tail, *ctx->sq_tail + 1, __ATOMIC_RELEASE);
+	ctx->sq_unsubmitted++;
+}
+
+static unsigned int uring_event_mask(const struct io_list *list)
+{
+	unsigned int events = 0;
+	struct io_file *io;
+	int i;
+
+	for (i = 0; i < IOLOOP_IOLIST_IOS_PER_FD; i++) {
+		io = list->ios[i];
+		if (io == NULL)
+			continue;
+
+		if (io->io.condition & IO_READ)
+			events |= IO_URING_INPUT;
+		if (io->io.condition & IO_WRITE)
+			events |= IO_URING_OUTPUT;
+		if (io->io.condition & IO_ERROR)
+			events |= IO_URING_ERROR;
+		if (io->io.condition & IO_EXCLUSIVE)
+			events |= IO_URING_EXCLUSIVE;
+	}
+	if ((events & IO_URING_EXCLUSIVE) != 0) {
+		/* like with epoll, POLLPRI isn't used with exclusive waits */
+		events &= ~POLLPRI;
+	}
+	return events;
+}
+
+static void
+uring_poll_add(struct ioloop_handler_context *ctx, int fd,
+	       struct uring_fd *ufd, unsigned int events)
+{
+	struct io_uring_sqe *sqe;
+	uint32_t poll_events = events;
+
+	if (++ufd->seq == URING_USER_DATA_REMOVE)
+		ufd->seq++;
+
+	sqe = uring_get_sqe(ctx);
+	sqe->opcode = IORING_OP_POLL_ADD;
+	sqe->fd = fd;
+#ifdef WORDS_BIGENDIAN
+	/* the kernel expects the halves to be swapped */
+	poll_events = (poll_events << 16) | (poll_events >> 16);
+#endif
+	sqe->poll32_events = poll_events;
+	sqe->user_data = URING_USER_DATA(fd, ufd->seq);
+	uring_sqe_commit(ctx);
+	ufd->armed_events = events;
+}
+
+static void
+uring_poll_remove(struct ioloop_handler_context *ctx, int fd,
+		  struct uring_fd *ufd)
+{
+	struct io_uring_sqe *sqe;
+
+	sqe = uring_get_sqe(ctx);
+	sqe->opcode = IORING_OP_POLL_REMOVE;
+	sqe->fd = -1;
+	sqe->addr = URING_USER_DATA(fd, ufd->seq);
+	sqe->user_data = URING_USER_DATA_REMOVE;
+	uring_sqe_commit(ctx);
+
+	/* a completion may already be waiting in the CQ ring - make sure
+	   it's seen as stale */
+	if (++ufd->seq == URING_USER_DATA_REMOVE)
+		ufd->seq++;
+	ufd->armed_events = 0;
+}
+
+static void
+uring_fd_update(struct ioloop_handler_context *ctx, int fd,
+		struct uring_fd *ufd)
+{
+	unsigned int events = uring_event_mask(&ufd->list);
+
+	if (events == ufd->armed_events)
+		return;
+
+	if (ufd->armed_events != 0)
+		uring_poll_remove(ctx, fd, ufd);
+	if (events != 0)
+		uring_poll_add(ctx, fd, ufd, events);
+}
+
+static void uring_recreate_after_fork(struct ioloop_handler_context *ctx)
+{
+	struct uring_fd **fds;
+	unsigned int i, count;
+
+	/* leave the inherited ring to the parent process and re-add our
+	   poll requests to a new one */
+	uring_unmap(ctx);
+	if (uring_setup(ctx) < 0)
+		i_fatal("io_uring_setup() failed: %m");
+	array_clear(&ctx->pending_events);
+
+	fds = array_get_modifiable(&ctx->fd_index, &count);
+	for (i = 0; i < count; i++) {
+		if (fds[i] != NULL) {
+			fds[i]->armed_events = 0;
+			uring_fd_update(ctx, i, fds[i]);
+		}
+	}
+}
+
+static inline void uring_check_fork(struct ioloop_handler_context *ctx)
+{
+	if (unlikely(ctx->pid != getpid()))
+		uring_recreate_after_fork(ctx);
+}
+
+void io_loop_handler_init(struct ioloop *ioloop, unsigned int initial_fd_count)
+{
+	struct ioloop_handler_context *ctx;
+
+	if (uring_state == URING_STATE_UNSUPPORTED) {
+		io_loop_handler_init_epoll(ioloop, initial_fd_count);
+		return;
+	}
+
+	ctx = i_new(struct ioloop_handler_context, 1);
+	if (uring_setup(ctx) < 0) {
+		if (uring_state == URING_STATE_USED) {
+			/* we already have ioloops using io_uring */
+			i_fatal("io_uring_setup() failed: %m");
+		}
+		if (errno != ENOSYS && errno != EPERM) {
+			i_warning("io_uring_setup() failed: %m - "
+				  "falling back to epoll");
+		}
+		i_free(ctx);
+		uring_state = URING_STATE_UNSUPPORTED;
+		io_loop_handler_init_epoll(ioloop, initial_fd_count);
+		return;
+	}
+	uring_state = URING_STATE_USED;
+
+	i_array_init(&ctx->events, initial_fd_count);
+	i_array_init(&ctx->pending_events, 16);
+	i_array_init(&ctx->fd_index, initial_fd_count);
+	ioloop->handler_context = ctx;
+}
+
+void io_loop_handler_deinit(struct ioloop *ioloop)
+{
+	struct ioloop_handler_context *ctx = ioloop->handler_context;
+	struct uring_fd **fds;
+	unsigned int i, count;
+
+	if (uring_state == URING_STATE_UNSUPPORTED) {
+		io_loop_handler_deinit_epoll(ioloop);
+		return;
+	}
+
+	fds = array_get_modifiable(&ctx->fd_index, &count);
+	for (i = 0; i < count; i++)
+		i_free(fds[i]);
+
+	uring_unmap(ctx);
+	array_free(&ctx->fd_index);
+	array_free(&ctx->events);
+	array_free(&ctx->pending_events);
+	i_free(ioloop->handler_context);
+}
+
+void io_loop_handle_add(struct io_file *io)
+{
+	struct ioloop_handler_context *ctx;
+	struct uring_fd **ufdp;
+
+	if (uring_state == URING_STATE_UNSUPPORTED) {
+		io_loop_handle_add_epoll(io);
+		return;
+	}
+	ctx = io->io.ioloop->handler_context;
+	uring_check_fork(ctx);
+
+	ufdp = array_idx_modifiable(&ctx->fd_index, io->fd);
+	if (*ufdp == NULL)
+		*ufdp = i_new(struct uring_fd, 1);
+	(void)ioloop_iolist_add(&(*ufdp)->list, io);
+	uring_fd_update(ctx, io->fd, *ufdp);
+}
+
+void io_loop_handle_remove(struct io_file *io, bool closed)
+{
+	struct ioloop_handler_context *ctx;
+	struct uring_fd **ufdp;
+
+	if (uring_state == URING_STATE_UNSUPPORTED) {
+		io_loop_handle_remove_epoll(io, closed);
+		return;
+	}
+	ctx = io->io.ioloop->handler_context;
+	uring_check_fork(ctx);
+
+	/* the poll request must be removed even if the fd was already
+	   closed, since the request keeps a reference to the file */
+	ufdp = array_idx_modifiable(&ctx->fd_index, io->fd);
+	(void)ioloop_iolist_del(&(*ufdp)->list, io);
+	uring_fd_update(ctx, io->fd, *ufdp);
+	i_free(io);
+}
+
+void io_loop_handler_run(struct ioloop *ioloop)
+{
+	struct ioloop_handler_context *ctx = ioloop->handler_context;
+	const struct io_uring_cqe *cqe;
+	struct uring_fd *ufd;
+	struct io_file *io;
+	struct timeval tv;
+	unsigned int i, count;
+	int msecs, ret, j, revents;
+	bool call;
+
+	if (uring_state == URING_STATE_UNSUPPORTED) {
+		io_loop_handler_run_epoll(ioloop);
+		return;
+	}
+
+	uring_check_fork(ctx);
+
+        /* get the time left for next timeout task */
+	msecs = io_loop_get_wait_time(ioloop, &tv);
+	if (array_count(&ctx->pending_events) > 0) {
+		/* don't wait, we already have completions to handle */
+		msecs = 0;
+	}
+
+	ret = uring_enter(ctx, msecs);
+	if (ret < 0 && errno != EINTR && errno != ETIME &&
+	    errno != EBUSY && errno != EAGAIN)
+		i_fatal("io_uring_enter(): %m");
+
+	/* copy the completions out of the ring, so the callbacks can add
+	   new requests */
+	array_clear(&ctx->events);
+	array_append_array(&ctx->events, &ctx->pending_events);
+	array_clear(&ctx->pending_events);
+	uring_reap_events(ctx, &ctx->events);
+
+	/* execute timeout handlers */
+        io_loop_handle_timeouts(ioloop);
+
+	count = array_count(&ctx->events);
+	for (i = 0; i < count && ioloop->running; i++) {
+		/* io_loop_handle_add() may cause fd_index reallocation, so
+		   look up the fd again each time */
+		cqe = array_idx(&ctx->events, i);
+		ufd = uring_event_get_fd(ctx, cqe);
+		if (ufd == NULL) {
+			/* fd was re-armed by a previous callback */
+			continue;
+		}
+
+		revents = cqe->res < 0 ? IO_URING_ERROR : cqe->res;
+		for (j = 0; j < IOLOOP_IOLIST_IOS_PER_FD; j++) {
+			io = ufd->list.ios[j];
+			if (io == NULL)
+				continue;
+
+			call = FALSE;
+			if ((revents & (POLLHUP | POLLERR)) != 0)
+				call = TRUE;
+			else if ((io->io.condition & IO_READ) != 0)
+				call = (revents & (POLLIN | POLLPRI)) != 0;
+			else if ((io->io.condition & IO_WRITE) != 0)
+				call = (revents & POLLOUT) != 0;
+			else if ((io->io.condition & IO_ERROR) != 0)
+				call = (revents & IO_URING_ERROR) != 0;
+
+			if (call)
+				io_loop_call_io(&io->io);
+		}
+	}
+
+	/* re-arm the fds whose poll requests finished. if the ioloop was
+	   stopped, this also re-arms the ones whose callbacks weren't called
+	   yet. */
+	for (i = 0; i < count; i++) {
+		cqe = array_idx(&ctx->events, i);
+		ufd = uring_event_get_fd(ctx, cqe);
+		if (ufd != NULL && ufd->armed_events == 0) {
+			uring_fd_update(ctx,
+				URING_USER_DATA_FD(cqe->user_data), ufd);
+		}
+	}
+}
+
+#endif	/* IOLOOP_URING */
@@ -117,6 +117,33 @@ void io_remove_closed(struct io **io)
 	io_remove_full(io, TRUE);
 }
 
+static uint64_t timeval_to_wheel_msecs(const struct timeval *tv)
+{
+	return (uint64_t)tv->tv_sec * 1000 + tv->tv_usec / 1000;
+}
+
+static void timeout_queue_add(struct timeout *timeout)
+{
+	struct ioloop *ioloop = timeout->ioloop;
+
+	if (ioloop->timeout_wheel != NULL) {
+		timing_wheel_add(ioloop->timeout_wheel, &timeout->item.wheel,
+				 timeval_to_wheel_msecs(&timeout->next_run));
+	} else {
+		priorityq_add(ioloop->timeouts, &timeout->item.pq);
+	}
+}
+
+static void timeout_queue_remove(struct timeout *timeout)
+{
+	struct ioloop *ioloop = timeout->ioloop;
+
+	if (ioloop->timeout_wheel != NULL)
+		timing_wheel_remove(ioloop->timeout_wheel, &timeout->item.wheel);
+	else
+		priorityq_remove(ioloop->timeouts, &timeout->item.pq);
+}
+
 static void timeout_update_next(struct timeout *timeout, struct timeval *tv_now)
 {
 	if (tv_now == NULL) {
@@ -161,7 +188,7 @@ struct timeout *timeout_add(unsigned int msecs, unsigned int source_linenum,
 
 	timeout_update_next(timeout, timeout->ioloop->running ?
 			    NULL : &ioloop_timeval);
-	priorityq_add(timeout->ioloop->timeouts, &timeout->item);
+	timeout_queue_add(timeout);
 	return timeout;
 }
 
@@ -185,7 +212,7 @@ void timeout_remove(struct timeout **_timeout)
 	struct timeout *timeout = *_timeout;
 
 	*_timeout = NULL;
-	priorityq_remove(timeout->ioloop->timeouts, &timeout->item);
+	timeout_queue_remove(timeout);
 	timeout_free(timeout);
 }
 
@@ -208,8 +235,8 @@ timeout_reset_timeval(struct timeout *timeout, struct timeval *tv_now)
 		 timeout->next_run.tv_sec > tv_now->tv_sec ||
 		 (timeout->next_run.tv_sec == tv_now->tv_sec &&
 		  timeout->next_run.tv_usec > tv_now->tv_usec));
-	priorityq_remove(timeout->ioloop->timeouts, &timeout->item);
-	priorityq_add(timeout->ioloop->timeouts, &timeout->item);
+	timeout_queue_remove(timeout);
+	timeout_queue_add(timeout);
 }
 
 void timeout_reset(struct timeout *timeout)
@@ -253,15 +280,49 @@ static int timeout_get_wait_time(struct timeout *timeout, struct timeval *tv_r,
 	return ret;
 }
 
+static int
+io_loop_wheel_get_wait_time(struct ioloop *ioloop, uint64_t next_msecs,
+			    struct timeval *tv_r)
+{
+	struct timeval tv_now;
+	uint64_t now_msecs;
+	int msecs;
+
+	if (gettimeofday(&tv_now, NULL) < 0)
+		i_fatal("gettimeofday(): %m");
+	now_msecs = timeval_to_wheel_msecs(&tv_now);
+
+	if (next_msecs <= now_msecs)
+		msecs = 0;
+	else if (next_msecs - now_msecs > (INT_MAX/1000-1) * 1000ULL)
+		msecs = (INT_MAX/1000-1) * 1000;
+	else
+		msecs = next_msecs - now_msecs;
+	tv_r->tv_sec = msecs / 1000;
+	tv_r->tv_usec = (msecs % 1000) * 1000;
+	ioloop->next_max_time = (tv_now.tv_sec + msecs/1000) + 1;
+	return msecs;
+}
+
 int io_loop_get_wait_time(struct ioloop *ioloop, struct timeval *tv_r)
 {
 	struct timeval tv_now;
 	struct priorityq_item *item;
 	struct timeout *timeout;
+	uint64_t next_msecs;
 	int msecs;
 
-	item = priorityq_peek(ioloop->timeouts);
-	timeout = (struct timeout *)item;
+	if (ioloop->timeout_wheel != NULL) {
+		if (timing_wheel_get_next_expire(ioloop->timeout_wheel,
+						 &next_msecs)) {
+			return io_loop_wheel_get_wait_time(ioloop, next_msecs,
+							   tv_r);
+		}
+		timeout = NULL;
+	} else {
+		item = priorityq_peek(ioloop->timeouts);
+		timeout = (struct timeout *)item;
+	}
 	if (timeout == NULL) {
 		/* no timeouts. use INT_MAX msecs for timeval and
 		   return -1 for poll/epoll infinity. */
@@ -292,11 +353,42 @@ static void io_loop_default_time_moved(time_t old_time, time_t new_time)
 	}
 }
 
+static void
+io_loop_wheel_timeouts_update(struct ioloop *ioloop, long diff_secs)
+{
+	struct timing_wheel_item *item;
+	struct timeout *to, *list = NULL;
+	struct timeval tv_now;
+
+	/* the wheel's slots depend on the absolute times, so the timeouts
+	   need to be re-added. */
+	while ((item = timing_wheel_pop_any(ioloop->timeout_wheel)) != NULL) {
+		to = (struct timeout *)item;
+		to->next_run.tv_sec += diff_secs;
+		to->item.wheel.next = (struct timing_wheel_item *)list;
+		list = to;
+	}
+	if (gettimeofday(&tv_now, NULL) < 0)
+		i_fatal("gettimeofday(): %m");
+	timing_wheel_set_time(ioloop->timeout_wheel,
+			      timeval_to_wheel_msecs(&tv_now));
+	while (list != NULL) {
+		to = list;
+		list = (struct timeout *)to->item.wheel.next;
+		timeout_queue_add(to);
+	}
+}
+
 static void io_loop_timeouts_update(struct ioloop *ioloop, long diff_secs)
 {
 	struct priorityq_item *const *items;
 	unsigned int i, count;
 
+	if (ioloop->timeout_wheel != NULL) {
+		io_loop_wheel_timeouts_update(ioloop, diff_secs);
+		return;
+	}
+
 	count = priorityq_count(ioloop->timeouts);
 	items = priorityq_items(ioloop->timeouts);
 	for (i = 0; i < count; i++) {
@@ -314,11 +406,33 @@ static void io_loops_timeouts_update(long diff_secs)
 		io_loop_timeouts_update(ioloop, diff_secs);
 }
 
+static void
+io_loop_call_timeout(struct ioloop *ioloop, struct timeout *timeout,
+		     struct timeval *tv_call)
+{
+	unsigned int t_id;
+
+	/* update timeout's next_run and reposition it in the queue */
+	timeout_reset_timeval(timeout, tv_call);
+
+	if (timeout->ctx != NULL)
+		io_loop_context_activate(timeout->ctx);
+	t_id = t_push();
+	timeout->callback(timeout->context);
+	if (t_pop() != t_id) {
+		i_panic("Leaked a t_pop() call in timeout handler %p",
+			(void *)timeout->callback);
+	}
+	if (ioloop->cur_ctx != NULL)
+		io_loop_context_deactivate(ioloop->cur_ctx);
+}
+
 static void io_loop_handle_timeouts_real(struct ioloop *ioloop)
 {
 	struct priorityq_item *item;
+	struct timing_wheel_item *wheel_item;
 	struct timeval tv, tv_call;
-	unsigned int t_id;
+	uint64_t now_msecs;
 
 	if (gettimeofday(&ioloop_timeval, NULL) < 0)
 		i_fatal("gettimeofday(): %m");
@@ -345,6 +459,23 @@ static void io_loop_handle_timeouts_real(struct ioloop *ioloop)
 	ioloop_time = ioloop_timeval.tv_sec;
 	tv_call = ioloop_timeval;
 
+	if (ioloop->timeout_wheel != NULL) {
+		/* the reset timeouts are always placed after tv_call, so
+		   they won't be returned again by this loop. */
+		now_msecs = timeval_to_wheel_msecs(&tv_call);
+		while ((wheel_item = timing_wheel_pop_expired(
+				ioloop->timeout_wheel, now_msecs)) != NULL) {
+			struct timeout *timeout = (struct timeout *)wheel_item;
+
+			/* it was removed by timing_wheel_pop_expired(), but
+			   timeout_reset_timeval() expects it to exist. */
+			timing_wheel_add(ioloop->timeout_wheel, wheel_item,
+					 wheel_item->expire_msecs);
+			io_loop_call_timeout(ioloop, timeout, &tv_call);
+		}
+		return;
+	}
+
 	while ((item = priorityq_peek(ioloop->timeouts)) != NULL) {
 		struct timeout *timeout = (struct timeout *)item;
 
@@ -352,20 +483,7 @@ static void io_loop_handle_timeouts_real(struct ioloop *ioloop)
 		   case callbacks update ioloop_timeval. */
 		if (timeout_get_wait_time(timeout, &tv, &tv_call) > 0)
 			break;
-
-		/* update timeout's next_run and reposition it in the queue */
-		timeout_reset_timeval(timeout, &tv_call);
-
-		if (timeout->ctx != NULL)
-			io_loop_context_activate(timeout->ctx);
-                t_id = t_push();
-		timeout->callback(timeout->context);
-		if (t_pop() != t_id) {
-			i_panic("Leaked a t_pop() call in timeout handler %p",
-				(void *)timeout->callback);
-		}
-		if (ioloop->cur_ctx != NULL)
-			io_loop_context_deactivate(ioloop->cur_ctx);
+		io_loop_call_timeout(ioloop, timeout, &tv_call);
 	}
 }
 
@@ -434,6 +552,11 @@ void io_loop_time_refresh(void)
 }
 
 struct ioloop *io_loop_create(void)
+{
+	return io_loop_create_flags(0);
+}
+
+struct ioloop *io_loop_create_flags(enum io_loop_flags flags)
 {
 	struct ioloop *ioloop;
 
@@ -443,7 +566,12 @@ struct ioloop *io_loop_create(void)
 	ioloop_time = ioloop_timeval.tv_sec;
 
         ioloop = i_new(struct ioloop, 1);
-	ioloop->timeouts = priorityq_init(timeout_cmp, 32);
+	if ((flags & IO_LOOP_FLAG_TIMING_WHEEL) != 0) {
+		ioloop->timeout_wheel =
+			timing_wheel_init(timeval_to_wheel_msecs(&ioloop_timeval));
+	} else {
+		ioloop->timeouts = priorityq_init(timeout_cmp, 32);
+	}
 
 	ioloop->time_moved_callback = current_ioloop != NULL ?
 		current_ioloop->time_moved_callback :
@@ -458,7 +586,7 @@ struct ioloop *io_loop_create(void)
 void io_loop_destroy(struct ioloop **_ioloop)
 {
 	struct ioloop *ioloop = *_ioloop;
-	struct priorityq_item *item;
+	struct timeout *to;
 
 	*_ioloop = NULL;
 
@@ -475,14 +603,24 @@ void io_loop_destroy(struct ioloop **_ioloop)
 		io_remove(&_io);
 	}
 
-	while ((item = priorityq_pop(ioloop->timeouts)) != NULL) {
-		struct timeout *to = (struct timeout *)item;
+	for (;;) {
+		if (ioloop->timeout_wheel != NULL) {
+			to = (struct timeout *)
+				timing_wheel_pop_any(ioloop->timeout_wheel);
+		} else {
+			to = (struct timeout *)priorityq_pop(ioloop->timeouts);
+		}
+		if (to == NULL)
+			break;
 
 		i_warning("Timeout leak: %p (line %u)", (void *)to->callback,
 			  to->source_linenum);
 		timeout_free(to);
 	}
-	priorityq_deinit(&ioloop->timeouts);
+	if (ioloop->timeout_wheel != NULL)
+		timing_wheel_deinit(&ioloop->timeout_wheel);
+	else
+		priorityq_deinit(&ioloop->timeouts);
 
 	if (ioloop->handler_context != NULL)
 		io_loop_handler_deinit(ioloop);
@@ -14,6 +14,11 @@ enum io_condition {
 	/* IO_ERROR can be used to check when writable pipe's reader side
 	   closes the pipe. For other uses IO_READ should work just as well. */
 	IO_ERROR	= 0x04,
+	/* The fd is shared with other processes (e.g. a listener socket),
+	   and only one of them needs to be woken up when it becomes readable.
+	   This avoids the thundering herd problem with epoll and io_uring.
+	   Other backends ignore this flag. */
+	IO_EXCLUSIVE	= 0x10,
 	
 	/* internal */
 	IO_NOTIFY	= 0x08
@@ -29,6 +34,15 @@ enum io_notify_result {
 	IO_NOTIFY_NOSUPPORT
 };
 
+enum io_loop_flags {
+	/* Keep timeouts in a hierarchical timing wheel instead of a priority
+	   queue. Adding, resetting and removing timeouts is O(1), which
+	   helps processes that have thousands of timeouts being reset
+	   constantly. Timeouts expiring within the same millisecond may be
+	   called in any order. */
+	IO_LOOP_FLAG_TIMING_WHEEL	= 0x01
+};
+
 typedef void io_callback_t(void *context);
 typedef void timeout_callback_t(void *context);
 typedef void io_loop_time_moved_callback_t(time_t old_time, time_t new_time);
@@ -101,6 +115,7 @@ void io_loop_set_running(struct ioloop *ioloop);
 void io_loop_handler_run(struct ioloop *ioloop);
 
 struct ioloop *io_loop_create(void);
+struct ioloop *io_loop_create_flags(enum io_loop_flags flags);
 /* Specify the maximum number of fds we're expecting to use. */
 void io_loop_set_max_fd_count(struct ioloop *ioloop, unsigned int max_fds);
 /* Destroy I/O loop and set ioloop pointer to NULL. */
@@ -0,0 +1,12 @@
+#ifndef ISTREAM_HASH_H
+#define ISTREAM_HASH_H
+
+/* hash_context must be allocated and initialized by caller. This istream will
+   simply call method->loop() for all the data going through the istream.
+   The data is hashed directly from the parent stream's buffer. The stream
+   isn't seekable, so each byte is hashed exactly once. */
+struct istream *
+i_stream_create_hash(struct istream *input, const struct hash_method *method,
+		     void *hash_context);
+
+#endif
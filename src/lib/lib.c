@@ -5,6 +5,7 @@
 #include "env-util.h"
 #include "hostpid.h"
 #include "ipwd.h"
+#include "mem-profile.h"
 #include "process-title.h"
 
 #include <stdlib.h>
@@ -62,6 +63,7 @@ void lib_init(void)
 		i_fatal("gettimeofday(): %m");
 	srand((unsigned int) (tv.tv_sec ^ tv.tv_usec ^ getpid()));
 
+	mem_profile_init();
 	data_stack_init();
 	hostpid_init();
 }
@@ -82,4 +84,5 @@ void lib_deinit(void)
 	env_deinit();
 	failures_deinit();
 	process_title_deinit();
+	mem_profile_deinit();
 }
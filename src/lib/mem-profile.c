@@ -0,0 +1,318 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "hash.h"
+#include "str.h"
+#include "safe-mkstemp.h"
+#include "write-full.h"
+#include "mem-profile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define MEM_PROFILE_INITIAL_TABLE_SIZE 256
+
+enum mem_profile_site_type {
+	MEM_PROFILE_SITE_DATA_STACK,
+	MEM_PROFILE_SITE_POOL
+};
+
+struct mem_profile_site {
+	enum mem_profile_site_type type;
+	/* data stack: __FILE__ of the t_push() caller (not copied),
+	   pool: the pool's name (copied) */
+	const char *name;
+	char *name_dup;
+	unsigned int line;
+
+	/* number of popped frames / created pools */
+	uint64_t count;
+	/* number of bytes allocated by callers */
+	uint64_t alloc_bytes;
+	/* data stack: largest frame size,
+	   pool: largest total size of the pools at the same time */
+	size_t peak_size;
+	/* pool: current total size of the pools */
+	size_t cur_size;
+	/* number of times data stack/pool was grown */
+	uint64_t grow_count;
+};
+
+bool mem_profile_enabled = FALSE;
+static char *mem_profile_dir;
+
+/* open addressing hash table of sites */
+static struct mem_profile_site **sites;
+static unsigned int sites_size, sites_count;
+
+void mem_profile_set_enabled(bool enabled)
+{
+	mem_profile_enabled = enabled;
+}
+
+static unsigned int
+mem_profile_hash(enum mem_profile_site_type type, const char *name,
+		 unsigned int line)
+{
+	if (type == MEM_PROFILE_SITE_DATA_STACK)
+		return (unsigned int)((uintptr_t)name >> 3) ^ (line * 31);
+	return str_hash(name);
+}
+
+static bool
+mem_profile_site_equals(const struct mem_profile_site *site,
+			enum mem_profile_site_type type, const char *name,
+			unsigned int line)
+{
+	if (site->type != type || site->line != line)
+		return FALSE;
+	/* data stack sites are looked up by pointer */
+	if (type == MEM_PROFILE_SITE_DATA_STACK)
+		return site->name == name;
+	return strcmp(site->name, name) == 0;
+}
+
+static void mem_profile_sites_grow(void)
+{
+	struct mem_profile_site **old_sites = sites;
+	unsigned int i, idx, old_size = sites_size;
+
+	sites_size = old_size == 0 ? MEM_PROFILE_INITIAL_TABLE_SIZE :
+		old_size * 2;
+	sites = i_new(struct mem_profile_site *, sites_size);
+	for (i = 0; i < old_size; i++) {
+		if (old_sites[i] == NULL)
+			continue;
+		idx = mem_profile_hash(old_sites[i]->type, old_sites[i]->name,
+				       old_sites[i]->line) & (sites_size-1);
+		while (sites[idx] != NULL)
+			idx = (idx + 1) & (sites_size-1);
+		sites[idx] = old_sites[i];
+	}
+	i_free(old_sites);
+}
+
+static struct mem_profile_site *
+mem_profile_site_get(enum mem_profile_site_type type, const char *name,
+		     unsigned int line)
+{
+	struct mem_profile_site *site;
+	unsigned int idx;
+
+	if (sites_count * 2 >= sites_size)
+		mem_profile_sites_grow();
+
+	idx = mem_profile_hash(type, name, line) & (sites_size-1);
+	for (;; idx = (idx + 1) & (sites_size-1)) {
+		site = sites[idx];
+		if (site == NULL)
+			break;
+		if (mem_profile_site_equals(site, type, name, line))
+			return site;
+	}
+
+	site = i_new(struct mem_profile_site, 1);
+	site->type = type;
+	if (type == MEM_PROFILE_SITE_DATA_STACK)
+		site->name = name;
+	else
+		site->name = site->name_dup = i_strdup(name);
+	site->line = line;
+	sites[idx] = site;
+	sites_count++;
+	return site;
+}
+
+void mem_profile_data_stack_frame(const char *file, unsigned int line,
+				  size_t alloc_bytes, size_t peak_size,
+				  unsigned int grow_count)
+{
+	struct mem_profile_site *site;
+
+	site = mem_profile_site_get(MEM_PROFILE_SITE_DATA_STACK, file, line);
+	site->count++;
+	site->alloc_bytes += alloc_bytes;
+	site->grow_count += grow_count;
+	if (site->peak_size < peak_size)
+		site->peak_size = peak_size;
+}
+
+struct mem_profile_site *mem_profile_pool_created(const char *name)
+{
+	struct mem_profile_site *site;
+
+	if (!mem_profile_enabled)
+		return NULL;
+
+	if (strncmp(name, MEMPOOL_GROWING, strlen(MEMPOOL_GROWING)) == 0)
+		name += strlen(MEMPOOL_GROWING);
+	site = mem_profile_site_get(MEM_PROFILE_SITE_POOL, name, 0);
+	site->count++;
+	return site;
+}
+
+/* The pools keep pointing to their sites after profiling is disabled, and
+   mem_profile_deinit() frees the sites while some pools may still be alive.
+   So the sites must be accessed only while profiling is enabled. */
+void mem_profile_pool_block_alloc(struct mem_profile_site *site, size_t size)
+{
+	if (!mem_profile_enabled)
+		return;
+
+	site->cur_size += size;
+	site->grow_count++;
+	if (site->peak_size < site->cur_size)
+		site->peak_size = site->cur_size;
+}
+
+void mem_profile_pool_block_free(struct mem_profile_site *site, size_t size)
+{
+	if (!mem_profile_enabled)
+		return;
+
+	/* the block may have been allocated while profiling was disabled */
+	if (site->cur_size < size)
+		site->cur_size = 0;
+	else
+		site->cur_size -= size;
+}
+
+void mem_profile_pool_malloc(struct mem_profile_site *site, size_t size)
+{
+	if (!mem_profile_enabled)
+		return;
+
+	site->alloc_bytes += size;
+}
+
+static int mem_profile_site_cmp(const void *p1, const void *p2)
+{
+	const struct mem_profile_site *const *s1 = p1, *const *s2 = p2;
+
+	if ((*s1)->peak_size > (*s2)->peak_size)
+		return -1;
+	if ((*s1)->peak_size < (*s2)->peak_size)
+		return 1;
+	return strcmp((*s1)->name, (*s2)->name);
+}
+
+void mem_profile_dump(string_t *dest)
+{
+	struct mem_profile_site **sorted, *site;
+	bool enabled = mem_profile_enabled;
+	unsigned int i, count = 0;
+
+	/* don't profile ourself, the sites table can't change while we're
+	   iterating it */
+	mem_profile_enabled = FALSE;
+
+	sorted = i_new(struct mem_profile_site *, sites_count + 1);
+	for (i = 0; i < sites_size; i++) {
+		if (sites[i] != NULL)
+			sorted[count++] = sites[i];
+	}
+	qsort(sorted, count, sizeof(*sorted), mem_profile_site_cmp);
+
+	str_append(dest, "type\tsite\tcount\talloc_bytes\tpeak_size\t"
+		   "cur_size\tgrow_count\n");
+	for (i = 0; i < count; i++) {
+		site = sorted[i];
+		if (site->type == MEM_PROFILE_SITE_DATA_STACK) {
+			str_printfa(dest, "data-stack\t%s:%u", site->name,
+				    site->line);
+		} else {
+			str_printfa(dest, "pool\t%s", site->name);
+		}
+		str_printfa(dest, "\t%llu\t%llu\t%llu\t%llu\t%llu\n",
+			    (unsigned long long)site->count,
+			    (unsigned long long)site->alloc_bytes,
+			    (unsigned long long)site->peak_size,
+			    (unsigned long long)site->cur_size,
+			    (unsigned long long)site->grow_count);
+	}
+	i_free(sorted);
+	mem_profile_enabled = enabled;
+}
+
+int mem_profile_dump_file(const char *path)
+{
+	string_t *str, *temp_path;
+	int fd, ret = 0;
+
+	str = str_new(default_pool, 4096);
+	mem_profile_dump(str);
+
+	/* the directory may be shared by processes of different users, so
+	   don't write to a predictable temp file name */
+	temp_path = t_str_new(256);
+	str_append(temp_path, path);
+	fd = safe_mkstemp_hostpid(temp_path, 0600, (uid_t)-1, (gid_t)-1);
+	if (fd == -1) {
+		i_error("safe_mkstemp(%s) failed: %m", str_c(temp_path));
+		str_free(&str);
+		return -1;
+	}
+	if (write_full(fd, str_data(str), str_len(str)) < 0) {
+		i_error("write(%s) failed: %m", str_c(temp_path));
+		ret = -1;
+	}
+	if (close(fd) < 0) {
+		i_error("close(%s) failed: %m", str_c(temp_path));
+		ret = -1;
+	}
+	if (ret == 0 && rename(str_c(temp_path), path) < 0) {
+		i_error("rename(%s, %s) failed: %m", str_c(temp_path), path);
+		ret = -1;
+	}
+	if (ret < 0)
+		(void)unlink(str_c(temp_path));
+	str_free(&str);
+	return ret;
+}
+
+void mem_profile_reset(void)
+{
+	struct mem_profile_site *site;
+	unsigned int i;
+
+	for (i = 0; i < sites_size; i++) {
+		if ((site = sites[i]) == NULL)
+			continue;
+		site->count = 0;
+		site->alloc_bytes = 0;
+		site->grow_count = 0;
+		site->peak_size = site->cur_size;
+	}
+}
+
+const char *mem_profile_get_dir(void)
+{
+	return mem_profile_dir;
+}
+
+void mem_profile_init(void)
+{
+	const char *dir = getenv(MEM_PROFILE_ENV);
+
+	if (dir != NULL) {
+		mem_profile_dir = i_strdup(dir);
+		mem_profile_enabled = TRUE;
+	}
+}
+
+void mem_profile_deinit(void)
+{
+	unsigned int i;
+
+	mem_profile_enabled = FALSE;
+	for (i = 0; i < sites_size; i++) {
+		if (sites[i] == NULL)
+			continue;
+		i_free(sites[i]->name_dup);
+		i_free(sites[i]);
+	}
+	i_free(sites);
+	sites_size = sites_count = 0;
+	i_free(mem_profile_dir);
+}
@@ -0,0 +1,58 @@
+#ifndef MEM_PROFILE_H
+#define MEM_PROFILE_H
+
+#include <signal.h>
+
+/* Allocation profiling. When enabled, data stack usage is tracked for each
+   t_push() call site (T_BEGIN) and pool usage is tracked for each pool name.
+   Profiling is enabled by lib_init() if MEM_PROFILE_ENV environment variable
+   is set. Its value is the directory where master_service processes write
+   their profile (<dir>/<pid>) when they receive MEM_PROFILE_DUMP_SIGNAL.
+   With the master process add the variable to import_environment setting. */
+#define MEM_PROFILE_ENV "MEMPROFILE"
+/* A real-time signal is used, since SIGUSR1 and SIGUSR2 already have other
+   meanings in some processes (e.g. auth cache statistics). This is defined
+   only if the system has SIGRTMIN. */
+#ifdef SIGRTMIN
+#  define MEM_PROFILE_DUMP_SIGNAL (SIGRTMIN + 1)
+#endif
+
+extern bool mem_profile_enabled;
+
+struct mem_profile_site;
+
+void mem_profile_set_enabled(bool enabled);
+
+/* Data stack frame pushed at file:line was popped. alloc_bytes is the number
+   of bytes allocated within the frame (including its child frames),
+   peak_size is the largest amount of data stack memory used by the frame at
+   once and grow_count is the number of times data stack had to be grown. */
+void mem_profile_data_stack_frame(const char *file, unsigned int line,
+				  size_t alloc_bytes, size_t peak_size,
+				  unsigned int grow_count);
+
+/* A pool with the given name was created. Returns the site where its
+   allocations are accounted to, or NULL if profiling isn't enabled. The
+   functions below ignore the site while profiling is disabled. */
+struct mem_profile_site *mem_profile_pool_created(const char *name);
+/* Pool allocated a new block of memory from the system. */
+void mem_profile_pool_block_alloc(struct mem_profile_site *site, size_t size);
+/* Pool freed size bytes of its memory back to the system. */
+void mem_profile_pool_block_free(struct mem_profile_site *site, size_t size);
+/* Pool allocated size bytes for its caller. */
+void mem_profile_pool_malloc(struct mem_profile_site *site, size_t size);
+
+/* Append the profile as tab-separated lines to dest. The first line contains
+   the field names, the rest are sorted by peak size. */
+void mem_profile_dump(string_t *dest);
+/* Write the profile to the given path. Returns 0 if ok, -1 if failed. */
+int mem_profile_dump_file(const char *path);
+/* Returns the directory given in MEM_PROFILE_ENV, or NULL if it wasn't set. */
+const char *mem_profile_get_dir(void);
+/* Forget all the collected statistics. */
+void mem_profile_reset(void);
+
+void mem_profile_init(void);
+void mem_profile_deinit(void);
+
+#endif
@@ -3,6 +3,7 @@
 /* @UNSAFE: whole file */
 #include "lib.h"
 #include "safe-memset.h"
+#include "mem-profile.h"
 #include "mempool.h"
 
 #include <stdlib.h>
@@ -20,6 +21,8 @@ struct alloconly_pool {
 	int refcount;
 
 	struct pool_block *block;
+	/* non-NULL if allocation profiling was enabled at creation */
+	struct mem_profile_site *profile_site;
 #ifdef DEBUG
 	const char *name;
 	size_t base_size;
@@ -119,7 +122,7 @@ static void check_sentries(struct pool_block *block)
 }
 #endif
 
-pool_t pool_alloconly_create(const char *name ATTR_UNUSED, size_t size)
+pool_t pool_alloconly_create(const char *name, size_t size)
 {
 	struct alloconly_pool apool, *new_apool;
 	size_t min_alloc = SIZEOF_POOLBLOCK +
@@ -157,6 +160,12 @@ pool_t pool_alloconly_create(const char *name ATTR_UNUSED, size_t size)
 	/* the first pool allocations must be from the first block */
 	i_assert(new_apool->block->prev == NULL);
 
+	if (unlikely(mem_profile_enabled)) {
+		new_apool->profile_site = mem_profile_pool_created(name);
+		mem_profile_pool_block_alloc(new_apool->profile_site,
+			SIZEOF_POOLBLOCK + new_apool->block->size);
+	}
+
 	return &new_apool->pool;
 }
 
@@ -169,6 +178,10 @@ static void pool_alloconly_destroy(struct alloconly_pool *apool)
 
 	/* destroy the last block */
 	block = apool->block;
+	if (apool->profile_site != NULL) {
+		mem_profile_pool_block_free(apool->profile_site,
+			SIZEOF_POOLBLOCK + apool->block->size);
+	}
 #ifdef DEBUG
 	safe_memset(block, CLEAR_CHR, SIZEOF_POOLBLOCK + apool->block->size);
 #endif
@@ -247,6 +260,9 @@ static void block_alloc(struct alloconly_pool *apool, size_t size)
 
 	block->size = size - SIZEOF_POOLBLOCK;
 	block->left = block->size;
+
+	if (apool->profile_site != NULL)
+		mem_profile_pool_block_alloc(apool->profile_site, size);
 }
 
 static void *pool_alloconly_malloc(pool_t pool, size_t size)
@@ -274,6 +290,8 @@ static void *pool_alloconly_malloc(pool_t pool, size_t size)
 
 	apool->block->left -= alloc_size;
 	apool->block->last_alloc_size = alloc_size;
+	if (apool->profile_site != NULL)
+		mem_profile_pool_malloc(apool->profile_site, alloc_size);
 #ifdef DEBUG
 	memcpy(mem, &size, sizeof(size));
 	mem = PTR_OFFSET(mem, MEM_ALIGN(sizeof(size)));
@@ -361,6 +379,10 @@ static void pool_alloconly_clear(pool_t pool)
 		block = apool->block;
 		apool->block = block->prev;
 
+		if (apool->profile_site != NULL) {
+			mem_profile_pool_block_free(apool->profile_site,
+				SIZEOF_POOLBLOCK + block->size);
+		}
 #ifdef DEBUG
 		safe_memset(block, CLEAR_CHR, SIZEOF_POOLBLOCK + block->size);
 #endif
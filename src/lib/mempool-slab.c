@@ -0,0 +1,386 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+/* @UNSAFE: whole file */
+#include "lib.h"
+#include "llist.h"
+#include "safe-memset.h"
+#include "mem-profile.h"
+#include "mempool.h"
+
+#include <stdlib.h>
+
+#ifdef HAVE_GC_GC_H
+#  include <gc/gc.h>
+#elif defined (HAVE_GC_H)
+#  include <gc.h>
+#endif
+
+/* All memory is allocated in SLAB_SIZE aligned slabs. This allows finding
+   the slab header of any allocation simply by masking its address. */
+#define SLAB_SIZE (16*1024)
+#define SLAB_HEADER_SIZE MEM_ALIGN(sizeof(struct slab))
+#define SLAB_DATA(slab) ((unsigned char *)(slab) + SLAB_HEADER_SIZE)
+#define SLAB_FROM_MEM(mem) \
+	((struct slab *)((uintptr_t)(mem) & ~(uintptr_t)(SLAB_SIZE-1)))
+
+/* Allocations larger than the biggest class get a slab of their own */
+#define SLAB_CLASS_LARGE N_ELEMENTS(slab_class_sizes)
+
+#ifdef DEBUG
+#  define CLEAR_CHR 0xde
+#endif
+
+static const unsigned int slab_class_sizes[] = {
+	16, 32, 48, 64, 80, 96, 128, 160, 192, 256, 320, 384, 512, 768, 1024
+};
+
+struct slab {
+	struct slab *prev, *next;
+
+	unsigned int class_idx;
+	/* number of objects currently allocated from this slab */
+	unsigned int used_count;
+	/* number of objects that have ever been carved out of the slab's
+	   data area. objects after this are unused and not in free_list. */
+	unsigned int carved_count;
+	/* object size in this slab, or the allocation size for a large
+	   slab */
+	size_t size;
+	void *free_list;
+};
+
+struct slab_class {
+	/* slabs that have free objects */
+	struct slab *partial;
+	/* slabs that have all of their objects allocated */
+	struct slab *full;
+	unsigned int capacity;
+};
+
+struct slab_pool {
+	struct pool pool;
+	int refcount;
+	char *name;
+
+	struct slab_class classes[N_ELEMENTS(slab_class_sizes)];
+	struct slab *large;
+
+	size_t live_size, total_alloc_size;
+	/* non-NULL if allocation profiling was enabled at creation */
+	struct mem_profile_site *profile_site;
+};
+
+static const char *pool_slab_get_name(pool_t pool);
+static void pool_slab_ref(pool_t pool);
+static void pool_slab_unref(pool_t *pool);
+static void *pool_slab_malloc(pool_t pool, size_t size);
+static void pool_slab_free(pool_t pool, void *mem);
+static void *pool_slab_realloc(pool_t pool, void *mem,
+			       size_t old_size, size_t new_size);
+static void pool_slab_clear(pool_t pool);
+static size_t pool_slab_get_max_easy_alloc_size(pool_t pool);
+
+static const struct pool_vfuncs static_slab_pool_vfuncs = {
+	pool_slab_get_name,
+
+	pool_slab_ref,
+	pool_slab_unref,
+
+	pool_slab_malloc,
+	pool_slab_free,
+
+	pool_slab_realloc,
+
+	pool_slab_clear,
+	pool_slab_get_max_easy_alloc_size
+};
+
+static const struct pool static_slab_pool = {
+	.v = &static_slab_pool_vfuncs,
+
+	.alloconly_pool = FALSE,
+	.datastack_pool = FALSE
+};
+
+pool_t pool_slab_create(const char *name)
+{
+	struct slab_pool *spool;
+	unsigned int i;
+
+	spool = i_new(struct slab_pool, 1);
+	spool->pool = static_slab_pool;
+	spool->refcount = 1;
+	spool->name = i_strdup(name);
+	for (i = 0; i < N_ELEMENTS(spool->classes); i++) {
+		spool->classes[i].capacity =
+			(SLAB_SIZE - SLAB_HEADER_SIZE) / slab_class_sizes[i];
+	}
+	if (unlikely(mem_profile_enabled))
+		spool->profile_site = mem_profile_pool_created(name);
+	return &spool->pool;
+}
+
+static const char *pool_slab_get_name(pool_t pool)
+{
+	struct slab_pool *spool = (struct slab_pool *)pool;
+
+	return spool->name;
+}
+
+static void pool_slab_ref(pool_t pool)
+{
+	struct slab_pool *spool = (struct slab_pool *)pool;
+
+	spool->refcount++;
+}
+
+static void pool_slab_unref(pool_t *pool)
+{
+	struct slab_pool *spool = (struct slab_pool *)*pool;
+
+	if (--spool->refcount > 0)
+		return;
+
+	*pool = NULL;
+	pool_slab_clear(&spool->pool);
+	i_free(spool->name);
+	i_free(spool);
+}
+
+static struct slab *slab_alloc(struct slab_pool *spool, size_t size)
+{
+	void *mem;
+
+#ifndef USE_GC
+	if (posix_memalign(&mem, SLAB_SIZE, size) != 0)
+		mem = NULL;
+#else
+	mem = GC_memalign(SLAB_SIZE, size);
+#endif
+	if (unlikely(mem == NULL)) {
+		i_fatal_status(FATAL_OUTOFMEM, "pool_slab_malloc(%"PRIuSIZE_T
+			       "): Out of memory", size);
+	}
+	memset(mem, 0, SLAB_HEADER_SIZE);
+	spool->total_alloc_size += size;
+	if (spool->profile_site != NULL)
+		mem_profile_pool_block_alloc(spool->profile_site, size);
+	return mem;
+}
+
+static void slab_free(struct slab_pool *spool, struct slab *slab)
+{
+	size_t size = slab->class_idx == SLAB_CLASS_LARGE ?
+		SLAB_HEADER_SIZE + slab->size : SLAB_SIZE;
+
+	i_assert(spool->total_alloc_size >= size);
+	spool->total_alloc_size -= size;
+	if (spool->profile_site != NULL)
+		mem_profile_pool_block_free(spool->profile_site, size);
+#ifdef DEBUG
+	safe_memset(slab, CLEAR_CHR, size);
+#endif
+#ifndef USE_GC
+	free(slab);
+#endif
+}
+
+static void slab_free_list(struct slab_pool *spool, struct slab **list)
+{
+	struct slab *slab;
+
+	while (*list != NULL) {
+		slab = *list;
+		DLLIST_REMOVE(list, slab);
+		slab_free(spool, slab);
+	}
+}
+
+static unsigned int slab_class_find(size_t size)
+{
+	unsigned int i;
+
+	for (i = 0; i < N_ELEMENTS(slab_class_sizes); i++) {
+		if (size <= slab_class_sizes[i])
+			return i;
+	}
+	return SLAB_CLASS_LARGE;
+}
+
+static size_t slab_mem_size(void *mem)
+{
+	return SLAB_FROM_MEM(mem)->size;
+}
+
+static void *
+pool_slab_malloc_large(struct slab_pool *spool, size_t size)
+{
+	struct slab *slab;
+
+	slab = slab_alloc(spool, SLAB_HEADER_SIZE + size);
+	slab->class_idx = SLAB_CLASS_LARGE;
+	slab->size = size;
+	slab->used_count = 1;
+	DLLIST_PREPEND(&spool->large, slab);
+
+	spool->live_size += size;
+	if (spool->profile_site != NULL)
+		mem_profile_pool_malloc(spool->profile_site, size);
+	memset(SLAB_DATA(slab), 0, size);
+	return SLAB_DATA(slab);
+}
+
+static void *pool_slab_malloc(pool_t pool, size_t size)
+{
+	struct slab_pool *spool = (struct slab_pool *)pool;
+	struct slab_class *class;
+	struct slab *slab;
+	unsigned int class_idx;
+	void *mem;
+
+	if (unlikely(size == 0 || size > SSIZE_T_MAX))
+		i_panic("Trying to allocate %"PRIuSIZE_T" bytes", size);
+
+	class_idx = slab_class_find(size);
+	if (class_idx == SLAB_CLASS_LARGE)
+		return pool_slab_malloc_large(spool, size);
+	class = &spool->classes[class_idx];
+
+	if (class->partial == NULL) {
+		slab = slab_alloc(spool, SLAB_SIZE);
+		slab->class_idx = class_idx;
+		slab->size = slab_class_sizes[class_idx];
+		DLLIST_PREPEND(&class->partial, slab);
+	}
+	slab = class->partial;
+
+	if (slab->free_list != NULL) {
+		mem = slab->free_list;
+		memcpy(&slab->free_list, mem, sizeof(void *));
+	} else {
+		i_assert(slab->carved_count < class->capacity);
+		mem = SLAB_DATA(slab) + slab->carved_count * slab->size;
+		slab->carved_count++;
+	}
+	if (++slab->used_count == class->capacity) {
+		DLLIST_REMOVE(&class->partial, slab);
+		DLLIST_PREPEND(&class->full, slab);
+	}
+	spool->live_size += slab->size;
+	if (spool->profile_site != NULL)
+		mem_profile_pool_malloc(spool->profile_site, slab->size);
+	memset(mem, 0, slab->size);
+	return mem;
+}
+
+static void pool_slab_free(pool_t pool, void *mem)
+{
+	struct slab_pool *spool = (struct slab_pool *)pool;
+	struct slab_class *class;
+	struct slab *slab;
+
+	if (mem == NULL)
+		return;
+
+	slab = SLAB_FROM_MEM(mem);
+	i_assert(slab->used_count > 0);
+	i_assert(spool->live_size >= slab->size);
+	spool->live_size -= slab->size;
+
+	if (slab->class_idx == SLAB_CLASS_LARGE) {
+		DLLIST_REMOVE(&spool->large, slab);
+		slab_free(spool, slab);
+		return;
+	}
+	class = &spool->classes[slab->class_idx];
+
+#ifdef DEBUG
+	safe_memset(mem, CLEAR_CHR, slab->size);
+#endif
+	memcpy(mem, &slab->free_list, sizeof(void *));
+	slab->free_list = mem;
+
+	if (slab->used_count-- == class->capacity) {
+		DLLIST_REMOVE(&class->full, slab);
+		DLLIST_PREPEND(&class->partial, slab);
+	}
+	if (slab->used_count == 0 &&
+	    (slab->prev != NULL || slab->next != NULL)) {
+		/* there are other slabs with free space. return this one
+		   back to the system. */
+		DLLIST_REMOVE(&class->partial, slab);
+		slab_free(spool, slab);
+	}
+}
+
+static void *pool_slab_realloc(pool_t pool, void *mem,
+			       size_t old_size, size_t new_size)
+{
+	void *new_mem;
+	size_t mem_size;
+
+	if (unlikely(new_size == 0 || new_size > SSIZE_T_MAX))
+		i_panic("Trying to allocate %"PRIuSIZE_T" bytes", new_size);
+
+	if (mem == NULL)
+		return pool_slab_malloc(pool, new_size);
+
+	mem_size = slab_mem_size(mem);
+	if (old_size > mem_size)
+		old_size = mem_size;
+	if (new_size <= mem_size && slab_class_find(new_size) ==
+	    SLAB_FROM_MEM(mem)->class_idx) {
+		/* fits into the same size class */
+		if (old_size < new_size)
+			memset((char *)mem + old_size, 0, new_size - old_size);
+		return mem;
+	}
+
+	new_mem = pool_slab_malloc(pool, new_size);
+	memcpy(new_mem, mem, I_MIN(old_size, new_size));
+	pool_slab_free(pool, mem);
+	return new_mem;
+}
+
+static void pool_slab_clear(pool_t pool)
+{
+	struct slab_pool *spool = (struct slab_pool *)pool;
+	unsigned int i;
+
+	for (i = 0; i < N_ELEMENTS(spool->classes); i++) {
+		slab_free_list(spool, &spool->classes[i].partial);
+		slab_free_list(spool, &spool->classes[i].full);
+	}
+	slab_free_list(spool, &spool->large);
+	i_assert(spool->total_alloc_size == 0);
+	spool->live_size = 0;
+}
+
+static size_t pool_slab_get_max_easy_alloc_size(pool_t pool ATTR_UNUSED)
+{
+	return 0;
+}
+
+size_t pool_slab_get_live_size(pool_t pool)
+{
+	struct slab_pool *spool = (struct slab_pool *)pool;
+
+	i_assert(pool->v == &static_slab_pool_vfuncs);
+	return spool->live_size;
+}
+
+size_t pool_slab_get_total_alloc_size(pool_t pool)
+{
+	struct slab_pool *spool = (struct slab_pool *)pool;
+
+	i_assert(pool->v == &static_slab_pool_vfuncs);
+	return spool->total_alloc_size;
+}
+
+size_t pool_slab_get_wasted_size(pool_t pool)
+{
+	struct slab_pool *spool = (struct slab_pool *)pool;
+
+	i_assert(pool->v == &static_slab_pool_vfuncs);
+	return spool->total_alloc_size - spool->live_size;
+}
@@ -58,6 +58,13 @@ extern pool_t unsafe_data_stack_pool;
    malloc()ed block size, part of it is used internally. */
 pool_t pool_alloconly_create(const char *name, size_t size);
 
+/* Create a new slab pool. Allocations are rounded up to size classes, and
+   each class allocates its objects from its own fixed size slabs with a free
+   list. Freed memory is reused for the same class, and slabs are given back
+   to the system once they become unused. This avoids fragmenting the heap in
+   long running processes that allocate and free lots of small objects. */
+pool_t pool_slab_create(const char *name);
+
 /* When allocating memory from returned pool, the data stack frame must be
    the same as it was when calling this function. pool_unref() also checks
    that the stack frame is the same. This should make it quite safe to use. */
@@ -105,4 +112,15 @@ size_t pool_alloconly_get_total_used_size(pool_t pool);
 /* Returns how much system memory has been allocated for this pool. */
 size_t pool_alloconly_get_total_alloc_size(pool_t pool);
 
+/* These functions are only for pools created with pool_slab_create(): */
+
+/* Returns how much memory is used by the currently allocated objects
+   (rounded up to their size class). */
+size_t pool_slab_get_live_size(pool_t pool);
+/* Returns how much system memory has been allocated for this pool. */
+size_t pool_slab_get_total_alloc_size(pool_t pool);
+/* Returns how much of the allocated system memory isn't used by any live
+   object (free objects and slab headers). */
+size_t pool_slab_get_wasted_size(pool_t pool);
+
 #endif
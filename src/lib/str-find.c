@@ -3,8 +3,22 @@
 /* @UNSAFE: whole file */
 
 #include "lib.h"
+#include "cpu-features.h"
 #include "str-find.h"
 
+#ifdef HAVE_CPU_X86_SIMD
+#  include <immintrin.h>
+#endif
+
+struct str_find_context;
+
+/* Scan the data for the key starting from *pos. Returns TRUE if the key was
+   found. Otherwise *pos is updated to the first position that wasn't yet
+   scanned. */
+typedef bool str_find_scan_t(struct str_find_context *ctx,
+			     const unsigned char *data, size_t size,
+			     size_t *pos);
+
 struct str_find_context {
 	pool_t pool;
 	unsigned char *key;
@@ -14,6 +28,7 @@ struct str_find_context {
 	unsigned int match_count;
 
 	size_t match_end_pos;
+	str_find_scan_t *scan;
 
 	int badtab[UCHAR_MAX+1];
 	int goodtab[FLEXIBLE_ARRAY_MEMBER];
@@ -75,6 +90,93 @@ static void init_goodtab(struct str_find_context *ctx)
 		ctx->goodtab[len_1 - suffixes[i]] = len_1 - i;
 }
 
+#ifdef HAVE_CPU_X86_SIMD
+static inline bool
+str_find_key_middle_matches(const struct str_find_context *ctx,
+			    const unsigned char *data)
+{
+	/* the first and the last bytes have already been compared */
+	return ctx->key_len <= 2 ||
+		memcmp(data + 1, ctx->key + 1, ctx->key_len - 2) == 0;
+}
+
+/* Compare the key's first and last bytes against 16 or 32 positions at a
+   time, and do a full comparison only for the positions where both of them
+   match. With natural language text this skips most of the data much faster
+   than Boyer-Moore is able to. */
+static bool ATTR_TARGET("sse2")
+str_find_scan_sse2(struct str_find_context *ctx,
+		   const unsigned char *data, size_t size, size_t *pos_r)
+{
+	const unsigned int last = ctx->key_len - 1;
+	const __m128i first_v = _mm_set1_epi8((char)ctx->key[0]);
+	const __m128i last_v = _mm_set1_epi8((char)ctx->key[last]);
+	__m128i block_first, block_last;
+	size_t pos = *pos_r;
+	unsigned int mask, bit;
+
+	for (; pos + 16 + last <= size; pos += 16) {
+		block_first = _mm_loadu_si128((const void *)(data + pos));
+		block_last = _mm_loadu_si128((const void *)(data + pos + last));
+		mask = _mm_movemask_epi8(
+			_mm_and_si128(_mm_cmpeq_epi8(first_v, block_first),
+				      _mm_cmpeq_epi8(last_v, block_last)));
+		for (; mask != 0; mask &= mask - 1) {
+			bit = __builtin_ctz(mask);
+			if (str_find_key_middle_matches(ctx, data + pos + bit)) {
+				ctx->match_end_pos = pos + bit + ctx->key_len;
+				return TRUE;
+			}
+		}
+	}
+	*pos_r = pos;
+	return FALSE;
+}
+
+static bool ATTR_TARGET("avx2")
+str_find_scan_avx2(struct str_find_context *ctx,
+		   const unsigned char *data, size_t size, size_t *pos_r)
+{
+	const unsigned int last = ctx->key_len - 1;
+	const __m256i first_v = _mm256_set1_epi8((char)ctx->key[0]);
+	const __m256i last_v = _mm256_set1_epi8((char)ctx->key[last]);
+	__m256i block_first, block_last;
+	size_t pos = *pos_r;
+	unsigned int mask, bit;
+
+	for (; pos + 32 + last <= size; pos += 32) {
+		block_first = _mm256_loadu_si256((const void *)(data + pos));
+		block_last = _mm256_loadu_si256((const void *)(data + pos + last));
+		mask = (unsigned int)_mm256_movemask_epi8(
+			_mm256_and_si256(_mm256_cmpeq_epi8(first_v, block_first),
+					 _mm256_cmpeq_epi8(last_v, block_last)));
+		for (; mask != 0; mask &= mask - 1) {
+			bit = __builtin_ctz(mask);
+			if (str_find_key_middle_matches(ctx, data + pos + bit)) {
+				ctx->match_end_pos = pos + bit + ctx->key_len;
+				return TRUE;
+			}
+		}
+	}
+	*pos_r = pos;
+	/* the SSE2 code can still handle a part of the rest */
+	return str_find_scan_sse2(ctx, data, size, pos_r);
+}
+#endif
+
+static str_find_scan_t *str_find_get_scan_func(void)
+{
+#ifdef HAVE_CPU_X86_SIMD
+	enum cpu_feature features = cpu_features_get();
+
+	if ((features & CPU_FEATURE_AVX2) != 0)
+		return str_find_scan_avx2;
+	if ((features & CPU_FEATURE_SSE2) != 0)
+		return str_find_scan_sse2;
+#endif
+	return NULL;
+}
+
 struct str_find_context *str_find_init(pool_t pool, const char *key)
 {
 	struct str_find_context *ctx;
@@ -92,6 +194,7 @@ struct str_find_context *str_find_init(pool_t pool, const char *key)
 
 	init_goodtab(ctx);
 	init_badtab(ctx);
+	ctx->scan = str_find_get_scan_func();
 	return ctx;
 }
 
@@ -110,6 +213,7 @@ bool str_find_more(struct str_find_context *ctx,
 {
 	unsigned int key_len = ctx->key_len;
 	unsigned int i, j, a, b;
+	size_t scan_pos;
 	int bad_value;
 
 	for (i = j = 0; i < ctx->match_count; i++) {
@@ -140,8 +244,12 @@ bool str_find_more(struct str_find_context *ctx,
 		ctx->match_count = j;
 		j = 0;
 	} else {
-		/* Boyer-Moore searching */
-		j = 0;
+		scan_pos = 0;
+		if (ctx->scan != NULL && ctx->scan(ctx, data, size, &scan_pos))
+			return TRUE;
+
+		/* Boyer-Moore searching for the rest of the data */
+		j = scan_pos;
 		while (j + key_len <= size) {
 			i = key_len - 1;
 			while (ctx->key[i] == data[i + j]) {
@@ -1,7 +1,9 @@
 /* Copyright (c) 2007-2013 Dovecot authors, see the included COPYING file */
 
 #include "test-lib.h"
+#include "buffer.h"
 #include "str.h"
+#include "cpu-features.h"
 #include "base64.h"
 
 #include <stdlib.h>
@@ -102,9 +104,71 @@ static void test_base64_random(void)
 	test_end();
 }
 
+static void test_base64_simd(void)
+{
+	static const char noise[] = " \t\r\n=!\x80";
+	buffer_t *input, *enc_scalar, *enc_simd, *dec_scalar, *dec_simd;
+	unsigned int i, j, len;
+	size_t pos_scalar, pos_simd;
+	int ret_scalar, ret_simd;
+
+	test_begin("base64 simd vs scalar");
+	input = buffer_create_dynamic(default_pool, 1024);
+	enc_scalar = buffer_create_dynamic(default_pool, 1024);
+	enc_simd = buffer_create_dynamic(default_pool, 1024);
+	dec_scalar = buffer_create_dynamic(default_pool, 1024);
+	dec_simd = buffer_create_dynamic(default_pool, 1024);
+	for (i = 0; i < 2000; i++) {
+		buffer_set_used_size(input, 0);
+		len = rand() % 1024;
+		for (j = 0; j < len; j++)
+			buffer_append_c(input, rand());
+
+		buffer_set_used_size(enc_scalar, 0);
+		buffer_set_used_size(enc_simd, 0);
+		cpu_features_set_mask(0);
+		base64_encode(input->data, input->used, enc_scalar);
+		cpu_features_set_mask((enum cpu_feature)-1);
+		base64_encode(input->data, input->used, enc_simd);
+		test_assert(buffer_cmp(enc_scalar, enc_simd));
+
+		/* add line breaks and some random noise */
+		buffer_set_used_size(input, 0);
+		for (j = 0; j < enc_scalar->used; j++) {
+			if (j % 76 == 0 && j > 0)
+				buffer_append(input, "\r\n", 2);
+			if (rand() % 500 == 0)
+				buffer_append_c(input, noise[rand() % (sizeof(noise)-1)]);
+			buffer_append_c(input,
+				((const unsigned char *)enc_scalar->data)[j]);
+		}
+		if (i % 2 == 0 && input->used > 0)
+			buffer_set_used_size(input, rand() % input->used);
+
+		buffer_set_used_size(dec_scalar, 0);
+		buffer_set_used_size(dec_simd, 0);
+		cpu_features_set_mask(0);
+		ret_scalar = base64_decode(input->data, input->used,
+					   &pos_scalar, dec_scalar);
+		cpu_features_set_mask((enum cpu_feature)-1);
+		ret_simd = base64_decode(input->data, input->used,
+					 &pos_simd, dec_simd);
+		test_assert(ret_scalar == ret_simd);
+		test_assert(pos_scalar == pos_simd);
+		test_assert(buffer_cmp(dec_scalar, dec_simd));
+	}
+	buffer_free(&input);
+	buffer_free(&enc_scalar);
+	buffer_free(&enc_simd);
+	buffer_free(&dec_scalar);
+	buffer_free(&dec_simd);
+	test_end();
+}
+
 void test_base64(void)
 {
 	test_base64_encode();
 	test_base64_decode();
 	test_base64_random();
+	test_base64_simd();
 }
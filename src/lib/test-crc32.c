@@ -1,8 +1,105 @@
 /* Copyright (c) 2010-2013 Dovecot authors, see the included COPYING file */
 
 #include "test-lib.h"
+#include "buffer.h"
+#include "hash-method.h"
+#include "istream.h"
+#include "ostream.h"
+#include "istream-hash.h"
+#include "ostream-hash.h"
+#include "cpu-features.h"
 #include "crc32.h"
 
+#include <stdlib.h>
+
+static uint32_t crc32_bitwise(const unsigned char *data, size_t size)
+{
+	uint32_t crc = 0xffffffff;
+	unsigned int i;
+
+	for (; size > 0; size--, data++) {
+		crc ^= *data;
+		for (i = 0; i < 8; i++)
+			crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+	}
+	return crc ^ 0xffffffff;
+}
+
+static void test_crc32_random(void)
+{
+	unsigned char data[4096+16];
+	unsigned int i, n, offset, size, split;
+	uint32_t crc, crc2;
+
+	for (i = 0; i < sizeof(data); i++)
+		data[i] = rand() % 256;
+
+	test_begin("crc32 random");
+	for (n = 0; n < 2000; n++) {
+		offset = rand() % 16;
+		size = n < 300 ? n : (unsigned int)rand() % 4096;
+		split = size == 0 ? 0 : rand() % size;
+		crc = crc32_bitwise(data + offset, size);
+
+		cpu_features_set_mask(0);
+		test_assert(crc32_data(data + offset, size) == crc);
+		crc2 = crc32_data_more(crc32_data(data + offset, split),
+				       data + offset + split, size - split);
+		test_assert(crc2 == crc);
+
+		cpu_features_set_mask((enum cpu_feature)-1);
+		test_assert(crc32_data(data + offset, size) == crc);
+		crc2 = crc32_data_more(crc32_data(data + offset, split),
+				       data + offset + split, size - split);
+		test_assert(crc2 == crc);
+	}
+	test_end();
+}
+
+static void test_crc32_streams(void)
+{
+	unsigned char data[10000], digest[4];
+	struct istream *input, *hinput;
+	struct ostream *output, *houtput;
+	buffer_t *buf;
+	const unsigned char *p;
+	size_t size;
+	uint32_t crc, icrc = 0, ocrc = 0;
+	unsigned int i;
+
+	for (i = 0; i < sizeof(data); i++)
+		data[i] = rand() % 256;
+	crc = crc32_data(data, sizeof(data));
+
+	test_begin("crc32 streams");
+	buf = buffer_create_dynamic(default_pool, sizeof(data));
+	output = o_stream_create_buffer(buf);
+	houtput = o_stream_create_hash(output, &hash_method_crc32, &ocrc);
+	input = i_stream_create_from_data(data, sizeof(data));
+	hinput = i_stream_create_hash(input, &hash_method_crc32, &icrc);
+	while (i_stream_read_data(hinput, &p, &size, 0) > 0) {
+		size = I_MIN(size, 333);
+		o_stream_nsend(houtput, p, size);
+		i_stream_skip(hinput, size);
+	}
+	test_assert(hinput->eof && hinput->stream_errno == 0);
+	test_assert(o_stream_nfinish(houtput) == 0);
+	test_assert(buf->used == sizeof(data));
+	test_assert(icrc == crc);
+	test_assert(ocrc == crc);
+
+	hash_method_crc32.result(&icrc, digest);
+	test_assert(digest[0] == crc >> 24 && digest[3] == (crc & 0xff));
+	test_assert(hash_method_lookup("crc32") == &hash_method_crc32);
+
+	i_stream_unref(&hinput);
+	i_stream_unref(&input);
+	o_stream_unref(&houtput);
+	o_stream_unref(&output);
+	buffer_free(&buf);
+	test_end();
+}
+
 void test_crc32(void)
 {
 	const char str[] = "foo\0bar";
@@ -11,4 +108,7 @@ void test_crc32(void)
 	test_assert(crc32_str(str) == 0x8c736521);
 	test_assert(crc32_data(str, sizeof(str)) == 0x32c9723d);
 	test_end();
+
+	test_crc32_random();
+	test_crc32_streams();
 }
@@ -0,0 +1,194 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "test-lib.h"
+#include "hash.h"
+#include "hash-open.h"
+
+#include <stdlib.h>
+
+#define TEST_HASH_KEY_COUNT 2000
+
+static unsigned int test_keys[TEST_HASH_KEY_COUNT];
+
+static unsigned int test_hash_uint(const unsigned int *p)
+{
+	/* a bad hash function to get plenty of collisions */
+	return *p % 97;
+}
+
+static int test_hash_uint_cmp(const unsigned int *p1, const unsigned int *p2)
+{
+	return *p1 == *p2 ? 0 : 1;
+}
+
+static void test_hash_random(bool open)
+{
+	HASH_TABLE(unsigned int *, unsigned int *) hash;
+	unsigned int *values[TEST_HASH_KEY_COUNT];
+	unsigned int i, idx, count = 0, *key, *value;
+
+	memset(values, 0, sizeof(values));
+	if (open) {
+		hash_table_create_open(&hash, default_pool, 0,
+				       test_hash_uint, test_hash_uint_cmp);
+	} else {
+		hash_table_create(&hash, default_pool, 0,
+				  test_hash_uint, test_hash_uint_cmp);
+	}
+
+	for (i = 0; i < TEST_HASH_KEY_COUNT * 20; i++) {
+		idx = rand() % TEST_HASH_KEY_COUNT;
+		key = &test_keys[idx];
+		switch (rand() % 4) {
+		case 0:
+		case 1:
+			if (values[idx] == NULL)
+				count++;
+			values[idx] = &test_keys[rand() % TEST_HASH_KEY_COUNT];
+			hash_table_update(hash, key, values[idx]);
+			break;
+		case 2:
+			if (values[idx] != NULL) {
+				hash_table_remove(hash, key);
+				values[idx] = NULL;
+				count--;
+			}
+			break;
+		case 3:
+			test_assert(hash_table_lookup(hash, key) == values[idx]);
+			break;
+		}
+		if (i % 10000 == 0) {
+			/* remove half of the keys in one go */
+			hash_table_freeze(hash);
+			for (idx = 0; idx < TEST_HASH_KEY_COUNT; idx += 2) {
+				if (values[idx] != NULL) {
+					hash_table_remove(hash, &test_keys[idx]);
+					values[idx] = NULL;
+					count--;
+				}
+			}
+			hash_table_thaw(hash);
+		}
+		test_assert(hash_table_count(hash) == count);
+	}
+	for (idx = 0; idx < TEST_HASH_KEY_COUNT; idx++) {
+		i = idx + 1;
+		if (values[idx] == NULL)
+			test_assert(!hash_table_lookup_full(hash, &i, &key, &value));
+		else {
+			test_assert(hash_table_lookup_full(hash, &test_keys[idx],
+							   &key, &value));
+			test_assert(key == &test_keys[idx]);
+			test_assert(value == values[idx]);
+		}
+	}
+	hash_table_clear(hash, TRUE);
+	test_assert(hash_table_count(hash) == 0);
+	test_assert(hash_table_lookup(hash, &test_keys[0]) == NULL);
+	hash_table_destroy(&hash);
+}
+
+static void test_hash_iterate(bool open)
+{
+	HASH_TABLE(unsigned int *, unsigned int *) hash;
+	struct hash_iterate_context *iter;
+	bool seen[TEST_HASH_KEY_COUNT];
+	unsigned int i, count, *key, *value;
+
+	memset(seen, 0, sizeof(seen));
+	if (open)
+		hash_table_create_direct_open(&hash, default_pool, 0);
+	else
+		hash_table_create_direct(&hash, default_pool, 0);
+	for (i = 0; i < TEST_HASH_KEY_COUNT; i++)
+		hash_table_insert(hash, &test_keys[i], &test_keys[i]);
+
+	/* remove every other node while iterating */
+	count = 0;
+	iter = hash_table_iterate_init(hash);
+	while (hash_table_iterate(iter, hash, &key, &value)) {
+		test_assert(key == value);
+		test_assert(!seen[*key - 1]);
+		seen[*key - 1] = TRUE;
+		if (*key % 2 == 0)
+			hash_table_remove(hash, key);
+		count++;
+	}
+	hash_table_iterate_deinit(&iter);
+	test_assert(count == TEST_HASH_KEY_COUNT);
+	test_assert(hash_table_count(hash) == TEST_HASH_KEY_COUNT / 2);
+
+	for (i = 0; i < TEST_HASH_KEY_COUNT; i++) {
+		value = hash_table_lookup(hash, &test_keys[i]);
+		test_assert(value == (test_keys[i] % 2 == 0 ?
+				      NULL : &test_keys[i]));
+	}
+	hash_table_destroy(&hash);
+}
+
+static unsigned int test_hash_open_first_pos(struct hash_open_table *table)
+{
+	unsigned int pos = 0;
+	void *key, *value;
+
+	test_assert(hash_open_iterate(table, &pos, &key, &value));
+	return pos;
+}
+
+static void test_hash_open_compact(void)
+{
+	struct hash_open_table *table;
+	unsigned int i;
+	void *key, *value;
+
+	table = hash_open_create(16, (hash_callback_t *)test_hash_uint,
+				 (hash_cmp_callback_t *)test_hash_uint_cmp);
+	for (i = 0; i < 16; i++)
+		hash_open_insert(table, &test_keys[i], &test_keys[i], FALSE);
+
+	/* a single remove from a full table doesn't compact it.
+	   the iteration position shows whether the hole is still there. */
+	test_assert(hash_open_remove(table, &test_keys[0]));
+	hash_open_compact(table);
+	test_assert(test_hash_open_first_pos(table) == 2);
+
+	/* inserting grows the array instead */
+	hash_open_insert(table, &test_keys[0], &test_keys[0], FALSE);
+	test_assert(hash_open_count(table) == 16);
+	test_assert(test_hash_open_first_pos(table) == 2);
+
+	/* compacted once 1/4 of the entries are holes */
+	for (i = 1; i < 3; i++)
+		test_assert(hash_open_remove(table, &test_keys[i]));
+	hash_open_compact(table);
+	test_assert(test_hash_open_first_pos(table) == 4);
+	test_assert(hash_open_remove(table, &test_keys[3]));
+	hash_open_compact(table);
+	test_assert(test_hash_open_first_pos(table) == 1);
+	test_assert(hash_open_count(table) == 13);
+	for (i = 0; i < 16; i++) {
+		test_assert(hash_open_lookup(table, &test_keys[i],
+					     &key, &value) == (i == 0 || i > 3));
+	}
+	hash_open_destroy(&table);
+}
+
+void test_hash(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < TEST_HASH_KEY_COUNT; i++)
+		test_keys[i] = i + 1;
+
+	test_begin("hash table chained");
+	test_hash_random(FALSE);
+	test_hash_iterate(FALSE);
+	test_end();
+
+	test_begin("hash table open addressing");
+	test_hash_random(TRUE);
+	test_hash_iterate(TRUE);
+	test_hash_open_compact();
+	test_end();
+}
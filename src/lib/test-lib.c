@@ -11,6 +11,7 @@ int main(void)
 		test_bsearch_insert_pos,
 		test_buffer,
 		test_crc32,
+		test_hash,
 		test_hash_format,
 		test_hex_binary,
 		test_iso8601_date,
@@ -22,7 +23,9 @@ int main(void)
 		test_istream_tee,
 		test_json_parser,
 		test_llist,
+		test_mem_profile,
 		test_mempool_alloconly,
+		test_mempool_slab,
 		test_network,
 		test_numpack,
 		test_ostream_file,
@@ -35,6 +38,7 @@ int main(void)
 		test_str_find,
 		test_str_sanitize,
 		test_time_util,
+		test_timing_wheel,
 		test_unichar,
 		test_utc_mktime,
 		test_var_expand,
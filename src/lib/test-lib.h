@@ -10,6 +10,7 @@ void test_base64(void);
 void test_bsearch_insert_pos(void);
 void test_buffer(void);
 void test_crc32(void);
+void test_hash(void);
 void test_hash_format(void);
 void test_hex_binary(void);
 void test_iso8601_date(void);
@@ -21,7 +22,9 @@ void test_istream_seekable(void);
 void test_istream_tee(void);
 void test_json_parser(void);
 void test_llist(void);
+void test_mem_profile(void);
 void test_mempool_alloconly(void);
+void test_mempool_slab(void);
 void test_network(void);
 void test_numpack(void);
 void test_ostream_file(void);
@@ -34,6 +37,7 @@ void test_strfuncs(void);
 void test_str_find(void);
 void test_str_sanitize(void);
 void test_time_util(void);
+void test_timing_wheel(void);
 void test_unichar(void);
 void test_utc_mktime(void);
 void test_var_expand(void);
@@ -0,0 +1,184 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "test-lib.h"
+#include "str.h"
+#include "hostpid.h"
+#include "unlink-directory.h"
+#include "mem-profile.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+struct test_profile_line {
+	unsigned long long count, alloc_bytes, peak_size, cur_size, grow_count;
+};
+
+static bool
+test_mem_profile_find(const char *type, const char *site,
+		      struct test_profile_line *line_r)
+{
+	string_t *str = t_str_new(1024);
+	const char *const *lines, *const *args;
+
+	mem_profile_dump(str);
+	lines = t_strsplit(str_c(str), "\n");
+	test_assert(strcmp(lines[0], "type\tsite\tcount\talloc_bytes\t"
+			   "peak_size\tcur_size\tgrow_count") == 0);
+	for (lines++; *lines != NULL; lines++) {
+		args = t_strsplit_tab(*lines);
+		if (str_array_length(args) != 7 ||
+		    strcmp(args[0], type) != 0 || strcmp(args[1], site) != 0)
+			continue;
+		line_r->count = strtoull(args[2], NULL, 10);
+		line_r->alloc_bytes = strtoull(args[3], NULL, 10);
+		line_r->peak_size = strtoull(args[4], NULL, 10);
+		line_r->cur_size = strtoull(args[5], NULL, 10);
+		line_r->grow_count = strtoull(args[6], NULL, 10);
+		return TRUE;
+	}
+	return FALSE;
+}
+
+static void test_mem_profile_data_stack(void)
+{
+	struct test_profile_line outer, inner;
+	const char *outer_site, *inner_site;
+	unsigned int i, outer_line, inner_line = 0;
+
+	test_begin("mem profile data stack");
+	mem_profile_set_enabled(TRUE);
+	mem_profile_reset();
+
+	for (i = 0; i < 3; i++) {
+		outer_line = __LINE__; T_BEGIN {
+			(void)t_malloc(100);
+			inner_line = __LINE__; T_BEGIN {
+				(void)t_malloc(1000);
+			} T_END;
+			(void)t_malloc(100);
+		} T_END;
+	}
+	/* the inner frame's memory is freed by the time the second outer
+	   allocation is done, so the peak contains only one of them */
+	T_BEGIN {
+		outer_site = t_strdup_printf("%s:%u", __FILE__, outer_line);
+		inner_site = t_strdup_printf("%s:%u", __FILE__, inner_line);
+		test_assert(test_mem_profile_find("data-stack", outer_site,
+						  &outer));
+		test_assert(test_mem_profile_find("data-stack", inner_site,
+						  &inner));
+	} T_END;
+	test_assert(outer.count == 3 && inner.count == 3);
+	test_assert(outer.alloc_bytes >= 3*1200 &&
+		    outer.alloc_bytes < 3*(1200 + 3*MEM_ALIGN_SIZE + 3*64));
+	test_assert(inner.alloc_bytes >= 3*1000 &&
+		    inner.alloc_bytes < 3*(1000 + MEM_ALIGN_SIZE + 64));
+	test_assert(inner.peak_size >= 1000 && inner.peak_size < 1100);
+	test_assert(outer.peak_size >= 1100 && outer.peak_size < 1200);
+
+	mem_profile_set_enabled(FALSE);
+	test_end();
+}
+
+static void test_mem_profile_pool(const char *name, pool_t pool)
+{
+	struct test_profile_line line;
+	unsigned int i;
+
+	for (i = 0; i < 100; i++)
+		(void)p_malloc(pool, 100);
+	test_assert(test_mem_profile_find("pool", name, &line));
+	test_assert(line.count == 1);
+	test_assert(line.alloc_bytes >= 100*100);
+	test_assert(line.cur_size >= 100*100);
+	test_assert(line.peak_size == line.cur_size);
+	test_assert(line.grow_count > 0);
+
+	pool_unref(&pool);
+	test_assert(test_mem_profile_find("pool", name, &line));
+	test_assert(line.cur_size == 0);
+	test_assert(line.peak_size >= 100*100);
+}
+
+static void test_mem_profile_pools(void)
+{
+	test_begin("mem profile pools");
+	mem_profile_set_enabled(TRUE);
+	mem_profile_reset();
+
+	test_mem_profile_pool("test alloconly",
+		pool_alloconly_create(MEMPOOL_GROWING"test alloconly", 64));
+	test_mem_profile_pool("test slab", pool_slab_create("test slab"));
+
+	mem_profile_set_enabled(FALSE);
+	test_end();
+}
+
+static void test_mem_profile_deinit_live_pool(void)
+{
+	pool_t pool;
+	unsigned int i;
+
+	test_begin("mem profile deinit with live pool");
+	mem_profile_set_enabled(TRUE);
+	pool = pool_alloconly_create(MEMPOOL_GROWING"test deinit", 64);
+	(void)p_malloc(pool, 100);
+
+	/* the pool outlives the profile, which must no longer be updated */
+	mem_profile_deinit();
+	for (i = 0; i < 100; i++)
+		(void)p_malloc(pool, 100);
+	pool_unref(&pool);
+	test_assert(!mem_profile_enabled);
+
+	mem_profile_init();
+	test_end();
+}
+
+static void test_mem_profile_dump_file(void)
+{
+	const char *path, *victim;
+	char *dir, buf[64];
+	int fd;
+
+	test_begin("mem profile dump file");
+	dir = t_strdup_noconst(t_strdup_printf("/tmp/test-mem-profile.%s.XXXXXX",
+						 my_pid));
+	if (mkdtemp(dir) == NULL)
+		i_fatal("mkdtemp(%s) failed: %m", dir);
+	path = t_strconcat(dir, "/dump", NULL);
+	victim = t_strconcat(dir, "/victim", NULL);
+
+	/* a symlink at the old predictable temp path must not be followed */
+	fd = open(victim, O_WRONLY | O_CREAT, 0600);
+	if (fd == -1 || write(fd, "victim", 6) != 6)
+		i_fatal("write(%s) failed: %m", victim);
+	i_close_fd(&fd);
+	if (symlink(victim, t_strconcat(path, ".tmp", NULL)) < 0)
+		i_fatal("symlink(%s) failed: %m", victim);
+
+	test_assert(mem_profile_dump_file(path) == 0);
+
+	if ((fd = open(victim, O_RDONLY)) == -1)
+		i_fatal("open(%s) failed: %m", victim);
+	test_assert(read(fd, buf, sizeof(buf)) == 6 &&
+		    memcmp(buf, "victim", 6) == 0);
+	i_close_fd(&fd);
+	if ((fd = open(path, O_RDONLY | O_NOFOLLOW)) == -1)
+		i_fatal("open(%s) failed: %m", path);
+	test_assert(read(fd, buf, 5) == 5 && memcmp(buf, "type\t", 5) == 0);
+	i_close_fd(&fd);
+
+	if (unlink_directory(dir, UNLINK_DIRECTORY_FLAG_RMDIR) < 0)
+		i_error("unlink_directory(%s) failed: %m", dir);
+	test_end();
+}
+
+void test_mem_profile(void)
+{
+	test_mem_profile_data_stack();
+	test_mem_profile_pools();
+	test_mem_profile_dump_file();
+	test_mem_profile_deinit_live_pool();
+}
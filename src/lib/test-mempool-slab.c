@@ -0,0 +1,123 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "test-lib.h"
+#include "hash.h"
+
+#include <stdlib.h>
+
+#define TEST_SLAB_ALLOC_COUNT 2000
+
+static bool mem_has_bytes(const void *mem, size_t size, uint8_t b)
+{
+	const uint8_t *bytes = mem;
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		if (bytes[i] != b)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+static void test_mempool_slab_random(void)
+{
+	pool_t pool;
+	unsigned char *mem[TEST_SLAB_ALLOC_COUNT];
+	size_t sizes[TEST_SLAB_ALLOC_COUNT], new_size;
+	unsigned int i, j;
+
+	test_begin("mempool slab random");
+	pool = pool_slab_create("test");
+	memset(mem, 0, sizeof(mem));
+	for (i = 0; i < 20000; i++) {
+		j = rand() % TEST_SLAB_ALLOC_COUNT;
+		if (mem[j] != NULL) {
+			test_assert(mem_has_bytes(mem[j], sizes[j], j & 0xff));
+			if (rand() % 3 == 0) {
+				/* grow or shrink */
+				new_size = 1 + rand() % (rand() % 10 == 0 ?
+							 5000 : 200);
+				mem[j] = p_realloc(pool, mem[j], sizes[j],
+						   new_size);
+				test_assert(mem_has_bytes(mem[j],
+					I_MIN(sizes[j], new_size), j & 0xff));
+				if (new_size > sizes[j]) {
+					test_assert(mem_has_bytes(mem[j] + sizes[j],
+						new_size - sizes[j], 0));
+				}
+				sizes[j] = new_size;
+				memset(mem[j], j & 0xff, sizes[j]);
+			} else {
+				p_free(pool, mem[j]);
+			}
+		} else {
+			sizes[j] = 1 + rand() % (rand() % 10 == 0 ? 5000 : 200);
+			mem[j] = p_malloc(pool, sizes[j]);
+			test_assert(mem_has_bytes(mem[j], sizes[j], 0));
+			memset(mem[j], j & 0xff, sizes[j]);
+		}
+		test_assert(pool_slab_get_live_size(pool) +
+			    pool_slab_get_wasted_size(pool) ==
+			    pool_slab_get_total_alloc_size(pool));
+	}
+	for (i = 0; i < TEST_SLAB_ALLOC_COUNT; i++) {
+		if (mem[i] != NULL) {
+			test_assert(mem_has_bytes(mem[i], sizes[i], i & 0xff));
+			p_free(pool, mem[i]);
+		}
+	}
+	test_assert(pool_slab_get_live_size(pool) == 0);
+	/* at most one empty slab is kept for each size class */
+	test_assert(pool_slab_get_total_alloc_size(pool) <= 15 * 16 * 1024);
+
+	p_clear(pool);
+	test_assert(pool_slab_get_total_alloc_size(pool) == 0);
+	pool_unref(&pool);
+	test_end();
+}
+
+static unsigned int test_hash_colliding(const void *p)
+{
+	/* make sure there are lots of collisions, so that nodes get
+	   allocated from the pool */
+	return POINTER_CAST_TO(p, unsigned int) % 100;
+}
+
+static int test_hash_cmp(const void *p1, const void *p2)
+{
+	return p1 == p2 ? 0 : 1;
+}
+
+static void test_mempool_slab_hash(void)
+{
+	HASH_TABLE(void *, void *) hash;
+	pool_t pool;
+	unsigned int i;
+
+	test_begin("mempool slab hash nodes");
+	pool = pool_slab_create("test hash");
+	hash_table_create(&hash, pool, 0, test_hash_colliding, test_hash_cmp);
+	for (i = 1; i <= 2000; i++)
+		hash_table_insert(hash, POINTER_CAST(i), POINTER_CAST(i*2));
+	test_assert(pool_slab_get_live_size(pool) > 0);
+	for (i = 1; i <= 2000; i++) {
+		test_assert(hash_table_lookup(hash, POINTER_CAST(i)) ==
+			    POINTER_CAST(i*2));
+		if (i % 2 == 0)
+			hash_table_remove(hash, POINTER_CAST(i));
+	}
+	for (i = 1; i <= 2000; i++) {
+		test_assert(hash_table_lookup(hash, POINTER_CAST(i)) ==
+			    (i % 2 == 0 ? NULL : POINTER_CAST(i*2)));
+	}
+	hash_table_destroy(&hash);
+	test_assert(pool_slab_get_live_size(pool) == 0);
+	pool_unref(&pool);
+	test_end();
+}
+
+void test_mempool_slab(void)
+{
+	test_mempool_slab_random();
+	test_mempool_slab_hash();
+}
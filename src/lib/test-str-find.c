@@ -1,8 +1,11 @@
 /* Copyright (c) 2007-2013 Dovecot authors, see the included COPYING file */
 
 #include "test-lib.h"
+#include "cpu-features.h"
 #include "str-find.h"
 
+#include <stdlib.h>
+
 static const char *str_find_text = "xababcd";
 
 static bool test_str_find_substring(const char *key, int expected_pos)
@@ -56,6 +59,65 @@ struct str_find_input {
 	int pos;
 };
 
+static void test_str_find_random_features(void)
+{
+#define TEST_STR_FIND_DATA_SIZE 1024
+	unsigned char data[TEST_STR_FIND_DATA_SIZE + 1];
+	struct str_find_context *ctx;
+	const unsigned char *p;
+	const char *key;
+	unsigned int i, key_len, key_pos, block_size, pos;
+	bool found;
+
+	for (i = 0; i < 1000; i++) T_BEGIN {
+		/* small alphabet to get plenty of partial matches */
+		for (pos = 0; pos < TEST_STR_FIND_DATA_SIZE; pos++)
+			data[pos] = 'a' + rand() % 3;
+		data[TEST_STR_FIND_DATA_SIZE] = '\0';
+		key_len = 1 + rand() % 40;
+		key_pos = rand() % (TEST_STR_FIND_DATA_SIZE - key_len);
+		if (rand() % 2 == 0)
+			key = t_strndup(data + key_pos, key_len);
+		else
+			key = t_strdup_printf("%.*sd", (int)key_len - 1, data + key_pos);
+		p = (const void *)strstr((const char *)data, key);
+
+		ctx = str_find_init(pool_datastack_create(), key);
+		block_size = 1 + rand() % TEST_STR_FIND_DATA_SIZE;
+		found = FALSE;
+		for (pos = 0; pos < TEST_STR_FIND_DATA_SIZE && !found; ) {
+			block_size = I_MIN(block_size,
+					   TEST_STR_FIND_DATA_SIZE - pos);
+			if (str_find_more(ctx, data + pos, block_size)) {
+				found = TRUE;
+				pos += str_find_get_match_end_pos(ctx);
+			} else {
+				pos += block_size;
+			}
+		}
+		test_assert(found == (p != NULL));
+		if (found && p != NULL)
+			test_assert(pos == (unsigned int)(p - data) + key_len);
+		str_find_deinit(&ctx);
+	} T_END;
+}
+
+static void test_str_find_random(void)
+{
+	static const enum cpu_feature masks[] = {
+		0, CPU_FEATURE_SSE2, (enum cpu_feature)-1
+	};
+	unsigned int i;
+
+	for (i = 0; i < N_ELEMENTS(masks); i++) {
+		cpu_features_set_mask(masks[i]);
+		test_begin(t_strdup_printf("str_find() random, cpu features 0x%x",
+					   cpu_features_get()));
+		test_str_find_random_features();
+		test_end();
+	}
+}
+
 void test_str_find(void)
 {
 	static const char *fail_input[] = {
@@ -83,4 +145,5 @@ void test_str_find(void)
 	for (i = 0; i < N_ELEMENTS(fail_input) && success; i++)
 		success = test_str_find_substring(fail_input[i], -1);
 	test_out("str_find()", success);
+	test_str_find_random();
 }
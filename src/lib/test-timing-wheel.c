@@ -0,0 +1,168 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "test-lib.h"
+#include "ioloop.h"
+#include "timing-wheel.h"
+
+#include <stdlib.h>
+
+struct tw_test_item {
+	struct timing_wheel_item item;
+	uint64_t expire;
+	bool expired;
+};
+
+static void test_timing_wheel_order(void)
+{
+#define TW_MAX_ITEMS 1000
+	static const uint64_t start_times[] = {
+		0, 1, 255, 256, 12345, 1ULL << 32, (1ULL << 40) + 17
+	};
+	static const unsigned int ranges[] = {
+		10, 300, 20000, 2000000, 200000000
+	};
+	struct tw_test_item items[TW_MAX_ITEMS], *item;
+	struct timing_wheel *wheel;
+	struct timing_wheel_item *witem;
+	uint64_t now, next, prev;
+	unsigned int i, j, k, count;
+
+	test_begin("timing wheel randomized");
+	for (i = 0; i < N_ELEMENTS(start_times); i++) {
+		for (k = 0; k < N_ELEMENTS(ranges); k++) {
+			now = start_times[i];
+			wheel = timing_wheel_init(now);
+			for (j = 0; j < TW_MAX_ITEMS; j++) {
+				items[j].expire = now + rand() % ranges[k];
+				items[j].expired = FALSE;
+				timing_wheel_add(wheel, &items[j].item,
+						 items[j].expire);
+			}
+			for (j = 0; j < TW_MAX_ITEMS; j++) {
+				if (rand() % 3 == 0) {
+					timing_wheel_remove(wheel, &items[j].item);
+					items[j].expired = TRUE;
+				}
+			}
+			count = timing_wheel_count(wheel);
+			prev = 0;
+			while (timing_wheel_get_next_expire(wheel, &next)) {
+				/* the next expiration time must never be
+				   later than any item's expiration time */
+				test_assert(next >= prev);
+				now = next;
+				while ((witem = timing_wheel_pop_expired(wheel,
+								now)) != NULL) {
+					item = (struct tw_test_item *)witem;
+					test_assert(!item->expired);
+					test_assert(item->expire == now);
+					item->expired = TRUE;
+					count--;
+				}
+				test_assert(timing_wheel_count(wheel) == count);
+				prev = now;
+			}
+			test_assert(count == 0);
+			for (j = 0; j < TW_MAX_ITEMS; j++)
+				test_assert(items[j].expired);
+			timing_wheel_deinit(&wheel);
+		}
+	}
+	test_end();
+}
+
+static void test_timing_wheel_far(void)
+{
+	struct tw_test_item items[3];
+	struct timing_wheel *wheel;
+	uint64_t next;
+
+	test_begin("timing wheel far away items");
+	wheel = timing_wheel_init(1000);
+	/* already expired */
+	timing_wheel_add(wheel, &items[0].item, 10);
+	/* beyond the wheel's range */
+	timing_wheel_add(wheel, &items[1].item, 1000 + (1ULL << 34));
+	timing_wheel_add(wheel, &items[2].item, 1000 + (1ULL << 33) + 5);
+	test_assert(timing_wheel_get_next_expire(wheel, &next) && next == 1000);
+	test_assert(timing_wheel_pop_expired(wheel, 1000) == &items[0].item);
+	test_assert(timing_wheel_pop_expired(wheel, 1000) == NULL);
+	next = 1000 + (1ULL << 33) + 5;
+	test_assert(timing_wheel_pop_expired(wheel, next - 1) == NULL);
+	test_assert(timing_wheel_count(wheel) == 2);
+	test_assert(timing_wheel_pop_expired(wheel, next) == &items[2].item);
+	next = 1000 + (1ULL << 34);
+	test_assert(timing_wheel_pop_expired(wheel, next - 1) == NULL);
+	test_assert(timing_wheel_pop_expired(wheel, next) == &items[1].item);
+	test_assert(!timing_wheel_get_next_expire(wheel, &next));
+
+	/* pop_any() and set_time() */
+	timing_wheel_add(wheel, &items[0].item, 5);
+	timing_wheel_add(wheel, &items[1].item, 1ULL << 40);
+	test_assert(timing_wheel_pop_any(wheel) != NULL);
+	test_assert(timing_wheel_pop_any(wheel) != NULL);
+	test_assert(timing_wheel_pop_any(wheel) == NULL);
+	timing_wheel_set_time(wheel, 100);
+	timing_wheel_add(wheel, &items[0].item, 150);
+	test_assert(timing_wheel_pop_expired(wheel, 149) == NULL);
+	test_assert(timing_wheel_pop_expired(wheel, 150) == &items[0].item);
+	timing_wheel_deinit(&wheel);
+	test_end();
+}
+
+struct tw_test_ioloop_ctx {
+	struct timeout *to[3];
+	unsigned int calls[3];
+	unsigned int reset_count;
+};
+
+static void tw_test_timeout0(struct tw_test_ioloop_ctx *ctx)
+{
+	ctx->calls[0]++;
+	timeout_remove(&ctx->to[0]);
+	/* removing a timeout that's about to be called */
+	if (ctx->to[1] != NULL)
+		timeout_remove(&ctx->to[1]);
+}
+
+static void tw_test_timeout1(struct tw_test_ioloop_ctx *ctx)
+{
+	ctx->calls[1]++;
+}
+
+static void tw_test_timeout2(struct tw_test_ioloop_ctx *ctx)
+{
+	ctx->calls[2]++;
+	if (++ctx->reset_count < 3)
+		return;
+	timeout_remove(&ctx->to[2]);
+	io_loop_stop(current_ioloop);
+}
+
+static void test_timing_wheel_ioloop(void)
+{
+	struct tw_test_ioloop_ctx ctx;
+	struct ioloop *ioloop;
+
+	test_begin("timing wheel ioloop");
+	memset(&ctx, 0, sizeof(ctx));
+	ioloop = io_loop_create_flags(IO_LOOP_FLAG_TIMING_WHEEL);
+	ctx.to[0] = timeout_add_short(1, tw_test_timeout0, &ctx);
+	ctx.to[1] = timeout_add_short(1, tw_test_timeout1, &ctx);
+	ctx.to[2] = timeout_add_short(2, tw_test_timeout2, &ctx);
+	timeout_reset(ctx.to[2]);
+	io_loop_run(ioloop);
+	test_assert(ctx.calls[0] == 1);
+	test_assert(ctx.calls[0] + ctx.calls[1] <= 2);
+	test_assert(ctx.calls[2] == 3);
+	test_assert(!io_loop_have_immediate_timeouts(ioloop));
+	io_loop_destroy(&ioloop);
+	test_end();
+}
+
+void test_timing_wheel(void)
+{
+	test_timing_wheel_order();
+	test_timing_wheel_far();
+	test_timing_wheel_ioloop();
+}
@@ -3,8 +3,69 @@
 #include "test-lib.h"
 #include "str.h"
 #include "buffer.h"
+#include "cpu-features.h"
 #include "unichar.h"
 
+#include <stdlib.h>
+
+static void test_unichar_ascii_runs(void)
+{
+	static const char *parts[] = {
+		"hello world, ", "Hello World: abcdefghijklmnopqrstuvwxyz{|}~`@[ ",
+		"\xc3\xbc", "\xd0\x9f\xd1\x80\xd0\xb8", "\xe6\x97\xa5\xe6\x9c\xac",
+		"\xf0\x9f\x98\x80", "\xff", "\xc3", "\xe6\x97", "\r\n", "\x01\x7f"
+	};
+	buffer_t *input, *out_scalar, *out_simd, *valid_scalar, *valid_simd;
+	const char *part;
+	unsigned int i, j, count;
+	int ret_scalar, ret_simd;
+	bool valid1, valid2;
+
+	test_begin("unichar ascii runs");
+	input = buffer_create_dynamic(default_pool, 1024);
+	out_scalar = buffer_create_dynamic(default_pool, 1024);
+	out_simd = buffer_create_dynamic(default_pool, 1024);
+	valid_scalar = buffer_create_dynamic(default_pool, 1024);
+	valid_simd = buffer_create_dynamic(default_pool, 1024);
+	for (i = 0; i < 1000; i++) {
+		buffer_set_used_size(input, 0);
+		count = rand() % 30;
+		for (j = 0; j < count; j++) {
+			part = parts[rand() % N_ELEMENTS(parts)];
+			buffer_append(input, part, rand() % (strlen(part) + 1));
+		}
+		buffer_set_used_size(out_scalar, 0);
+		buffer_set_used_size(out_simd, 0);
+		buffer_set_used_size(valid_scalar, 0);
+		buffer_set_used_size(valid_simd, 0);
+
+		cpu_features_set_mask(0);
+		ret_scalar = uni_utf8_to_decomposed_titlecase(input->data,
+						input->used, out_scalar);
+		valid1 = uni_utf8_get_valid_data(input->data, input->used,
+						 valid_scalar);
+		cpu_features_set_mask((enum cpu_feature)-1);
+		ret_simd = uni_utf8_to_decomposed_titlecase(input->data,
+						input->used, out_simd);
+		valid2 = uni_utf8_get_valid_data(input->data, input->used,
+						 valid_simd);
+
+		test_assert(ret_scalar == ret_simd);
+		test_assert(buffer_cmp(out_scalar, out_simd));
+		test_assert(valid1 == valid2);
+		test_assert(buffer_cmp(valid_scalar, valid_simd));
+		test_assert(valid1 == uni_utf8_data_is_valid(input->data,
+							     input->used));
+		test_assert(valid1 == (ret_simd == 0));
+	}
+	buffer_free(&input);
+	buffer_free(&out_scalar);
+	buffer_free(&out_simd);
+	buffer_free(&valid_scalar);
+	buffer_free(&valid_simd);
+	test_end();
+}
+
 void test_unichar(void)
 {
 	static const char overlong_utf8[] = "\xf8\x80\x95\x81\xa1";
@@ -32,4 +93,6 @@ void test_unichar(void)
 	test_assert(!uni_utf8_str_is_valid(overlong_utf8));
 	test_assert(uni_utf8_get_char(overlong_utf8, &chr2) < 0);
 	test_end();
+
+	test_unichar_ascii_runs();
 }
@@ -0,0 +1,336 @@
+/* Copyright (c) 2013 Dovecot authors, see the included COPYING file */
+
+#include "lib.h"
+#include "timing-wheel.h"
+
+/* The first level has 256 slots of 1 millisecond each. Each of the following
+   levels has 64 slots, each slot covering the whole range of the previous
+   level. This gives a range of 2^32 milliseconds (~49 days). Items further
+   away than that are placed into the last slot and re-placed when they get
+   cascaded down. */
+#define WHEEL_L0_BITS 8
+#define WHEEL_LN_BITS 6
+#define WHEEL_LEVELS 5
+#define WHEEL_L0_SIZE (1U << WHEEL_L0_BITS)
+#define WHEEL_LN_SIZE (1U << WHEEL_LN_BITS)
+#define WHEEL_L0_MASK (WHEEL_L0_SIZE - 1)
+#define WHEEL_LN_MASK (WHEEL_LN_SIZE - 1)
+#define WHEEL_SLOT_COUNT (WHEEL_L0_SIZE + WHEEL_LN_SIZE * (WHEEL_LEVELS-1))
+#define WHEEL_MAX_DISTANCE \
+	((1ULL << (WHEEL_L0_BITS + WHEEL_LN_BITS * (WHEEL_LEVELS-1))) - 1)
+/* slot_idx for items in the expired list */
+#define WHEEL_EXPIRED_SLOT WHEEL_SLOT_COUNT
+
+#define LEVEL_SHIFT(level) \
+	((level) == 0 ? 0 : WHEEL_L0_BITS + WHEEL_LN_BITS * ((level) - 1))
+#define LEVEL_FIRST_SLOT(level) \
+	((level) == 0 ? 0 : WHEEL_L0_SIZE + WHEEL_LN_SIZE * ((level) - 1))
+
+struct timing_wheel {
+	/* The next millisecond that hasn't been processed yet */
+	uint64_t now_msecs;
+	unsigned int count;
+
+	struct timing_wheel_item *slots[WHEEL_SLOT_COUNT];
+	/* Bitmap of non-empty slots */
+	uint64_t slots_used[WHEEL_SLOT_COUNT / 64];
+
+	struct timing_wheel_item *expired_head, *expired_tail;
+};
+
+struct timing_wheel *timing_wheel_init(uint64_t now_msecs)
+{
+	struct timing_wheel *wheel;
+
+	wheel = i_new(struct timing_wheel, 1);
+	wheel->now_msecs = now_msecs;
+	return wheel;
+}
+
+void timing_wheel_deinit(struct timing_wheel **_wheel)
+{
+	struct timing_wheel *wheel = *_wheel;
+
+	*_wheel = NULL;
+	i_free(wheel);
+}
+
+unsigned int timing_wheel_count(const struct timing_wheel *wheel)
+{
+	return wheel->count;
+}
+
+/* Returns the first used slot in range [first, last], or -1 if none. */
+static int
+wheel_find_used_slot(const struct timing_wheel *wheel,
+		     unsigned int first, unsigned int last)
+{
+	unsigned int idx = first;
+	uint64_t bits;
+
+	while (idx <= last) {
+		bits = wheel->slots_used[idx / 64] >> (idx % 64);
+		if (bits == 0) {
+			/* skip to the next word */
+			idx = (idx | 63) + 1;
+			continue;
+		}
+		while ((bits & 1) == 0) {
+			bits >>= 1;
+			idx++;
+		}
+		return idx <= last ? (int)idx : -1;
+	}
+	return -1;
+}
+
+static unsigned int
+wheel_get_slot(const struct timing_wheel *wheel, uint64_t expire_msecs)
+{
+	uint64_t diff;
+	unsigned int level;
+
+	if (expire_msecs < wheel->now_msecs)
+		expire_msecs = wheel->now_msecs;
+	diff = expire_msecs - wheel->now_msecs;
+	if (diff < WHEEL_L0_SIZE)
+		return expire_msecs & WHEEL_L0_MASK;
+
+	if (diff > WHEEL_MAX_DISTANCE) {
+		diff = WHEEL_MAX_DISTANCE;
+		expire_msecs = wheel->now_msecs + diff;
+	}
+	for (level = 1; level < WHEEL_LEVELS-1; level++) {
+		if (diff < (1ULL << LEVEL_SHIFT(level+1)))
+			break;
+	}
+	return LEVEL_FIRST_SLOT(level) +
+		((expire_msecs >> LEVEL_SHIFT(level)) & WHEEL_LN_MASK);
+}
+
+static void
+wheel_link(struct timing_wheel *wheel, struct timing_wheel_item *item,
+	   unsigned int slot_idx)
+{
+	item->slot_idx = slot_idx;
+	item->prev = NULL;
+	item->next = wheel->slots[slot_idx];
+	if (item->next != NULL)
+		item->next->prev = item;
+	wheel->slots[slot_idx] = item;
+	wheel->slots_used[slot_idx / 64] |= 1ULL << (slot_idx % 64);
+}
+
+static void
+wheel_expired_append(struct timing_wheel *wheel,
+		     struct timing_wheel_item *item)
+{
+	item->slot_idx = WHEEL_EXPIRED_SLOT;
+	item->next = NULL;
+	item->prev = wheel->expired_tail;
+	if (wheel->expired_tail != NULL)
+		wheel->expired_tail->next = item;
+	else
+		wheel->expired_head = item;
+	wheel->expired_tail = item;
+}
+
+/* Unlink the whole slot and return its items as a list */
+static struct timing_wheel_item *
+wheel_slot_take(struct timing_wheel *wheel, unsigned int slot_idx)
+{
+	struct timing_wheel_item *list = wheel->slots[slot_idx];
+
+	wheel->slots[slot_idx] = NULL;
+	wheel->slots_used[slot_idx / 64] &= ~(1ULL << (slot_idx % 64));
+	return list;
+}
+
+void timing_wheel_add(struct timing_wheel *wheel,
+		      struct timing_wheel_item *item, uint64_t expire_msecs)
+{
+	item->expire_msecs = expire_msecs;
+	wheel_link(wheel, item, wheel_get_slot(wheel, expire_msecs));
+	wheel->count++;
+}
+
+void timing_wheel_remove(struct timing_wheel *wheel,
+			 struct timing_wheel_item *item)
+{
+	unsigned int slot_idx = item->slot_idx;
+
+	i_assert(wheel->count > 0);
+
+	if (item->next != NULL)
+		item->next->prev = item->prev;
+	if (slot_idx == WHEEL_EXPIRED_SLOT) {
+		if (item->prev != NULL)
+			item->prev->next = item->next;
+		else
+			wheel->expired_head = item->next;
+		if (wheel->expired_tail == item)
+			wheel->expired_tail = item->prev;
+	} else {
+		i_assert(slot_idx < WHEEL_SLOT_COUNT);
+		if (item->prev != NULL)
+			item->prev->next = item->next;
+		else {
+			i_assert(wheel->slots[slot_idx] == item);
+			wheel->slots[slot_idx] = item->next;
+			if (item->next == NULL) {
+				wheel->slots_used[slot_idx / 64] &=
+					~(1ULL << (slot_idx % 64));
+			}
+		}
+	}
+	item->prev = item->next = NULL;
+	wheel->count--;
+}
+
+static void wheel_cascade(struct timing_wheel *wheel)
+{
+	struct timing_wheel_item *list, *next;
+	unsigned int level, idx;
+
+	/* called when the first level wraps around. move the items from the
+	   next level's current slot down, and continue to the following
+	   level only if this level wrapped around as well. */
+	for (level = 1; level < WHEEL_LEVELS; level++) {
+		idx = (wheel->now_msecs >> LEVEL_SHIFT(level)) & WHEEL_LN_MASK;
+		list = wheel_slot_take(wheel, LEVEL_FIRST_SLOT(level) + idx);
+		for (; list != NULL; list = next) {
+			next = list->next;
+			wheel_link(wheel, list,
+				   wheel_get_slot(wheel, list->expire_msecs));
+		}
+		if (idx != 0)
+			break;
+	}
+}
+
+static void wheel_advance(struct timing_wheel *wheel, uint64_t now_msecs)
+{
+	struct timing_wheel_item *list, *next;
+	uint64_t next_msecs;
+	unsigned int idx;
+	int slot;
+
+	while (wheel->now_msecs <= now_msecs) {
+		idx = wheel->now_msecs & WHEEL_L0_MASK;
+		if (idx == 0)
+			wheel_cascade(wheel);
+
+		/* skip over empty slots up to the next wraparound */
+		slot = wheel_find_used_slot(wheel, idx, WHEEL_L0_SIZE-1);
+		if (slot < 0) {
+			next_msecs = (wheel->now_msecs | WHEEL_L0_MASK) + 1;
+			wheel->now_msecs = I_MIN(next_msecs, now_msecs + 1);
+			continue;
+		}
+		next_msecs = wheel->now_msecs + (slot - idx);
+		if (next_msecs > now_msecs) {
+			wheel->now_msecs = now_msecs + 1;
+			break;
+		}
+		list = wheel_slot_take(wheel, slot);
+		for (; list != NULL; list = next) {
+			next = list->next;
+			wheel_expired_append(wheel, list);
+		}
+		wheel->now_msecs = next_msecs + 1;
+	}
+}
+
+bool timing_wheel_get_next_expire(struct timing_wheel *wheel,
+				  uint64_t *msecs_r)
+{
+	uint64_t block, msecs, min_msecs = (uint64_t)-1;
+	unsigned int level, idx, first;
+	int slot;
+
+	if (wheel->count == 0)
+		return FALSE;
+	if (wheel->expired_head != NULL) {
+		*msecs_r = 0;
+		return TRUE;
+	}
+
+	/* first level: the slots after the current position belong to this
+	   round, the ones before it to the next round. */
+	idx = wheel->now_msecs & WHEEL_L0_MASK;
+	if ((slot = wheel_find_used_slot(wheel, idx, WHEEL_L0_SIZE-1)) >= 0)
+		min_msecs = wheel->now_msecs + (slot - idx);
+	else if (idx > 0 && (slot = wheel_find_used_slot(wheel, 0, idx-1)) >= 0)
+		min_msecs = wheel->now_msecs + WHEEL_L0_SIZE - idx + slot;
+
+	/* other levels: a slot gets cascaded when its whole range begins,
+	   which is the earliest possible expiration time for its items. */
+	for (level = 1; level < WHEEL_LEVELS; level++) {
+		block = (wheel->now_msecs + (1ULL << LEVEL_SHIFT(level)) - 1) >>
+			LEVEL_SHIFT(level);
+		idx = block & WHEEL_LN_MASK;
+		first = LEVEL_FIRST_SLOT(level);
+		slot = wheel_find_used_slot(wheel, first + idx,
+					    first + WHEEL_LN_SIZE-1);
+		if (slot >= 0)
+			block += slot - (first + idx);
+		else if (idx > 0 &&
+			 (slot = wheel_find_used_slot(wheel, first,
+						      first + idx-1)) >= 0)
+			block += WHEEL_LN_SIZE - idx + (slot - first);
+		else
+			continue;
+		msecs = block << LEVEL_SHIFT(level);
+		if (msecs < min_msecs)
+			min_msecs = msecs;
+	}
+	i_assert(min_msecs != (uint64_t)-1);
+	*msecs_r = min_msecs;
+	return TRUE;
+}
+
+struct timing_wheel_item *
+timing_wheel_pop_expired(struct timing_wheel *wheel, uint64_t now_msecs)
+{
+	struct timing_wheel_item *item;
+
+	if (wheel->expired_head == NULL) {
+		if (wheel->count == 0) {
+			if (wheel->now_msecs <= now_msecs)
+				wheel->now_msecs = now_msecs + 1;
+			return NULL;
+		}
+		wheel_advance(wheel, now_msecs);
+		if (wheel->expired_head == NULL)
+			return NULL;
+	}
+	item = wheel->expired_head;
+	timing_wheel_remove(wheel, item);
+	return item;
+}
+
+struct timing_wheel_item *timing_wheel_pop_any(struct timing_wheel *wheel)
+{
+	struct timing_wheel_item *item;
+	int slot;
+
+	if (wheel->count == 0)
+		return NULL;
+
+	if (wheel->expired_head != NULL)
+		item = wheel->expired_head;
+	else {
+		slot = wheel_find_used_slot(wheel, 0, WHEEL_SLOT_COUNT-1);
+		i_assert(slot >= 0);
+		item = wheel->slots[slot];
+	}
+	timing_wheel_remove(wheel, item);
+	return item;
+}
+
+void timing_wheel_set_time(struct timing_wheel *wheel, uint64_t now_msecs)
+{
+	i_assert(wheel->count == 0);
+
+	wheel->now_msecs = now_msecs;
+}
@@ -0,0 +1,52 @@
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+/* Hierarchical timing wheel with millisecond resolution. Adding and removing
+   items is O(1), and expired items are collected in batches. The items you
+   add to the wheel must begin with a struct timing_wheel_item. Timestamps are
+   absolute milliseconds in whatever clock the caller chooses to use. */
+
+struct timing_wheel_item {
+	/* Internal list pointers, updated automatically. */
+	struct timing_wheel_item *prev, *next;
+	/* Expiration time given to timing_wheel_add() */
+	uint64_t expire_msecs;
+	/* Slot the item is currently linked to, updated automatically. */
+	unsigned int slot_idx;
+	/* [your own data] */
+};
+
+/* Create a new timing wheel. now_msecs is the current time. */
+struct timing_wheel *timing_wheel_init(uint64_t now_msecs);
+void timing_wheel_deinit(struct timing_wheel **wheel);
+
+/* Return number of items in the wheel. */
+unsigned int timing_wheel_count(const struct timing_wheel *wheel) ATTR_PURE;
+
+/* Add a new item to the wheel, expiring at expire_msecs. If the time is
+   already in the past, the item expires on the next
+   timing_wheel_pop_expired() call. */
+void timing_wheel_add(struct timing_wheel *wheel,
+		      struct timing_wheel_item *item, uint64_t expire_msecs);
+/* Remove the specified item from the wheel. */
+void timing_wheel_remove(struct timing_wheel *wheel,
+			 struct timing_wheel_item *item);
+
+/* Get the earliest time when timing_wheel_pop_expired() may return an item.
+   This may be earlier than the actual expiration time of any item, since
+   items far in the future are only tracked with coarser granularity.
+   Returns FALSE if the wheel is empty. */
+bool timing_wheel_get_next_expire(struct timing_wheel *wheel,
+				  uint64_t *msecs_r);
+/* Move the wheel forward to now_msecs and return the next item whose
+   expiration time has been reached, removing it from the wheel.
+   Returns NULL if there are no more expired items. */
+struct timing_wheel_item *
+timing_wheel_pop_expired(struct timing_wheel *wheel, uint64_t now_msecs);
+/* Remove and return any item in the wheel, or NULL if the wheel is empty. */
+struct timing_wheel_item *timing_wheel_pop_any(struct timing_wheel *wheel);
+/* Set the wheel's current time, e.g. after the system clock has jumped.
+   The wheel must be empty. */
+void timing_wheel_set_time(struct timing_wheel *wheel, uint64_t now_msecs);
+
+#endif
@@ -3,10 +3,15 @@
 #include "lib.h"
 #include "array.h"
 #include "bsearch-insert-pos.h"
+#include "cpu-features.h"
 #include "unichar.h"
 
 #include "unicodemap.c"
 
+#ifdef HAVE_CPU_X86_SIMD
+#  include <emmintrin.h>
+#endif
+
 #define HANGUL_FIRST 0xac00
 #define HANGUL_LAST 0xd7a3
 
@@ -207,12 +212,6 @@ unsigned int uni_utf8_strlen_n(const void *_input, size_t size)
 	return len;
 }
 
-static bool uint16_find(const uint16_t *data, unsigned int count,
-			uint16_t value, unsigned int *idx_r)
-{
-	BINARY_NUMBER_SEARCH(data, count, value, idx_r);
-}
-
 static bool uint32_find(const uint32_t *data, unsigned int count,
 			uint32_t value, unsigned int *idx_r)
 {
@@ -226,11 +225,8 @@ unichar_t uni_ucs4_to_titlecase(unichar_t chr)
 	if (chr <= 0xff)
 		return titlecase8_map[chr];
 	else if (chr <= 0xffff) {
-		if (!uint16_find(titlecase16_keys, N_ELEMENTS(titlecase16_keys),
-				 chr, &idx))
-			return chr;
-		else
-			return titlecase16_values[idx];
+		idx = titlecase16_page_idx[chr >> 8];
+		return idx == 0 ? chr : titlecase16_pages[idx-1][chr & 0xff];
 	} else {
 		if (!uint32_find(titlecase32_keys, N_ELEMENTS(titlecase32_keys),
 				 chr, &idx))
@@ -240,29 +236,39 @@ unichar_t uni_ucs4_to_titlecase(unichar_t chr)
 	}
 }
 
-static bool uni_ucs4_decompose_uni(unichar_t *chr)
+static void uni_ucs4_decompose_multi_utf8(unsigned int idx, buffer_t *output)
+{
+	const uint32_t *value;
+
+	value = &multidecomp_values[multidecomp_offsets[idx]];
+	for (; *value != 0; value++)
+		uni_ucs4_to_utf8_c(*value, output);
+}
+
+static void uni_ucs4_decompose_utf8(unichar_t chr, buffer_t *output)
 {
 	unsigned int idx;
+	uint16_t value;
 
-	if (*chr <= 0xff) {
-		if (uni8_decomp_map[*chr] == *chr)
-			return FALSE;
-		*chr = uni8_decomp_map[*chr];
-	} else if (*chr <= 0xffff) {
-		if (*chr < uni16_decomp_keys[0])
-			return FALSE;
-
-		if (!uint16_find(uni16_decomp_keys,
-				 N_ELEMENTS(uni16_decomp_keys), *chr, &idx))
-			return FALSE;
-		*chr = uni16_decomp_values[idx];
-	} else {
-		if (!uint32_find(uni32_decomp_keys,
-				 N_ELEMENTS(uni32_decomp_keys), *chr, &idx))
-			return FALSE;
-		*chr = uni32_decomp_values[idx];
+	if (chr <= 0xff && uni8_decomp_map[chr] != chr) {
+		uni_ucs4_to_utf8_c(uni8_decomp_map[chr], output);
+		return;
 	}
-	return TRUE;
+	if (chr <= 0xffff) {
+		idx = decomp16_page_idx[chr >> 8];
+		value = idx == 0 ? 0 : decomp16_pages[idx-1][chr & 0xff];
+		if (value == 0)
+			uni_ucs4_to_utf8_c(chr, output);
+		else if ((value & 0x8000) != 0)
+			uni_ucs4_decompose_multi_utf8(value & 0x7fff, output);
+		else
+			uni_ucs4_to_utf8_c(uni16_decomp_values[value-1], output);
+		return;
+	}
+	if (uint32_find(uni32_decomp_keys, N_ELEMENTS(uni32_decomp_keys),
+			chr, &idx))
+		chr = uni32_decomp_values[idx];
+	uni_ucs4_to_utf8_c(chr, output);
 }
 
 static void uni_ucs4_decompose_hangul_utf8(unichar_t chr, buffer_t *output)
@@ -285,24 +291,6 @@ static void uni_ucs4_decompose_hangul_utf8(unichar_t chr, buffer_t *output)
 	if (T != TBase) uni_ucs4_to_utf8_c(T, output);
 }
 
-static bool uni_ucs4_decompose_multi_utf8(unichar_t chr, buffer_t *output)
-{
-	const uint32_t *value;
-	unsigned int idx;
-
-	if (chr < multidecomp_keys[0] || chr > 0xffff)
-		return FALSE;
-
-	if (!uint32_find(multidecomp_keys, N_ELEMENTS(multidecomp_keys),
-			 chr, &idx))
-		return FALSE;
-
-	value = &multidecomp_values[multidecomp_offsets[idx]];
-	for (; *value != 0; value++)
-		uni_ucs4_to_utf8_c(*value, output);
-	return TRUE;
-}
-
 static void output_add_replacement_char(buffer_t *output)
 {
 	if (output->used >= UTF8_REPLACEMENT_CHAR_LEN &&
@@ -315,15 +303,119 @@ static void output_add_replacement_char(buffer_t *output)
 	buffer_append(output, utf8_replacement_char, UTF8_REPLACEMENT_CHAR_LEN);
 }
 
+/* Returns the length of the ASCII-only prefix in input. */
+static size_t uni_ascii_prefix_len_scalar(const unsigned char *input,
+					  size_t size)
+{
+	uint64_t word;
+	size_t i;
+
+	for (i = 0; i + sizeof(word) <= size; i += sizeof(word)) {
+		memcpy(&word, input + i, sizeof(word));
+		if ((word & 0x8080808080808080ULL) != 0)
+			break;
+	}
+	for (; i < size && input[i] < 0x80; i++) ;
+	return i;
+}
+
+/* Append titlecased ASCII-only prefix of input to output. Returns the number
+   of bytes appended. ASCII characters have no decompositions, so this is
+   simply a conversion to uppercase. */
+static size_t uni_ascii_prefix_to_titlecase_scalar(const unsigned char *input,
+						   size_t size,
+						   buffer_t *output)
+{
+	unsigned char *dest;
+	size_t i, len;
+
+	len = uni_ascii_prefix_len_scalar(input, size);
+	dest = buffer_append_space_unsafe(output, len);
+	for (i = 0; i < len; i++)
+		dest[i] = titlecase8_map[input[i]];
+	return len;
+}
+
+#ifdef HAVE_CPU_X86_SIMD
+static size_t ATTR_TARGET("sse2")
+uni_ascii_prefix_len_sse2(const unsigned char *input, size_t size)
+{
+	unsigned int mask;
+	size_t i;
+
+	for (i = 0; i + 16 <= size; i += 16) {
+		mask = _mm_movemask_epi8(
+			_mm_loadu_si128((const void *)(input + i)));
+		if (mask != 0)
+			return i + __builtin_ctz(mask);
+	}
+	return i + uni_ascii_prefix_len_scalar(input + i, size - i);
+}
+
+static size_t ATTR_TARGET("sse2")
+uni_ascii_prefix_to_titlecase_sse2(const unsigned char *input, size_t size,
+				   buffer_t *output)
+{
+	const __m128i before_a = _mm_set1_epi8('a' - 1);
+	const __m128i after_z = _mm_set1_epi8('z' + 1);
+	const __m128i case_bit = _mm_set1_epi8(0x20);
+	__m128i block, is_lower;
+	unsigned char *dest;
+	size_t i, len;
+
+	len = uni_ascii_prefix_len_sse2(input, size);
+	dest = buffer_append_space_unsafe(output, len);
+	for (i = 0; i + 16 <= len; i += 16) {
+		/* the bytes are all ASCII, so signed comparison works */
+		block = _mm_loadu_si128((const void *)(input + i));
+		is_lower = _mm_and_si128(_mm_cmpgt_epi8(block, before_a),
+					 _mm_cmplt_epi8(block, after_z));
+		block = _mm_sub_epi8(block, _mm_and_si128(is_lower, case_bit));
+		_mm_storeu_si128((void *)(dest + i), block);
+	}
+	for (; i < len; i++)
+		dest[i] = titlecase8_map[input[i]];
+	return len;
+}
+#endif
+
+static inline size_t
+uni_ascii_prefix_len(const unsigned char *input, size_t size)
+{
+#ifdef HAVE_CPU_X86_SIMD
+	if (size >= 16 && (cpu_features_get() & CPU_FEATURE_SSE2) != 0)
+		return uni_ascii_prefix_len_sse2(input, size);
+#endif
+	return uni_ascii_prefix_len_scalar(input, size);
+}
+
+static inline size_t
+uni_ascii_prefix_to_titlecase(const unsigned char *input, size_t size,
+			      buffer_t *output)
+{
+#ifdef HAVE_CPU_X86_SIMD
+	if (size >= 16 && (cpu_features_get() & CPU_FEATURE_SSE2) != 0)
+		return uni_ascii_prefix_to_titlecase_sse2(input, size, output);
+#endif
+	return uni_ascii_prefix_to_titlecase_scalar(input, size, output);
+}
+
 int uni_utf8_to_decomposed_titlecase(const void *_input, size_t size,
 				     buffer_t *output)
 {
 	const unsigned char *input = _input;
 	unsigned int bytes;
+	size_t len;
 	unichar_t chr;
 	int ret = 0;
 
 	while (size > 0) {
+		if (*input < 0x80) {
+			len = uni_ascii_prefix_to_titlecase(input, size, output);
+			input += len;
+			size -= len;
+			continue;
+		}
 		if (uni_utf8_get_char_n(input, size, &chr) <= 0) {
 			/* invalid input. try the next byte. */
 			ret = -1;
@@ -338,9 +430,8 @@ int uni_utf8_to_decomposed_titlecase(const void *_input, size_t size,
 		chr = uni_ucs4_to_titlecase(chr);
 		if (chr >= HANGUL_FIRST && chr <= HANGUL_LAST)
 			uni_ucs4_decompose_hangul_utf8(chr, output);
-		else if (uni_ucs4_decompose_uni(&chr) ||
-			 !uni_ucs4_decompose_multi_utf8(chr, output))
-			uni_ucs4_to_utf8_c(chr, output);
+		else
+			uni_ucs4_decompose_utf8(chr, output);
 	}
 	return ret;
 }
@@ -363,7 +454,7 @@ static int uni_utf8_find_invalid_pos(const unsigned char *input, size_t size,
 	/* find the first invalid utf8 sequence */
 	for (i = 0; i < size;) {
 		if (input[i] < 0x80)
-			i++;
+			i += uni_ascii_prefix_len(input + i, size - i);
 		else {
 			len = is_valid_utf8_seq(input + i, size-i);
 			if (unlikely(len == 0)) {
@@ -390,7 +481,9 @@ bool uni_utf8_get_valid_data(const unsigned char *input, size_t size,
 	output_add_replacement_char(buf);
 	while (i < size) {
 		if (input[i] < 0x80) {
-			buffer_append_c(buf, input[i++]);
+			len = uni_ascii_prefix_len(input + i, size - i);
+			buffer_append(buf, input + i, len);
+			i += len;
 			continue;
 		}
 
@@ -113,13 +113,52 @@ print "static const uint16_t titlecase8_map[256] = {\n\t";
 print_map8(\%titlecase8);
 print "\n};\n";
 
-print "static const uint16_t titlecase16_keys[] = {\n\t";
-print_list(\@titlecase16_keys);
-print "\n};\n";
+# Two-level lookup table for 16bit code points. The first level maps the
+# code point's high byte to a page number (0 = no page), the second level
+# contains the values for all the 256 code points in the page.
+sub print_pages16 {
+  my ($name, $map, $identity) = @_;
+  my (%pages, @page_list, @page_idx);
+
+  foreach my $code (keys %$map) {
+    $pages{$code >> 8} = 1;
+  }
+  @page_list = sort { $a <=> $b } keys %pages;
+  die "Error: Too many pages in $name" if (scalar(@page_list) > 0xff);
+  for (my $i = 0; $i <= 0xff; $i++) {
+    $page_idx[$i] = 0;
+  }
+  for (my $i = 0; $i < scalar(@page_list); $i++) {
+    $page_idx[$page_list[$i]] = $i + 1;
+  }
 
-print "static const uint16_t titlecase16_values[] = {\n\t";
-print_list(\@titlecase16_values);
-print "\n};\n";
+  print "static const uint8_t ${name}_page_idx[256] = {\n\t";
+  print_list(\@page_idx);
+  print "\n};\n";
+
+  print "static const uint16_t ${name}_pages[][256] = {\n";
+  foreach my $page (@page_list) {
+    my @list;
+    for (my $i = 0; $i <= 0xff; $i++) {
+      my $code = ($page << 8) | $i;
+      if (defined($map->{$code})) {
+	push @list, $map->{$code};
+      } else {
+	push @list, $identity ? $code : 0;
+      }
+    }
+    print "\t{ ";
+    print_list(\@list);
+    print " },\n";
+  }
+  print "};\n";
+}
+
+my %titlecase16;
+for (my $i = 0; $i < scalar(@titlecase16_keys); $i++) {
+  $titlecase16{$titlecase16_keys[$i]} = $titlecase16_values[$i];
+}
+print_pages16("titlecase16", \%titlecase16, 1);
 
 print "static const uint32_t titlecase32_keys[] = {\n\t";
 print_list(\@titlecase32_keys);
@@ -133,9 +172,20 @@ print "static const uint16_t uni8_decomp_map[256] = {\n\t";
 print_map8(\%uni8_decomp);
 print "\n};\n";
 
-print "static const uint16_t uni16_decomp_keys[] = {\n\t";
-print_list(\@uni16_decomp_keys);
-print "\n};\n";
+# decomp16 values: 0 = no decomposition, 0x8000 | n = multidecomp_offsets[n],
+# otherwise uni16_decomp_values[n-1]
+my %decomp16;
+die "Error: Too many 16bit decompositions" if (scalar(@uni16_decomp_keys) >= 0x8000);
+for (my $i = 0; $i < scalar(@uni16_decomp_keys); $i++) {
+  $decomp16{$uni16_decomp_keys[$i]} = $i + 1;
+}
+die "Error: Too many multi-decompositions" if (scalar(@multidecomp_keys) >= 0x8000);
+for (my $i = 0; $i < scalar(@multidecomp_keys); $i++) {
+  if ($multidecomp_keys[$i] <= 0xffff) {
+    $decomp16{$multidecomp_keys[$i]} = 0x8000 | $i;
+  }
+}
+print_pages16("decomp16", \%decomp16, 0);
 
 print "static const uint32_t uni16_decomp_values[] = {\n\t";
 print_list(\@uni16_decomp_values);
@@ -149,10 +199,6 @@ print "static const uint32_t uni32_decomp_values[] = {\n\t";
 print_list(\@uni32_decomp_values);
 print "\n};\n";
 
-print "static const uint32_t multidecomp_keys[] = {\n\t";
-print_list(\@multidecomp_keys);
-print "\n};\n";
-
 print "static const uint16_t multidecomp_offsets[] = {\n\t";
 print_list(\@multidecomp_offsets);
 print "\n};\n";
@@ -53,6 +53,8 @@ static void login_access_lookup_next(struct login_access_lookup *lookup);
 
 void login_refresh_proctitle(void)
 {
+	const struct master_service_accept_stats *stats =
+		master_service_get_accept_stats(master_service);
 	struct client *client = clients;
 	const char *addr;
 
@@ -62,8 +64,13 @@ void login_refresh_proctitle(void)
 	if (clients_get_count() == 0) {
 		process_title_set("");
 	} else if (clients_get_count() > 1 || client == NULL) {
-		process_title_set(t_strdup_printf("[%u connections (%u TLS)]",
-			clients_get_count(), ssl_proxy_get_count()));
+		process_title_set(t_strdup_printf(
+			"[%u connections (%u TLS), %u/%u wasted wakeups, "
+			"avg accept %llu us]",
+			clients_get_count(), ssl_proxy_get_count(),
+			stats->wasted_wakeups, stats->wakeups,
+			stats->accepts == 0 ? 0 :
+			stats->accept_latency_usecs / stats->accepts));
 	} else if ((addr = net_ip2addr(&client->ip)) != NULL) {
 		process_title_set(t_strdup_printf(client->tls ?
 						  "[%s TLS]" : "[%s]", addr));
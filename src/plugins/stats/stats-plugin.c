@@ -180,6 +180,12 @@ void mail_stats_get(struct stats_user *suser, struct mail_stats *stats_r)
 	stats_r->disk_input = (unsigned long long)usage.ru_inblock * 512ULL;
 	stats_r->disk_output = (unsigned long long)usage.ru_oublock * 512ULL;
 	process_read_io_stats(stats_r);
+	stats_r->cache_compress_count =
+		suser->cache_compress_stats.compress_count;
+	stats_r->cache_compress_usecs =
+		suser->cache_compress_stats.compress_usecs;
+	stats_r->cache_compress_bytes =
+		suser->cache_compress_stats.reclaimed_bytes;
 	user_trans_stats_get(suser, &stats_r->trans_stats);
 }
 
@@ -229,6 +235,12 @@ void mail_stats_add_diff(struct mail_stats *dest,
 	dest->write_count += new_stats->write_count - old_stats->write_count;
 	dest->read_bytes += new_stats->read_bytes - old_stats->read_bytes;
 	dest->write_bytes += new_stats->write_bytes - old_stats->write_bytes;
+	dest->cache_compress_count += new_stats->cache_compress_count -
+		old_stats->cache_compress_count;
+	dest->cache_compress_usecs += new_stats->cache_compress_usecs -
+		old_stats->cache_compress_usecs;
+	dest->cache_compress_bytes += new_stats->cache_compress_bytes -
+		old_stats->cache_compress_bytes;
 
 	timeval_add_diff(&dest->user_cpu, &new_stats->user_cpu,
 			 &old_stats->user_cpu);
@@ -267,6 +279,11 @@ void mail_stats_export(string_t *str, const struct mail_stats *stats)
 	str_printfa(str, "\tmrcount=%lu", tstats->files_read_count);
 	str_printfa(str, "\tmrbytes=%llu", tstats->files_read_bytes);
 	str_printfa(str, "\tmcache=%lu", tstats->cache_hit_count);
+	str_printfa(str, "\tccomp=%u", stats->cache_compress_count);
+	str_printfa(str, "\tccusecs=%llu",
+		    (unsigned long long)stats->cache_compress_usecs);
+	str_printfa(str, "\tccbytes=%llu",
+		    (unsigned long long)stats->cache_compress_bytes);
 }
 
 static void stats_add_session(struct mail_user *user)
@@ -285,6 +302,7 @@ static bool session_has_changed(const struct mail_stats *prev,
 {
 	if (cur->disk_input != prev->disk_input ||
 	    cur->disk_output != prev->disk_output ||
+	    cur->cache_compress_count != prev->cache_compress_count ||
 	    memcmp(&cur->trans_stats, &prev->trans_stats,
 		   sizeof(cur->trans_stats)) != 0)
 		return TRUE;
@@ -439,6 +457,41 @@ static bool stats_search_next_nonblock(struct mail_search_context *ctx,
 	return ret;
 }
 
+static void stats_mailbox_cache_compress_stats(struct mailbox *box)
+{
+	struct stats_user *suser = STATS_USER_CONTEXT(box->storage->user);
+	struct mail_cache_compress_stats stats;
+
+	if (box->cache == NULL)
+		return;
+
+	mail_cache_pop_compress_stats(box->cache, &stats);
+	suser->cache_compress_stats.compress_count += stats.compress_count;
+	suser->cache_compress_stats.compress_usecs += stats.compress_usecs;
+	suser->cache_compress_stats.reclaimed_bytes += stats.reclaimed_bytes;
+}
+
+static int
+stats_sync_deinit(struct mailbox_sync_context *ctx,
+		  struct mailbox_sync_status *status_r)
+{
+	struct mailbox *box = ctx->box;
+	struct stats_mailbox *sbox = STATS_CONTEXT(box);
+	int ret;
+
+	ret = sbox->module_ctx.super.sync_deinit(ctx, status_r);
+	stats_mailbox_cache_compress_stats(box);
+	return ret;
+}
+
+static void stats_mailbox_close(struct mailbox *box)
+{
+	struct stats_mailbox *sbox = STATS_CONTEXT(box);
+
+	stats_mailbox_cache_compress_stats(box);
+	sbox->module_ctx.super.close(box);
+}
+
 static void
 stats_notify_ok(struct mailbox *box, const char *text, void *context)
 {
@@ -485,6 +538,8 @@ static void stats_mailbox_allocated(struct mailbox *box)
 	v->transaction_commit = stats_transaction_commit;
 	v->transaction_rollback = stats_transaction_rollback;
 	v->search_next_nonblock = stats_search_next_nonblock;
+	v->sync_deinit = stats_sync_deinit;
+	v->close = stats_mailbox_close;
 	MODULE_CONTEXT_SET(box, stats_storage_module, sbox);
 }
 
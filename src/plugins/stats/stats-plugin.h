@@ -4,6 +4,7 @@
 #include "module-context.h"
 #include "guid.h"
 #include "mail-user.h"
+#include "mail-cache.h"
 #include "mail-storage-private.h"
 
 #include <sys/time.h>
@@ -23,6 +24,9 @@ struct mail_stats {
 	/* read()/write() syscall count and number of bytes */
 	uint32_t read_count, write_count;
 	uint64_t read_bytes, write_bytes;
+	/* cache file compressions, time used for them and bytes reclaimed */
+	uint32_t cache_compress_count;
+	uint64_t cache_compress_usecs, cache_compress_bytes;
 	struct mailbox_transaction_stats trans_stats;
 };
 
@@ -49,6 +53,10 @@ struct stats_user {
 	struct mail_stats last_sent_session_stats;
 	bool session_sent_duplicate;
 
+	/* cache compression statistics from all of the closed/synced
+	   mailboxes */
+	struct mail_cache_compress_stats cache_compress_stats;
+
 	/* list of all currently existing transactions for this user */
 	struct stats_transaction_context *transactions;
 };
@@ -24,6 +24,9 @@ struct replicator_sync_lookup {
 
 struct replicator_queue {
 	struct priorityq *user_queue;
+	/* users, their usernames and user_hash's nodes are allocated from
+	   here */
+	pool_t user_pool;
 	/* username => struct replicator_user* */
 	HASH_TABLE(char *, struct replicator_user *) user_hash;
 
@@ -88,7 +91,8 @@ replicator_queue_init(unsigned int full_sync_interval,
 	queue->full_sync_interval = full_sync_interval;
 	queue->failure_resync_interval = failure_resync_interval;
 	queue->user_queue = priorityq_init(user_priority_cmp, 1024);
-	hash_table_create(&queue->user_hash, default_pool, 1024,
+	queue->user_pool = pool_slab_create("replicator users");
+	hash_table_create(&queue->user_hash, queue->user_pool, 1024,
 			  str_hash, strcmp);
 	i_array_init(&queue->sync_lookups, 32);
 	return queue;
@@ -112,6 +116,7 @@ void replicator_queue_deinit(struct replicator_queue **_queue)
 
 	priorityq_deinit(&queue->user_queue);
 	hash_table_destroy(&queue->user_hash);
+	pool_unref(&queue->user_pool);
 	i_assert(array_count(&queue->sync_lookups) == 0);
 	array_free(&queue->sync_lookups);
 	i_free(queue);
@@ -139,8 +144,8 @@ replicator_queue_add_int(struct replicator_queue *queue, const char *username,
 
 	user = replicator_queue_lookup(queue, username);
 	if (user == NULL) {
-		user = i_new(struct replicator_user, 1);
-		user->username = i_strdup(username);
+		user = p_new(queue->user_pool, struct replicator_user, 1);
+		user->username = p_strdup(queue->user_pool, username);
 		hash_table_insert(queue->user_hash, user->username, user);
 	} else {
 		if (user->priority > priority) {
@@ -202,8 +207,8 @@ void replicator_queue_remove(struct replicator_queue *queue,
 	hash_table_remove(queue->user_hash, user->username);
 
 	i_free(user->state);
-	i_free(user->username);
-	i_free(user);
+	p_free(queue->user_pool, user->username);
+	p_free(queue->user_pool, user);
 
 	if (queue->change_callback != NULL)
 		queue->change_callback(queue->change_context);
@@ -102,7 +102,9 @@ client_export_mail_stats(string_t *str, const struct mail_stats *stats)
 	"\tdisk_input\tdisk_output" \
 	"\tread_count\tread_bytes\twrite_count\twrite_bytes" \
 	"\tmail_lookup_path\tmail_lookup_attr" \
-	"\tmail_read_count\tmail_read_bytes\tmail_cache_hits\n"
+	"\tmail_read_count\tmail_read_bytes\tmail_cache_hits" \
+	"\tmail_cache_compressions\tmail_cache_compress_usecs" \
+	"\tmail_cache_compress_bytes\n"
 
 	str_printfa(str, "\t%ld.%06u", (long)stats->user_cpu.tv_sec,
 		    (unsigned int)stats->user_cpu.tv_usec);
@@ -121,6 +123,9 @@ client_export_mail_stats(string_t *str, const struct mail_stats *stats)
 		    stats->mail_read_count,
 		    (unsigned long long)stats->mail_read_bytes,
 		    stats->mail_cache_hits);
+	str_printfa(str, "\t%u\t%llu\t%llu", stats->mail_cache_compressions,
+		    (unsigned long long)stats->mail_cache_compress_usecs,
+		    (unsigned long long)stats->mail_cache_compress_bytes);
 }
 
 static bool
@@ -35,7 +35,11 @@ struct mail_stats_parse_map {
 	EN("mlattr", mail_lookup_attr),
 	EN("mrcount", mail_read_count),
 	EN("mrbytes", mail_read_bytes),
-	EN("mcache", mail_cache_hits)
+	EN("mcache", mail_cache_hits),
+
+	EN("ccomp", mail_cache_compressions),
+	EN("ccusecs", mail_cache_compress_usecs),
+	EN("ccbytes", mail_cache_compress_bytes)
 };
 
 static int mail_stats_parse_timeval(const char *value, struct timeval *tv)
@@ -16,6 +16,9 @@ struct mail_stats {
 	uint32_t mail_lookup_path, mail_lookup_attr, mail_read_count;
 	uint32_t mail_cache_hits;
 	uint64_t mail_read_bytes;
+
+	uint32_t mail_cache_compressions;
+	uint64_t mail_cache_compress_usecs, mail_cache_compress_bytes;
 };
 
 struct mail_command {